@@ -0,0 +1,406 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <cairo.h>
+#include <cjson/cJSON.h>
+#include "weather.h"
+#include "menu.h"
+#include "calendar.h"
+#include "dashboard_render.h"
+#include "eink_regions.h"
+#include "pixel_convert.h"
+#include "dither.h"
+#include "recurrence.h"
+#include "time_service.h"
+#include "metrics.h"
+#include "http.h"
+
+// Offline benchmark: replays recorded fixtures through the parse, render and packing code
+// (no Waveshare/lgpio, no network: feeds are read through file:// URLs by the real HTTP client)
+
+#define BENCH_DEFAULT_ITERATIONS 100
+#define BENCH_FIXTURES_DIR PROJECT_ROOT "/bench/fixtures"
+#define BENCH_MAX_PATH 512
+
+#ifndef BUILD_PROFILE
+#define BUILD_PROFILE "unknown"
+#endif
+
+// Day the fixtures were recorded for (calendar window and header date)
+#define BENCH_YEAR 2025
+#define BENCH_MONTH 3
+#define BENCH_DAY 10
+#define BENCH_SECONDS_OF_DAY (9 * 3600 + 15 * 60)
+
+// Landscape panel frame, as packed by display_dashboard.c
+#define BENCH_FRAME_WIDTH EINK_HEIGHT
+#define BENCH_FRAME_HEIGHT EINK_WIDTH
+#define BENCH_FRAME_ROW_BYTES (BENCH_FRAME_WIDTH / 8)
+
+typedef enum {
+    STAGE_WEATHER,
+    STAGE_CALENDAR,
+    STAGE_RENDER,
+    STAGE_PACK,
+    STAGE_COUNT
+} BenchStage;
+
+static const char *const stage_names[STAGE_COUNT] = {
+    "weather", "calendar", "render", "pack"
+};
+
+typedef struct {
+    uint64_t *samples_ns;
+    unsigned long long allocations;
+    unsigned long long allocated_bytes;
+} StageResult;
+
+// ====================== ALLOCATION COUNTING ======================
+
+static unsigned long long g_allocations = 0;
+static unsigned long long g_allocated_bytes = 0;
+
+#ifdef __GLIBC__
+// Interpose the allocator for the whole process (cairo, curl and cJSON included)
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+static inline void count_allocation(size_t size) {
+    __atomic_fetch_add(&g_allocations, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&g_allocated_bytes, size, __ATOMIC_RELAXED);
+}
+
+void *malloc(size_t size) {
+    count_allocation(size);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    count_allocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    count_allocation(size);
+    return __libc_realloc(ptr, size);
+}
+#define BENCH_COUNTS_ALLOCATIONS 1
+#else
+#define BENCH_COUNTS_ALLOCATIONS 0
+#endif
+
+// ====================== FIXTURES ======================
+
+static int load_menu_fixture(const char *path, MenuData *menu) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "❌ Cannot open menu fixture %s\n", path);
+        return -1;
+    }
+
+    char content[MENU_CACHE_MAX_FILE_SIZE + 1];
+    size_t size = fread(content, 1, MENU_CACHE_MAX_FILE_SIZE, file);
+    fclose(file);
+    content[size] = '\0';
+
+    cJSON *json = cJSON_Parse(content);
+    if (!json) {
+        fprintf(stderr, "❌ Invalid menu fixture %s\n", path);
+        return -1;
+    }
+
+    const char *keys[] = { "today", "tomorrow" };
+    DayMenuData *days[] = { &menu->today, &menu->tomorrow };
+    for (int i = 0; i < 2; i++) {
+        const cJSON *day = cJSON_GetObjectItem(json, keys[i]);
+        const cJSON *date = cJSON_GetObjectItem(day, "date");
+        const cJSON *midi = cJSON_GetObjectItem(day, "midi");
+        const cJSON *soir = cJSON_GetObjectItem(day, "soir");
+        snprintf(days[i]->date, sizeof(days[i]->date), "%s", cJSON_IsString(date) ? date->valuestring : "");
+        snprintf(days[i]->midi, sizeof(days[i]->midi), "%s", cJSON_IsString(midi) ? midi->valuestring : "-");
+        snprintf(days[i]->soir, sizeof(days[i]->soir), "%s", cJSON_IsString(soir) ? soir->valuestring : "-");
+    }
+
+    cJSON_Delete(json);
+    return 0;
+}
+
+// ====================== STATISTICS ======================
+
+static int compare_samples(const void *a, const void *b) {
+    uint64_t left = *(const uint64_t *)a;
+    uint64_t right = *(const uint64_t *)b;
+    return (left > right) - (left < right);
+}
+
+// Nearest-rank percentile of sorted samples
+static double percentile_ms(const uint64_t *sorted, int count, double percentile) {
+    int rank = (int)(percentile / 100.0 * count + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1] / 1e6;
+}
+
+/**
+ * Print the per-stage table and fill medians_ms
+ * baseline_ms: medians of another build (speedup column, 0 for a stage it lacks), or NULL
+ */
+static void print_report(StageResult *results, int iterations, const double *baseline_ms,
+                         double *medians_ms) {
+    printf("\n%-10s %10s %10s %10s %10s %12s %12s%s\n",
+           "stage", "min ms", "median ms", "p99 ms", "mean ms", "allocs/iter", "KiB/iter",
+           baseline_ms ? "    speedup" : "");
+
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        uint64_t *samples = results[stage].samples_ns;
+        qsort(samples, iterations, sizeof(uint64_t), compare_samples);
+
+        uint64_t total = 0;
+        for (int i = 0; i < iterations; i++) total += samples[i];
+        medians_ms[stage] = percentile_ms(samples, iterations, 50.0);
+
+        printf("%-10s %10.3f %10.3f %10.3f %10.3f", stage_names[stage], samples[0] / 1e6,
+               medians_ms[stage], percentile_ms(samples, iterations, 99.0), total / 1e6 / iterations);
+        if (BENCH_COUNTS_ALLOCATIONS) {
+            printf(" %12.1f %12.1f", (double)results[stage].allocations / iterations,
+                   results[stage].allocated_bytes / 1024.0 / iterations);
+        } else {
+            printf(" %12s %12s", "n/a", "n/a");
+        }
+        if (baseline_ms && baseline_ms[stage] > 0 && medians_ms[stage] > 0) {
+            printf(" %10.2fx", baseline_ms[stage] / medians_ms[stage]);
+        } else if (baseline_ms) {
+            printf(" %11s", "n/a");
+        }
+        printf("\n");
+    }
+}
+
+// ====================== BASELINE ======================
+
+/**
+ * Save the stage medians for a later run of another build (-c)
+ * Returns: 0 on success, -1 on failure
+ */
+static int save_baseline(const char *path, const double *medians_ms) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "❌ Failed to write baseline %s\n", path);
+        return -1;
+    }
+
+    fprintf(file, "profile %s\n", BUILD_PROFILE);
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        fprintf(file, "%s %.6f\n", stage_names[stage], medians_ms[stage]);
+    }
+
+    int failed = ferror(file);
+    if (fclose(file) != 0 || failed) {
+        fprintf(stderr, "❌ Failed to write baseline %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Load stage medians saved by save_baseline (stages missing from the file stay at 0)
+ * Returns: 0 on success, -1 if the file can't be read
+ */
+static int load_baseline(const char *path, double *medians_ms, char *profile, size_t profile_size) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "❌ Failed to read baseline %s (save one with -s)\n", path);
+        return -1;
+    }
+
+    snprintf(profile, profile_size, "%s", "baseline");
+    char name[64];
+    char value[64];
+    while (fscanf(file, "%63s %63s", name, value) == 2) {
+        if (strcmp(name, "profile") == 0) {
+            snprintf(profile, profile_size, "%s", value);
+            continue;
+        }
+        for (int stage = 0; stage < STAGE_COUNT; stage++) {
+            if (strcmp(name, stage_names[stage]) == 0) {
+                medians_ms[stage] = strtod(value, NULL);
+            }
+        }
+    }
+    fclose(file);
+    return 0;
+}
+
+// ====================== BENCHMARK ======================
+
+// Same packing as display_dashboard.c: threshold frame, diffused weather icons
+static void pack_frame(cairo_surface_t *surface, uint8_t *luma, uint8_t *frame) {
+    EinkRect whole_frame = {0, 0, BENCH_FRAME_WIDTH, BENCH_FRAME_HEIGHT};
+
+    pixel_luma_rotate(cairo_image_surface_get_data(surface), EINK_WIDTH, EINK_HEIGHT,
+                      cairo_image_surface_get_stride(surface), luma);
+    dither_region(luma, BENCH_FRAME_WIDTH, BENCH_FRAME_HEIGHT, DITHER_THRESHOLD, whole_frame,
+                  frame, BENCH_FRAME_ROW_BYTES);
+    dither_region(luma, BENCH_FRAME_WIDTH, BENCH_FRAME_HEIGHT, DITHER_FLOYD_STEINBERG,
+                  eink_section_rect(SECTION_WEATHER, BENCH_FRAME_HEIGHT), frame, BENCH_FRAME_ROW_BYTES);
+}
+
+// Time one stage; samples are only kept when record is set (warm-up run otherwise)
+#define BENCH_STAGE(stage, record, body) do { \
+    unsigned long long allocations_before = g_allocations; \
+    unsigned long long bytes_before = g_allocated_bytes; \
+    uint64_t started = metrics_start(); \
+    body; \
+    uint64_t elapsed = metrics_start() - started; \
+    if (record) { \
+        results[stage].samples_ns[iteration] = elapsed; \
+        results[stage].allocations += g_allocations - allocations_before; \
+        results[stage].allocated_bytes += g_allocated_bytes - bytes_before; \
+    } \
+} while (0)
+
+static void print_usage(const char *program) {
+    printf("Usage: %s [options]\n", program);
+    printf("Options:\n");
+    printf("  -n ITERATIONS    Timed iterations per stage (default %d)\n", BENCH_DEFAULT_ITERATIONS);
+    printf("  -f DIR           Fixture directory, absolute path (default %s)\n", BENCH_FIXTURES_DIR);
+    printf("  -o FILE.png      Save the last rendered dashboard\n");
+    printf("  -s FILE          Save the stage medians as a baseline for other builds\n");
+    printf("  -c FILE          Report the speedup over a saved baseline\n");
+}
+
+int main(int argc, char *argv[]) {
+    int iterations = BENCH_DEFAULT_ITERATIONS;
+    const char *fixtures = BENCH_FIXTURES_DIR;
+    const char *png_path = NULL;
+    const char *save_path = NULL;
+    const char *compare_path = NULL;
+
+    int option;
+    while ((option = getopt(argc, argv, "n:f:o:s:c:h")) != -1) {
+        switch (option) {
+            case 'n': iterations = atoi(optarg); break;
+            case 'f': fixtures = optarg; break;
+            case 'o': png_path = optarg; break;
+            case 's': save_path = optarg; break;
+            case 'c': compare_path = optarg; break;
+            default:
+                print_usage(argv[0]);
+                return option == 'h' ? 0 : 1;
+        }
+    }
+    if (iterations < 1) {
+        fprintf(stderr, "❌ Iteration count must be positive\n");
+        return 1;
+    }
+
+    // Read the baseline first: a missing file should fail before the timed run
+    double baseline_ms[STAGE_COUNT] = {0};
+    double medians_ms[STAGE_COUNT] = {0};
+    char baseline_profile[64];
+    if (compare_path && load_baseline(compare_path, baseline_ms, baseline_profile,
+                                      sizeof(baseline_profile)) != 0) {
+        return 1;
+    }
+
+    char weather_url[BENCH_MAX_PATH];
+    char calendar_url[BENCH_MAX_PATH];
+    char menu_path[BENCH_MAX_PATH];
+    snprintf(weather_url, sizeof(weather_url), "file://%s/open-meteo", fixtures);
+    snprintf(calendar_url, sizeof(calendar_url), "file://%s/calendar.ics", fixtures);
+    snprintf(menu_path, sizeof(menu_path), "%s/menus.json", fixtures);
+
+    time_t date = time_service_make_local(recurrence_day_from_civil(BENCH_YEAR, BENCH_MONTH, BENCH_DAY),
+                                          BENCH_SECONDS_OF_DAY);
+
+    MenuData menu;
+    if (load_menu_fixture(menu_path, &menu) != 0 || http_init() != 0) {
+        return 1;
+    }
+
+    WeatherClient *weather_client = weather_client_init(weather_url, 48.86, 2.34, 0);
+    CalendarClient *calendar_client = calendar_client_init(calendar_url, 0);
+    cairo_surface_t *surface = cairo_image_surface_create(CAIRO_FORMAT_RGB24, EINK_WIDTH, EINK_HEIGHT);
+    uint8_t *luma = malloc(EINK_WIDTH * EINK_HEIGHT);
+    uint8_t *frame = malloc(BENCH_FRAME_ROW_BYTES * BENCH_FRAME_HEIGHT);
+
+    StageResult results[STAGE_COUNT];
+    memset(results, 0, sizeof(results));
+    int ready = weather_client && calendar_client && luma && frame &&
+                cairo_surface_status(surface) == CAIRO_STATUS_SUCCESS && init_dashboard_fonts();
+    for (int stage = 0; ready && stage < STAGE_COUNT; stage++) {
+        results[stage].samples_ns = calloc(iterations, sizeof(uint64_t));
+        ready = results[stage].samples_ns != NULL;
+    }
+    if (!ready) {
+        fprintf(stderr, "❌ Failed to set up the benchmark (fixtures in %s, fonts)\n", fixtures);
+        return 1;
+    }
+
+    printf("📊 Benchmark: %d iterations after one warm-up, fixtures %s, pixel backend %s, %s build\n",
+           iterations, fixtures, pixel_convert_backend(), BUILD_PROFILE);
+
+    // Iteration -1 warms up fonts, glyph caches and the HTTP client
+    int failures = 0;
+    for (int iteration = -1; iteration < iterations; iteration++) {
+        int record = iteration >= 0;
+        WeatherData weather;
+        CalendarData calendar;
+        memset(&calendar, 0, sizeof(calendar));
+        int weather_result = 0;
+        int calendar_result = 0;
+
+        BENCH_STAGE(STAGE_WEATHER, record, weather_result = get_weather_data(weather_client, &weather));
+        BENCH_STAGE(STAGE_CALENDAR, record,
+                    calendar_result = get_calendar_events_data(calendar_client, &calendar, date));
+        if (weather_result != 0 || calendar_result != 0) {
+            failures++;
+        }
+
+        // Same fixtures every iteration: drop the retained layers so every section is drawn
+        invalidate_dashboard_layers();
+        BENCH_STAGE(STAGE_RENDER, record,
+                    render_dashboard_to_surface(surface, date, weather_result == 0 ? &weather : NULL, &menu,
+                                                calendar_result == 0 ? &calendar : NULL);
+                    cairo_surface_flush(surface));
+
+        BENCH_STAGE(STAGE_PACK, record, pack_frame(surface, luma, frame));
+
+        calendar_data_free(&calendar);
+    }
+
+    print_report(results, iterations, compare_path ? baseline_ms : NULL, medians_ms);
+    if (compare_path) {
+        printf("\n🚀 Speedup: median time of the %s build over this %s build\n",
+               baseline_profile, BUILD_PROFILE);
+    }
+    if (failures > 0) {
+        printf("\n⚠️  %d iteration%s could not read a fixture (rendered without that section)\n",
+               failures, failures > 1 ? "s" : "");
+    }
+
+    if (png_path && cairo_surface_write_to_png(surface, png_path) == CAIRO_STATUS_SUCCESS) {
+        printf("🖼️  Last render saved to %s\n", png_path);
+    }
+    if (save_path && save_baseline(save_path, medians_ms) == 0) {
+        printf("💾 Stage medians saved to %s\n", save_path);
+    }
+
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        free(results[stage].samples_ns);
+    }
+    free(frame);
+    free(luma);
+    cairo_surface_destroy(surface);
+    release_dashboard_layers();
+    cleanup_dashboard_fonts();
+    calendar_client_free(calendar_client);
+    weather_client_free(weather_client);
+    http_cleanup();
+    return failures == iterations + 1 ? 1 : 0;
+}
@@ -28,6 +28,10 @@ class GoogleSheetsMenuParser:
             print("❌ Bibliothèques manquantes. Installez avec:")
             print("pip3 install gspread google-auth --break-system-packages")
             return False
+        
+        # Session déjà authentifiée (mode --serve): gspread rafraîchit le token tout seul
+        if self.gc is not None:
+            return True
             
         try:
             # Vérifier que le fichier de credentials existe
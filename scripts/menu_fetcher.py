@@ -8,6 +8,8 @@ import argparse
 import json
 import sys
 import os
+import signal
+import struct
 from datetime import datetime
 
 try:
@@ -34,48 +36,128 @@ def parse_date_string(date_str):
     except (ValueError, IndexError) as e:
         raise ValueError(f"Invalid date format '{date_str}'. Expected DD/MM or DD/MM/YYYY") from e
 
-def get_menu_data(spreadsheet_id, credentials_file, test_date=None):
-    """Fetch menu data using GoogleSheetsMenuParser."""
+def get_menu_data(spreadsheet_id, credentials_file, test_date=None, parser=None, days=2):
+    """
+    Fetch menu data using GoogleSheetsMenuParser (reuses parser when given).
+    Returns today/tomorrow plus a "days" list covering `days` consecutive dates.
+    """
     try:
-        parser = GoogleSheetsMenuParser(credentials_file, spreadsheet_id)
+        from datetime import timedelta
+        if parser is None:
+            parser = GoogleSheetsMenuParser(credentials_file, spreadsheet_id)
         
-        if test_date:
-            # Calculate today and tomorrow from test_date
-            from datetime import timedelta
-            today = test_date
-            tomorrow = test_date + timedelta(days=1)
-            target_dates = [today, tomorrow]
-        else:
-            # Use current date
-            from datetime import datetime, timedelta
-            today = datetime.now()
-            tomorrow = today + timedelta(days=1)
-            target_dates = [today, tomorrow]
+        # Start from test_date if given, otherwise from the current date
+        start = test_date if test_date else datetime.now()
+        target_dates = [start + timedelta(days=i) for i in range(max(days, 2))]
         
         # get_menus_for_dates expects a list of datetime objects
         raw_menus = parser.get_menus_for_dates(target_dates)
         
         # Convert to the expected format
-        today_key = target_dates[0].strftime('%Y-%m-%d')
-        tomorrow_key = target_dates[1].strftime('%Y-%m-%d')
+        day_menus = []
+        for target_date in target_dates:
+            key = target_date.strftime('%Y-%m-%d')
+            day_menus.append({
+                "date": target_date.strftime('%A %d/%m/%Y'),
+                "midi": raw_menus.get(key, {}).get('midi', ''),
+                "soir": raw_menus.get(key, {}).get('soir', '')
+            })
         
         menus = {
-            "today": {
-                "date": target_dates[0].strftime('%A %d/%m/%Y'),
-                "midi": raw_menus.get(today_key, {}).get('midi', ''),
-                "soir": raw_menus.get(today_key, {}).get('soir', '')
-            },
-            "tomorrow": {
-                "date": target_dates[1].strftime('%A %d/%m/%Y'),
-                "midi": raw_menus.get(tomorrow_key, {}).get('midi', ''),
-                "soir": raw_menus.get(tomorrow_key, {}).get('soir', '')
-            }
+            "today": day_menus[0],
+            "tomorrow": day_menus[1],
+            "days": day_menus
         }
         
         return menus
     except Exception as e:
         raise RuntimeError(f"Failed to fetch menu data: {e}") from e
 
+# Worker protocol: 4-byte big-endian length followed by a UTF-8 JSON object
+MAX_FRAME_SIZE = 64 * 1024
+
+
+def read_exact(stream, size):
+    """Read exactly size bytes, or return None on EOF."""
+    data = b''
+    while len(data) < size:
+        chunk = stream.read(size - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return data
+
+
+def read_frame(stream):
+    """Read one request frame, or return None when the dashboard closed the socket."""
+    header = read_exact(stream, 4)
+    if header is None:
+        return None
+    (length,) = struct.unpack('>I', header)
+    if length > MAX_FRAME_SIZE:
+        raise ValueError(f"Frame too large: {length} bytes")
+    payload = read_exact(stream, length)
+    if payload is None:
+        return None
+    return json.loads(payload.decode('utf-8'))
+
+
+def write_frame(stream, message):
+    payload = json.dumps(message, ensure_ascii=False).encode('utf-8')
+    stream.write(struct.pack('>I', len(payload)) + payload)
+    stream.flush()
+
+
+def serve(spreadsheet_id, credentials_file):
+    """
+    Resident worker mode: answer framed requests on stdin/stdout until EOF.
+    Keeps the imports and the authenticated Sheets session warm between requests.
+    Requests:  {"id": 1, "cmd": "menus", "date": "DD/MM/YYYY", "days": 14} or {"id": 2, "cmd": "ping"}
+    Responses: {"id": 1, "ok": true, "menus": {...}} or {"id": 1, "ok": false, "error": "..."}
+    """
+    # The dashboard handles Ctrl-C and stops us by closing the socket
+    signal.signal(signal.SIGINT, signal.SIG_IGN)
+
+    # Keep the protocol stream private: any print() from the menu module goes to stderr
+    requests = os.fdopen(os.dup(0), 'rb', buffering=0)
+    responses = os.fdopen(os.dup(1), 'wb')
+    os.dup2(2, 1)
+    sys.stdout = sys.stderr
+
+    parser = GoogleSheetsMenuParser(credentials_file, spreadsheet_id)
+    if os.path.isfile(credentials_file):
+        parser.setup_connection()
+
+    while True:
+        try:
+            request = read_frame(requests)
+        except (ValueError, UnicodeDecodeError) as e:
+            print(f"❌ Invalid menu request: {e}", file=sys.stderr)
+            return 1
+        if request is None:
+            return 0
+
+        response = {"id": request.get("id")}
+        try:
+            command = request.get("cmd")
+            if command == "ping":
+                response["ok"] = True
+            elif command == "menus":
+                if not os.path.isfile(credentials_file):
+                    raise FileNotFoundError(f"Credentials file not found: {credentials_file}")
+                test_date = parse_date_string(request["date"]) if request.get("date") else None
+                days = min(max(int(request.get("days", 2)), 2), 31)
+                response["menus"] = get_menu_data(spreadsheet_id, credentials_file, test_date, parser, days)
+                response["ok"] = True
+            else:
+                raise ValueError(f"Unknown command: {command}")
+        except Exception as e:
+            response["ok"] = False
+            response["error"] = str(e)
+
+        write_frame(responses, response)
+
+
 def main():
     """Main entry point."""
     parser = argparse.ArgumentParser(
@@ -104,9 +186,18 @@ Examples:
         '--date',
         help='Specific date to fetch menus for (format: DD/MM or DD/MM/YYYY). If not specified, fetches today/tomorrow.'
     )
+    
+    parser.add_argument(
+        '--serve',
+        action='store_true',
+        help='Run as a resident worker answering framed JSON requests on stdin/stdout'
+    )
         
     args = parser.parse_args()
     
+    if args.serve:
+        sys.exit(serve(args.spreadsheet_id, args.credentials))
+    
     try:
         # Parse date if provided
         test_date = None
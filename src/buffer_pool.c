@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include "buffer_pool.h"
+#include "metrics.h"
+
+// ====================== FREE LIST ======================
+
+void* buffer_pool_acquire(BufferPool *pool, size_t size, size_t *capacity) {
+    if (!pool || !capacity) {
+        return NULL;
+    }
+    if (size == 0) {
+        size = 1;
+    }
+
+    // Best fit, so a large response buffer is not spent on a small header block
+    pthread_mutex_lock(&pool->lock);
+    int best = -1;
+    for (int i = 0; i < pool->count; i++) {
+        if (pool->capacities[i] >= size && (best < 0 || pool->capacities[i] < pool->capacities[best])) {
+            best = i;
+        }
+    }
+
+    void *buffer = NULL;
+    if (best >= 0) {
+        buffer = pool->buffers[best];
+        *capacity = pool->capacities[best];
+        pool->count--;
+        pool->buffers[best] = pool->buffers[pool->count];
+        pool->capacities[best] = pool->capacities[pool->count];
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (buffer) {
+        metrics_count(METRIC_POOL_REUSED);
+        return buffer;
+    }
+
+    buffer = malloc(size);
+    if (buffer) {
+        *capacity = size;
+        metrics_count(METRIC_POOL_ALLOCATED);
+    }
+    return buffer;
+}
+
+void* buffer_pool_reserve(void *buffer, size_t *capacity, size_t size) {
+    if (!capacity) {
+        return NULL;
+    }
+    if (buffer && *capacity >= size) {
+        return buffer;
+    }
+
+    size_t grown = buffer ? *capacity : 0;
+    if (grown == 0) {
+        grown = size;
+    }
+    while (grown < size) {
+        grown *= 2;
+    }
+
+    void *moved = realloc(buffer, grown);
+    if (!moved) {
+        return NULL;
+    }
+    *capacity = grown;
+    metrics_count(METRIC_POOL_ALLOCATED);
+    return moved;
+}
+
+void buffer_pool_release(BufferPool *pool, void *buffer, size_t capacity) {
+    if (!buffer) {
+        return;
+    }
+    if (!pool) {
+        free(buffer);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->count < BUFFER_POOL_SLOTS) {
+        pool->buffers[pool->count] = buffer;
+        pool->capacities[pool->count] = capacity;
+        pool->count++;
+        buffer = NULL;
+    } else {
+        // Full: keep the larger buffers, they are the ones that were worth growing
+        int smallest = 0;
+        for (int i = 1; i < pool->count; i++) {
+            if (pool->capacities[i] < pool->capacities[smallest]) {
+                smallest = i;
+            }
+        }
+        if (pool->capacities[smallest] < capacity) {
+            void *evicted = pool->buffers[smallest];
+            pool->buffers[smallest] = buffer;
+            pool->capacities[smallest] = capacity;
+            buffer = evicted;
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    free(buffer);
+}
+
+int buffer_pool_prefill(BufferPool *pool, int count, size_t size) {
+    if (!pool) {
+        return -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        void *buffer = malloc(size > 0 ? size : 1);
+        if (!buffer) {
+            return -1;
+        }
+        metrics_count(METRIC_POOL_ALLOCATED);
+        buffer_pool_release(pool, buffer, size);
+    }
+    return 0;
+}
+
+void buffer_pool_drain(BufferPool *pool) {
+    if (!pool) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    for (int i = 0; i < pool->count; i++) {
+        free(pool->buffers[i]);
+        pool->buffers[i] = NULL;
+    }
+    pool->count = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,51 @@
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <stddef.h>
+#include <pthread.h>
+
+// Released buffers kept per pool (beyond that the smallest goes back to the heap)
+#define BUFFER_POOL_SLOTS 8
+
+// Free list of reusable heap buffers owned by one subsystem
+// Buffers keep the capacity they grew to, so a steady workload stops allocating after warm-up.
+typedef struct {
+    const char *name;
+    void *buffers[BUFFER_POOL_SLOTS];
+    size_t capacities[BUFFER_POOL_SLOTS];
+    int count;
+    pthread_mutex_t lock;
+} BufferPool;
+
+#define BUFFER_POOL_INITIALIZER(pool_name) { pool_name, { NULL }, { 0 }, 0, PTHREAD_MUTEX_INITIALIZER }
+
+/**
+ * Take the smallest free buffer holding at least size bytes, or allocate one
+ * Buffers are plain heap blocks: one that is never released may simply be freed.
+ * Returns: buffer (capacity stored in *capacity), NULL on allocation failure
+ */
+void* buffer_pool_acquire(BufferPool *pool, size_t size, size_t *capacity);
+
+/**
+ * Grow buffer to hold at least size bytes (contents kept, capacity at least doubled)
+ * Returns: buffer (possibly moved, *capacity updated), NULL on failure (buffer left untouched)
+ */
+void* buffer_pool_reserve(void *buffer, size_t *capacity, size_t size);
+
+/**
+ * Hand a buffer back for reuse (NULL is ignored)
+ */
+void buffer_pool_release(BufferPool *pool, void *buffer, size_t capacity);
+
+/**
+ * Allocate count buffers of size bytes up front (startup warm-up)
+ * Returns: 0 on success, -1 on allocation failure
+ */
+int buffer_pool_prefill(BufferPool *pool, int count, size_t size);
+
+/**
+ * Free every buffer held by the pool (at exit)
+ */
+void buffer_pool_drain(BufferPool *pool);
+
+#endif // BUFFER_POOL_H
@@ -2,35 +2,131 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <time.h>
 #include <regex.h>
 #include <curl/curl.h>
 #include "common.h"
 #include "http.h"
+#include "ical_parser.h"
+#include "recurrence.h"
+#include "time_service.h"
 #include "calendar.h"
 #include "logging.h"
+#include "metrics.h"
+#include "buffer_pool.h"
+
+// Sentinel for empty title hash slots
+#define TITLE_SLOT_EMPTY UINT32_MAX
+
+// Last second of a local day (all-day events end at 23:59:59)
+#define END_OF_DAY_SECONDS (23 * 3600 + 59 * 60 + 59)
+
+// Compact indexed event (title stored once in the interned pool)
+typedef struct {
+    time_t start;
+    time_t end;
+    uint32_t title;           // Offset into EventIndex.titles
+    int order;                // Position in the feed (stable tie-break)
+    int event_type;           // EVENT_TYPE_ALL_DAY for VALUE=DATE events, else EVENT_TYPE_NORMAL
+} IndexedEvent;
+
+// Recurring event master (occurrences are generated per day, on demand)
+typedef struct {
+    RecurrenceRule rule;
+    int first_day;            // Local civil day number of DTSTART
+    int last_day;             // Last possible occurrence day (COUNT / UNTIL)
+    time_t until;             // Exact UNTIL bound (0 = none)
+    int start_seconds;        // DTSTART local time of day
+    time_t duration;
+    uint32_t title;
+    uint32_t uid;             // Interned UID (TITLE_SLOT_EMPTY if none)
+    int event_type;
+} RecurringSeries;
+
+// One occurrence removed from a series (EXDATE or RECURRENCE-ID override)
+typedef struct {
+    int series;
+    time_t start;
+} SeriesExclusion;
+
+// RECURRENCE-ID override waiting for its master (which may come later in the feed)
+typedef struct {
+    uint32_t uid;
+    time_t start;
+} PendingOverride;
+
+// Expanded occurrences starting on one local day (order = series index)
+typedef struct {
+    int day;                  // Civil day number, valid only if used
+    int used;
+    unsigned last_used;
+    IndexedEvent *events;
+    int count;
+    int capacity;
+} ExpansionDay;
+
+// CalendarData alive at once (published, still being rendered, being built), preallocated
+#define CALENDAR_POOL_DEPTH 3
+#define CALENDAR_EVENTS_SIZE (MAX_EVENTS_PER_DAY * sizeof(CalendarEvent))
+#define CALENDAR_TITLES_PREFILL 4096
+
+// Event arrays and title arenas handed back by calendar_data_free (shared by every client)
+static BufferPool calendar_event_pool = BUFFER_POOL_INITIALIZER("calendar_events");
+static BufferPool calendar_title_pool = BUFFER_POOL_INITIALIZER("calendar_titles");
+
+// Days of expansions kept per index (today + tomorrow of two consecutive days, plus look-back)
+#define EXPANSION_CACHE_DAYS 8
+
+// EXDATE values kept per VEVENT
+#define MAX_EXDATES_PER_EVENT 64
+
+// All feed events sorted by start time, with a running max of end times for range queries
+typedef struct {
+    IndexedEvent *events;
+    time_t *max_end;          // max_end[i] = max(events[0..i].end)
+    int max_end_capacity;
+    int count;
+    int capacity;
+    RecurringSeries *series;
+    int series_count;
+    int series_capacity;
+    int series_max_days;      // Longest series duration in days (look-back for overlaps)
+    int unsupported_rules;    // RRULEs indexed as single events
+    SeriesExclusion *exclusions; // Sorted by (series, start) once finalized
+    int exclusion_count;
+    int exclusion_capacity;
+    PendingOverride *overrides;
+    int override_count;
+    int override_capacity;
+    ExpansionDay expansions[EXPANSION_CACHE_DAYS];
+    unsigned expansion_clock;
+    char *titles;             // Interned NUL-terminated titles
+    size_t titles_size;
+    size_t titles_capacity;
+    uint32_t *title_slots;    // Open-addressing table of title offsets
+    size_t slot_capacity;
+    int unique_titles;
+} EventIndex;
 
 // Calendar client structure (implementation)
 struct CalendarClient {
     char ical_url[MAX_URL_LENGTH];
     int debug;
+    HttpValidators validators;  // ETag / Last-Modified of the indexed feed
+    EventIndex index;           // Parsed feed, independent of the requested date
+    EventIndex spare;           // Previous index, reset and refilled by the next download
+    IcalParser *parser;         // Reused for every download
+    int index_valid;
+    int parsed_date;            // YYYYMMDD the caller last received data for (0 = none)
 };
 
-// Check if event is all-day with null checking
-static int is_all_day_event(const char* dtstart_line) {
-    return dtstart_line && strstr(dtstart_line, "VALUE=DATE") != NULL;
-}
-
 // Convert time_t to YYYYMMDD integer format for date comparison
 static int time_to_date_int(time_t timestamp) {
     if (timestamp == 0) {
         return 0;
     }
-    struct tm *tm = localtime(&timestamp);
-    if (!tm) {
-        return 0;
-    }
-    return (tm->tm_year + 1900) * 10000 + (tm->tm_mon + 1) * 100 + tm->tm_mday;
+    return time_service_date_int(timestamp);
 }
 
 // Create start of day timestamp with null checking
@@ -43,7 +139,7 @@ static time_t get_start_of_day(const struct tm *tm_day) {
     start_tm.tm_min = 0;
     start_tm.tm_sec = 0;
     start_tm.tm_isdst = -1;
-    return mktime(&start_tm);
+    return time_service_mktime(&start_tm);
 }
 
 // Create end of day timestamp with null checking
@@ -56,7 +152,7 @@ static time_t get_end_of_day(const struct tm *tm_day) {
     end_tm.tm_min = 59;
     end_tm.tm_sec = 59;
     end_tm.tm_isdst = -1;
-    return mktime(&end_tm);
+    return time_service_mktime(&end_tm);
 }
 
 // Remove whitespace from string in-place
@@ -90,116 +186,13 @@ static time_t parse_ical_datetime(const char* dt_string) {
         strptime(clean_dt, "%Y%m%dT%H%M%S", &tm) ||
         strptime(clean_dt, "%Y%m%d", &tm)) {
         
-        tm.tm_isdst = -1;  // Let mktime determine DST
-        return mktime(&tm);
+        tm.tm_isdst = -1;  // Let the zone determine DST
+        return time_service_mktime(&tm);
     }
     
     return 0;
 }
 
-// Extract datetime from DTSTART or DTEND line with bounds checking
-static time_t extract_datetime_from_line(const char* field_name, const char* event_block) {
-    if (!field_name || !event_block) {
-        return 0;
-    }
-    
-    char *field_line = strstr(event_block, field_name);
-    if (!field_line) {
-        return 0;
-    }
-    
-    // Find the end of the field line
-    char *line_end = strchr(field_line, '\n');
-    if (!line_end) {
-        return 0;
-    }
-    
-    // Find the last colon within this line only
-    char *colon = NULL;
-    for (char *p = field_line; p < line_end; p++) {
-        if (*p == ':') {
-            colon = p;
-        }
-    }
-    
-    if (!colon) {
-        return 0;
-    }
-    
-    int len = line_end - colon - 1;
-    if (len <= 0 || len >= MAX_BUFFER_SIZE - 1) {
-        return 0;
-    }
-    
-    char buffer[MAX_BUFFER_SIZE];
-    strncpy(buffer, colon + 1, len);
-    buffer[len] = '\0';
-    
-    return parse_ical_datetime(buffer);
-}
-
-// Clean iCal escape sequences in-place
-static void clean_ical_escapes(char *str) {
-    char *src = str, *dst = str;
-    while (*src) {
-        if (*src == '\\' && *(src + 1) == 'n') {
-            *dst++ = ' ';
-            src += 2;
-        } else if (*src == '\\' && *(src + 1) == ',') {
-            *dst++ = ',';
-            src += 2;
-        } else if (*src == '\r') {
-            // Skip carriage return
-            src++;
-        } else {
-            *dst++ = *src++;
-        }
-    }
-    *dst = '\0';
-}
-
-// Extract field from iCal event block with input validation
-static int extract_ical_field(const char* event_block, const char* field, char* result, size_t result_size) {
-    if (!event_block || !field || !result || result_size == 0) {
-        return -1;
-    }
-    
-    char search_pattern[64];
-    int pattern_len = snprintf(search_pattern, sizeof(search_pattern), "%s:", field);
-    if (pattern_len >= (int)sizeof(search_pattern)) {
-        return -1;
-    }
-    
-    char *field_start = strstr(event_block, search_pattern);
-    if (!field_start) {
-        return -1;
-    }
-    
-    // Move past the field name and colon
-    field_start += pattern_len;
-    
-    // Find the end of the line
-    char *field_end = strchr(field_start, '\n');
-    if (!field_end) {
-        field_end = field_start + strlen(field_start);
-    }
-    
-    // Calculate length with bounds checking
-    int len = field_end - field_start;
-    if (len <= 0 || (size_t)len >= result_size - 1) {
-        return -1;
-    }
-    
-    // Copy the field value
-    strncpy(result, field_start, len);
-    result[len] = '\0';
-    
-    // Clean up escape sequences
-    clean_ical_escapes(result);
-    
-    return 0;
-}
-
 // Sort events by start time using insertion sort (efficient for small arrays)
 static void sort_events_by_start_time(CalendarEvent *events, int count) {
     for (int i = 1; i < count; i++) {
@@ -213,18 +206,10 @@ static void sort_events_by_start_time(CalendarEvent *events, int count) {
     }
 }
 
-// Validate calendar data structure
-static int validate_calendar_data(CalendarData *data) {
-    if (!data || !data->today.events || !data->tomorrow.events) {
-        return -1;
-    }
-    return 0;
-}
-
 // Handle multi-day event creation for today and tomorrow
 static void create_multiday_events(CalendarData *data, int max_events_per_day,
                                    const CalendarEvent *base_event, int start_date, int end_date,
-                                   int today_date, int tomorrow_date) {
+                                   int today_date, int tomorrow_date, time_t window_start) {
     if (!data || !base_event) {
         return;
     }
@@ -232,15 +217,21 @@ static void create_multiday_events(CalendarData *data, int max_events_per_day,
     time_t current_day = base_event->start;
     const time_t day_seconds = 24 * 60 * 60;
     
+    // Long events: jump to the day before the window instead of walking from the start
+    if (window_start - current_day > 2 * day_seconds) {
+        current_day += ((window_start - current_day) / day_seconds - 1) * day_seconds;
+    }
+    
     while (current_day < base_event->end + day_seconds) {
         int current_date = time_to_date_int(current_day);
         
-        // Break if we've passed the end date
-        if (current_date > end_date) break;
+        // Break if we've passed the end date or the requested window
+        if (current_date > end_date || current_date > tomorrow_date) break;
         
         // Only create event if it's for today or tomorrow
         if (current_date == today_date || current_date == tomorrow_date) {
-            struct tm *current_tm = localtime(&current_day);
+            struct tm current_buf;
+            struct tm *current_tm = time_service_local(current_day, &current_buf);
             if (!current_tm) break;
             
             CalendarEvent daily_event = *base_event;
@@ -274,63 +265,16 @@ static void create_multiday_events(CalendarData *data, int max_events_per_day,
     }
 }
 
-// Parse single iCal event
-static CalendarEvent parse_ical_event(const char* event_block) {
-    CalendarEvent event = {0};
-    char buffer[MAX_BUFFER_SIZE];
-    
-    // Extract title (SUMMARY)
-    if (extract_ical_field(event_block, "SUMMARY", buffer, sizeof(buffer)) == 0) {
-        strncpy(event.title, buffer, sizeof(event.title) - 1);
-        event.title[sizeof(event.title) - 1] = '\0';
-    }
-
-    // Extract start date (DTSTART) - handle timezone format properly
-    event.start = extract_datetime_from_line("DTSTART", event_block);
-    
-    // Extract end date (DTEND) - handle timezone format properly
-    event.end = extract_datetime_from_line("DTEND", event_block);
-    if (event.end == 0 || event.end < event.start) {
-        // If no DTEND or DTEND before DTSTART, use DTSTART as end
-        event.end = event.start;
-    }
-
-    if (is_all_day_event(strstr(event_block, "DTSTART"))) {
-        event.event_type = EVENT_TYPE_ALL_DAY;
-        event.start = get_start_of_day(localtime(&event.start));
-        event.end = get_end_of_day(localtime(&event.start));
-    }
-
-    return event;
-}
-
-// Process a single event block and add relevant events to the array
-static void process_event_block(const CalendarEvent *event, CalendarData *data, 
-                               int max_events_per_day, const struct tm *today_tm, 
-                               const struct tm *tomorrow_tm) {
-    // Input validation
-    if (!event || !data || !today_tm || !tomorrow_tm) {
-        return;
-    }
-    
-    // Skip events without title or start time
-    if (strlen(event->title) == 0 || event->start == 0) {
-        return;
-    }
-    
-    // Pre-calculate dates to avoid repeated mktime calls
-    struct tm today_copy = *today_tm;
-    struct tm tomorrow_copy = *tomorrow_tm;
-    int today_date = time_to_date_int(mktime(&today_copy));
-    int tomorrow_date = time_to_date_int(mktime(&tomorrow_copy));
-    
+// Add the today/tomorrow occurrences of one event to the output arrays
+static void add_event_to_days(const CalendarEvent *event, CalendarData *data, int max_events_per_day,
+                              int today_date, int tomorrow_date, time_t window_start) {
     int start_date = time_to_date_int(event->start);
     int end_date = time_to_date_int(event->end);
     
     if (start_date != end_date) {
         // Multi-day event - create separate events for each day
         create_multiday_events(data, max_events_per_day, event, 
-                              start_date, end_date, today_date, tomorrow_date);
+                              start_date, end_date, today_date, tomorrow_date, window_start);
     } else {
         // Single day event
         if (start_date == today_date && data->today.count < max_events_per_day) {
@@ -346,90 +290,786 @@ static void process_event_block(const CalendarEvent *event, CalendarData *data,
     }
 }
 
-// Internal function to get raw events from calendar for a specific date
-static int get_raw_calendar_events(CalendarClient *client, CalendarData *data, char* ical_data, int max_events_per_day, time_t date) {
-    // Input validation
-    if (!client || !data || !ical_data) {
+// ====================== EVENT INDEX ======================
+
+static void event_index_free(EventIndex *index) {
+    if (!index) return;
+    free(index->events);
+    free(index->max_end);
+    free(index->titles);
+    free(index->title_slots);
+    free(index->series);
+    free(index->exclusions);
+    free(index->overrides);
+    for (int i = 0; i < EXPANSION_CACHE_DAYS; i++) {
+        free(index->expansions[i].events);
+    }
+    memset(index, 0, sizeof(EventIndex));
+}
+
+// Empty the index for the next feed; every array keeps its capacity
+static void event_index_reset(EventIndex *index) {
+    index->count = 0;
+    index->series_count = 0;
+    index->series_max_days = 0;
+    index->unsupported_rules = 0;
+    index->exclusion_count = 0;
+    index->override_count = 0;
+    for (int i = 0; i < EXPANSION_CACHE_DAYS; i++) {
+        index->expansions[i].used = 0;
+        index->expansions[i].count = 0;
+    }
+    index->expansion_clock = 0;
+    index->titles_size = 0;
+    index->unique_titles = 0;
+    if (index->title_slots) {
+        memset(index->title_slots, 0xFF, index->slot_capacity * sizeof(uint32_t));
+    }
+}
+
+// FNV-1a hash for title interning
+static uint32_t hash_title(const char *title) {
+    uint32_t hash = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)title; *p; p++) {
+        hash = (hash ^ *p) * 16777619u;
+    }
+    return hash;
+}
+
+// Insert a pool offset into the open-addressing title table
+static void title_slot_insert(EventIndex *index, uint32_t offset) {
+    size_t mask = index->slot_capacity - 1;
+    size_t i = hash_title(index->titles + offset) & mask;
+    while (index->title_slots[i] != TITLE_SLOT_EMPTY) {
+        i = (i + 1) & mask;
+    }
+    index->title_slots[i] = offset;
+}
+
+/**
+ * Intern a title in the pool (recurring events share one copy)
+ * Returns: pool offset, or TITLE_SLOT_EMPTY on allocation failure
+ */
+static uint32_t intern_title(EventIndex *index, const char *title) {
+    // Keep the table at most half full
+    if ((size_t)(index->unique_titles + 1) * 2 > index->slot_capacity) {
+        size_t capacity = index->slot_capacity ? index->slot_capacity * 2 : 256;
+        uint32_t *slots = malloc(capacity * sizeof(uint32_t));
+        if (!slots) return TITLE_SLOT_EMPTY;
+        
+        uint32_t *old_slots = index->title_slots;
+        size_t old_capacity = index->slot_capacity;
+        memset(slots, 0xFF, capacity * sizeof(uint32_t));
+        index->title_slots = slots;
+        index->slot_capacity = capacity;
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old_slots[i] != TITLE_SLOT_EMPTY) {
+                title_slot_insert(index, old_slots[i]);
+            }
+        }
+        free(old_slots);
+    }
+    
+    size_t mask = index->slot_capacity - 1;
+    size_t i = hash_title(title) & mask;
+    while (index->title_slots[i] != TITLE_SLOT_EMPTY) {
+        if (strcmp(index->titles + index->title_slots[i], title) == 0) {
+            return index->title_slots[i];
+        }
+        i = (i + 1) & mask;
+    }
+    
+    // New title: append to the pool
+    size_t len = strlen(title) + 1;
+    if (index->titles_size + len > index->titles_capacity) {
+        size_t capacity = index->titles_capacity ? index->titles_capacity : 4096;
+        while (capacity < index->titles_size + len) capacity *= 2;
+        char *titles = realloc(index->titles, capacity);
+        if (!titles) return TITLE_SLOT_EMPTY;
+        index->titles = titles;
+        index->titles_capacity = capacity;
+    }
+    
+    uint32_t offset = (uint32_t)index->titles_size;
+    memcpy(index->titles + offset, title, len);
+    index->titles_size += len;
+    index->title_slots[i] = offset;
+    index->unique_titles++;
+    return offset;
+}
+
+// Append one parsed event to the index (unsorted until event_index_finalize)
+static int event_index_add(EventIndex *index, const CalendarEvent *event) {
+    if (index->count == index->capacity) {
+        int capacity = index->capacity ? index->capacity * 2 : 256;
+        IndexedEvent *events = realloc(index->events, capacity * sizeof(IndexedEvent));
+        if (!events) return -1;
+        index->events = events;
+        index->capacity = capacity;
+    }
+    
+    uint32_t title = intern_title(index, event->title);
+    if (title == TITLE_SLOT_EMPTY) return -1;
+    
+    IndexedEvent *entry = &index->events[index->count];
+    entry->start = event->start;
+    entry->end = event->end;
+    entry->title = title;
+    entry->order = index->count;
+    entry->event_type = event->event_type;
+    index->count++;
+    return 0;
+}
+
+// Grow a dynamic array to hold one more element
+static int ensure_capacity(void **items, int *capacity, int count, size_t item_size) {
+    if (count < *capacity) return 0;
+    int new_capacity = *capacity ? *capacity * 2 : 64;
+    void *grown = realloc(*items, (size_t)new_capacity * item_size);
+    if (!grown) return -1;
+    *items = grown;
+    *capacity = new_capacity;
+    return 0;
+}
+
+// Local civil day number of a timestamp
+static int local_day_number(time_t timestamp) {
+    return time_service_local_day(timestamp);
+}
+
+/**
+ * Store a recurring master and its EXDATEs; occurrences are expanded lazily per day
+ * Returns: 0 on success, -1 on allocation failure
+ */
+static int event_index_add_series(EventIndex *index, const CalendarEvent *event, const RecurrenceRule *rule,
+                                  const char *uid, const time_t *exdates, int exdate_count) {
+    if (ensure_capacity((void **)&index->series, &index->series_capacity,
+                        index->series_count, sizeof(RecurringSeries)) != 0) {
         return -1;
     }
     
-    if (validate_calendar_data(data) != 0) {
+    RecurringSeries *series = &index->series[index->series_count];
+    series->rule = *rule;
+    series->title = intern_title(index, event->title);
+    series->uid = uid[0] ? intern_title(index, uid) : TITLE_SLOT_EMPTY;
+    if (series->title == TITLE_SLOT_EMPTY || (uid[0] && series->uid == TITLE_SLOT_EMPTY)) {
         return -1;
     }
     
-    // Get today's date
-    struct tm *now_tm = localtime(&date);
-    struct tm today_tm = *now_tm;
+    struct tm start_buf;
+    struct tm *start_tm = time_service_local(event->start, &start_buf);
+    if (!start_tm) return -1;
+    series->first_day = recurrence_day_from_civil(start_tm->tm_year + 1900, start_tm->tm_mon + 1, start_tm->tm_mday);
+    series->start_seconds = start_tm->tm_hour * 3600 + start_tm->tm_min * 60 + start_tm->tm_sec;
+    series->duration = event->end - event->start;
+    series->event_type = event->event_type;
     
-    // Calculate tomorrow's date properly
-    struct tm tomorrow_tm = today_tm;
-    tomorrow_tm.tm_mday += 1;
-    tomorrow_tm.tm_isdst = -1;
-    mktime(&tomorrow_tm); // Normalize the date (handles month/year boundaries)
+    series->last_day = recurrence_last_day(rule, series->first_day);
+    series->until = rule->until[0] ? parse_ical_datetime(rule->until) : 0;
+    if (series->until) {
+        int until_day = local_day_number(series->until);
+        if (until_day < series->last_day) series->last_day = until_day;
+    }
     
-    // Find event blocks
-    char *event_start = strstr(ical_data, "BEGIN:VEVENT");
+    int duration_days = (int)(series->duration / (24 * 60 * 60)) + 1;
+    if (duration_days > index->series_max_days) index->series_max_days = duration_days;
     
-    while (event_start && (data->today.count < max_events_per_day || data->tomorrow.count < max_events_per_day)) {
-        char *event_end = strstr(event_start, "END:VEVENT");
-        if (!event_end) break;
+    for (int i = 0; i < exdate_count; i++) {
+        if (ensure_capacity((void **)&index->exclusions, &index->exclusion_capacity,
+                            index->exclusion_count, sizeof(SeriesExclusion)) != 0) {
+            return -1;
+        }
+        index->exclusions[index->exclusion_count].series = index->series_count;
+        index->exclusions[index->exclusion_count].start = exdates[i];
+        index->exclusion_count++;
+    }
+    
+    index->series_count++;
+    return 0;
+}
+
+// Remember a RECURRENCE-ID override so the occurrence it replaces can be excluded
+static int event_index_add_override(EventIndex *index, const char *uid, time_t recurrence_id) {
+    uint32_t interned = intern_title(index, uid);
+    if (interned == TITLE_SLOT_EMPTY) return -1;
+    if (ensure_capacity((void **)&index->overrides, &index->override_capacity,
+                        index->override_count, sizeof(PendingOverride)) != 0) {
+        return -1;
+    }
+    index->overrides[index->override_count].uid = interned;
+    index->overrides[index->override_count].start = recurrence_id;
+    index->override_count++;
+    return 0;
+}
 
-        // Extract event block
-        size_t block_size = event_end - event_start;
-        char *event_block = malloc(block_size + 1);
-        if (!event_block) {
-            return -1; // Memory allocation failed
+static int compare_exclusions(const void *a, const void *b) {
+    const SeriesExclusion *ea = (const SeriesExclusion *)a;
+    const SeriesExclusion *eb = (const SeriesExclusion *)b;
+    if (ea->series != eb->series) return (ea->series < eb->series) ? -1 : 1;
+    return (ea->start < eb->start) ? -1 : (ea->start > eb->start);
+}
+
+/**
+ * Turn RECURRENCE-ID overrides into exclusions of their master and sort all exclusions
+ * UIDs are interned, so matching compares pool offsets.
+ * Returns: 0 on success, -1 on allocation failure
+ */
+static int resolve_series_exclusions(EventIndex *index) {
+    for (int i = 0; i < index->override_count; i++) {
+        const PendingOverride *override = &index->overrides[i];
+        for (int s = 0; s < index->series_count; s++) {
+            if (index->series[s].uid != override->uid) continue;
+            if (ensure_capacity((void **)&index->exclusions, &index->exclusion_capacity,
+                                index->exclusion_count, sizeof(SeriesExclusion)) != 0) {
+                return -1;
+            }
+            index->exclusions[index->exclusion_count].series = s;
+            index->exclusions[index->exclusion_count].start = override->start;
+            index->exclusion_count++;
         }
+    }
+    
+    index->override_count = 0;  // Array kept for the next feed
     
-        strncpy(event_block, event_start, block_size);
-        event_block[block_size] = '\0';
+    if (index->exclusion_count > 0) {
+        qsort(index->exclusions, index->exclusion_count, sizeof(SeriesExclusion), compare_exclusions);
+    }
+    return 0;
+}
 
-        // Parse event
-        CalendarEvent parsed_event_block = parse_ical_event(event_block);
+// Sort by start (feed order breaks ties, as the former stable sort did)
+static int compare_indexed_events(const void *a, const void *b) {
+    const IndexedEvent *ea = (const IndexedEvent *)a;
+    const IndexedEvent *eb = (const IndexedEvent *)b;
+    if (ea->start != eb->start) return (ea->start < eb->start) ? -1 : 1;
+    return (ea->order < eb->order) ? -1 : (ea->order > eb->order);
+}
 
-        // Process the event block using helper function
-        process_event_block(&parsed_event_block, data, max_events_per_day, &today_tm, &tomorrow_tm);
-        
-        // Find next event
-        free(event_block);
-        event_start = strstr(event_end, "BEGIN:VEVENT");
+/**
+ * Sort the index and build the running maximum of end times used by range queries
+ * Returns: 0 on success, -1 on allocation failure
+ */
+static int event_index_finalize(EventIndex *index) {
+    if (index->count > 0) {
+        qsort(index->events, index->count, sizeof(IndexedEvent), compare_indexed_events);
     }
     
-    // Sort data by start time
-    sort_events_by_start_time(data->today.events, data->today.count);
-    sort_events_by_start_time(data->tomorrow.events, data->tomorrow.count);
+    if (index->max_end_capacity < index->capacity || !index->max_end) {
+        int capacity = index->capacity > 0 ? index->capacity : 1;
+        time_t *max_end = realloc(index->max_end, capacity * sizeof(time_t));
+        if (!max_end) return -1;
+        index->max_end = max_end;
+        index->max_end_capacity = capacity;
+    }
+    
+    if (resolve_series_exclusions(index) != 0) return -1;
+    
+    time_t running = 0;
+    for (int i = 0; i < index->count; i++) {
+        if (i == 0 || index->events[i].end > running) running = index->events[i].end;
+        index->max_end[i] = running;
+    }
+    return 0;
+}
 
+// ====================== RECURRENCE EXPANSION ======================
+
+static int is_excluded(const EventIndex *index, int series, time_t start) {
+    SeriesExclusion key = { series, start };
+    return bsearch(&key, index->exclusions, index->exclusion_count,
+                   sizeof(SeriesExclusion), compare_exclusions) != NULL;
+}
+
+// Expand every series on one day into slot (cost: one rule check per series)
+static int expand_day(EventIndex *index, int day, ExpansionDay *slot) {
+    slot->count = 0;
+    
+    for (int s = 0; s < index->series_count; s++) {
+        const RecurringSeries *series = &index->series[s];
+        if (day < series->first_day || day > series->last_day) continue;
+        if (!recurrence_occurs_on(&series->rule, series->first_day, day)) continue;
+        
+        // Local wall-clock time on that day (DST resolved per occurrence)
+        time_t start = time_service_make_local(day, series->start_seconds);
+        
+        if (series->until && start > series->until) continue;
+        if (is_excluded(index, s, start)) continue;
+        
+        if (ensure_capacity((void **)&slot->events, &slot->capacity, slot->count, sizeof(IndexedEvent)) != 0) {
+            return -1;
+        }
+        IndexedEvent *occurrence = &slot->events[slot->count++];
+        occurrence->start = start;
+        occurrence->end = (series->event_type == EVENT_TYPE_ALL_DAY) ?
+                          time_service_make_local(day, END_OF_DAY_SECONDS) : start + series->duration;
+        occurrence->title = series->title;
+        occurrence->order = s;
+        occurrence->event_type = series->event_type;
+    }
     return 0;
 }
 
-// Get processed calendar events for a specific date
-int get_calendar_events_data(CalendarClient *client, CalendarData *data, time_t date) {
-    if (!client || !data) return -1;
+// Cached expansion of one day (least recently used slot is recycled on a miss)
+static const ExpansionDay* expansion_for_day(EventIndex *index, int day) {
+    ExpansionDay *victim = &index->expansions[0];
+    index->expansion_clock++;
+    
+    for (int i = 0; i < EXPANSION_CACHE_DAYS; i++) {
+        ExpansionDay *slot = &index->expansions[i];
+        if (slot->used && slot->day == day) {
+            slot->last_used = index->expansion_clock;
+            return slot;
+        }
+        if (!slot->used || (victim->used && slot->last_used < victim->last_used)) {
+            victim = slot;
+        }
+    }
+    
+    victim->used = 0;
+    if (expand_day(index, day, victim) != 0) {
+        return NULL;
+    }
+    victim->day = day;
+    victim->used = 1;
+    victim->last_used = index->expansion_clock;
+    return victim;
+}
+
+/**
+ * Add recurring occurrences overlapping [window_start, window_end] to data
+ * Only the window days (plus the longest series duration as look-back) are expanded,
+ * so the cost depends on the window, not on how long the series runs.
+ */
+static void expand_series_window(EventIndex *index, CalendarData *data, int max_events_per_day,
+                                 time_t window_start, time_t window_end,
+                                 int today_date, int tomorrow_date) {
+    if (index->series_count == 0) return;
+    
+    int first_day = local_day_number(window_start) - index->series_max_days;
+    int last_day = local_day_number(window_end);
+    
+    for (int day = first_day; day <= last_day; day++) {
+        const ExpansionDay *expansion = expansion_for_day(index, day);
+        if (!expansion) {
+            LOG_ERROR("❌ Out of memory while expanding recurring events");
+            return;
+        }
+        
+        for (int i = 0; i < expansion->count; i++) {
+            const IndexedEvent *entry = &expansion->events[i];
+            if (entry->end < window_start || entry->start > window_end) continue;
+            
+            CalendarEvent event;
+            event.title = index->titles + entry->title; // Moved to the data arena once selected
+            event.start = entry->start;
+            event.end = entry->end;
+            event.event_type = (EventType)entry->event_type;
+            
+            add_event_to_days(&event, data, max_events_per_day, today_date, tomorrow_date, window_start);
+        }
+    }
+}
+
+// ====================== WINDOW QUERY ======================
+
+/**
+ * Collect events overlapping [window_start, window_end] into data
+ * Candidates are the events starting before window_end whose running max end
+ * reaches window_start; both bounds are found by binary search.
+ */
+static void event_index_query(EventIndex *index, CalendarData *data, int max_events_per_day,
+                              time_t window_start, time_t window_end,
+                              int today_date, int tomorrow_date) {
+    // First event starting after the window
+    int lo = 0, hi = index->count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (index->events[mid].start <= window_end) lo = mid + 1; else hi = mid;
+    }
+    int last = lo;
+    
+    // First event whose running max end reaches the window (max_end is non-decreasing)
+    lo = 0; hi = last;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (index->max_end[mid] < window_start) lo = mid + 1; else hi = mid;
+    }
+    
+    for (int i = lo; i < last; i++) {
+        const IndexedEvent *entry = &index->events[i];
+        if (entry->end < window_start) continue;
+        
+        CalendarEvent event;
+        event.title = index->titles + entry->title; // Moved to the data arena once selected
+        event.start = entry->start;
+        event.end = entry->end;
+        event.event_type = (EventType)entry->event_type;
+        
+        add_event_to_days(&event, data, max_events_per_day, today_date, tomorrow_date, window_start);
+    }
+    
+    expand_series_window(index, data, max_events_per_day, window_start, window_end, today_date, tomorrow_date);
+}
+
+// ====================== STREAMING PARSE ======================
+
+// State threaded through the iCal tokenizer callbacks
+typedef struct {
+    EventIndex *index;
+    int in_event;             // Inside a VEVENT (nested VALARM properties are ignored)
+    int all_day;              // DTSTART had VALUE=DATE
+    int failed;               // Allocation failure while indexing
+    CalendarEvent current;    // current.title points at title
+    char title[MAX_EVENT_TITLE_LENGTH];
+    char rrule[512];          // Raw RRULE value ("" = single event)
+    char uid[256];
+    time_t recurrence_id;     // RECURRENCE-ID of an override instance (0 = none)
+    time_t exdates[MAX_EXDATES_PER_EVENT];
+    int exdate_count;
+} CalendarParseContext;
 
-    // Initialize the structure
-    data->today.events = malloc(MAX_EVENTS_PER_DAY * sizeof(CalendarEvent));
-    data->tomorrow.events = malloc(MAX_EVENTS_PER_DAY * sizeof(CalendarEvent));
+static void on_ical_begin(const char *component, void *user_data) {
+    CalendarParseContext *ctx = (CalendarParseContext *)user_data;
+    if (strcmp(component, "VEVENT") == 0) {
+        memset(&ctx->current, 0, sizeof(ctx->current));
+        ctx->title[0] = '\0';
+        ctx->current.title = ctx->title;
+        ctx->all_day = 0;
+        ctx->rrule[0] = '\0';
+        ctx->uid[0] = '\0';
+        ctx->recurrence_id = 0;
+        ctx->exdate_count = 0;
+        ctx->in_event = 1;
+    }
+}
+
+static void on_ical_property(const IcalProperty *property, void *user_data) {
+    CalendarParseContext *ctx = (CalendarParseContext *)user_data;
+    if (!ctx->in_event || strcmp(property->component, "VEVENT") != 0) {
+        return;
+    }
+    
+    if (strcmp(property->name, "SUMMARY") == 0) {
+        strncpy(ctx->title, property->value, sizeof(ctx->title) - 1);
+        ctx->title[sizeof(ctx->title) - 1] = '\0';
+        ical_unescape_text(ctx->title);
+    } else if (strcmp(property->name, "DTSTART") == 0) {
+        char value_type[16];
+        ctx->current.start = parse_ical_datetime(property->value);
+        ctx->all_day = ical_param_value(property->params, "VALUE", value_type, sizeof(value_type)) &&
+                       strcmp(value_type, "DATE") == 0;
+    } else if (strcmp(property->name, "DTEND") == 0) {
+        ctx->current.end = parse_ical_datetime(property->value);
+    } else if (strcmp(property->name, "RRULE") == 0) {
+        strncpy(ctx->rrule, property->value, sizeof(ctx->rrule) - 1);
+        ctx->rrule[sizeof(ctx->rrule) - 1] = '\0';
+    } else if (strcmp(property->name, "UID") == 0) {
+        strncpy(ctx->uid, property->value, sizeof(ctx->uid) - 1);
+        ctx->uid[sizeof(ctx->uid) - 1] = '\0';
+    } else if (strcmp(property->name, "RECURRENCE-ID") == 0) {
+        ctx->recurrence_id = parse_ical_datetime(property->value);
+    } else if (strcmp(property->name, "EXDATE") == 0) {
+        // EXDATE may list several comma-separated values and appear several times
+        const char *value = property->value;
+        while (*value && ctx->exdate_count < MAX_EXDATES_PER_EVENT) {
+            char date[64];
+            size_t length = strcspn(value, ",");
+            if (length >= sizeof(date)) length = sizeof(date) - 1;
+            memcpy(date, value, length);
+            date[length] = '\0';
+            
+            time_t excluded = parse_ical_datetime(date);
+            if (excluded) ctx->exdates[ctx->exdate_count++] = excluded;
+            
+            value += strcspn(value, ",");
+            if (*value == ',') value++;
+        }
+    }
+}
+
+static void on_ical_end(const char *component, void *user_data) {
+    CalendarParseContext *ctx = (CalendarParseContext *)user_data;
+    if (!ctx->in_event || strcmp(component, "VEVENT") != 0) {
+        return;
+    }
+    ctx->in_event = 0;
+    
+    CalendarEvent *event = &ctx->current;
+    
+    // Skip events without title or start time
+    if (event->title[0] == '\0' || event->start == 0) {
+        return;
+    }
+    
+    if (event->end == 0 || event->end < event->start) {
+        // If no DTEND or DTEND before DTSTART, use DTSTART as end
+        event->end = event->start;
+    }
+    
+    if (ctx->all_day) {
+        event->event_type = EVENT_TYPE_ALL_DAY;
+        int day = time_service_local_day(event->start);
+        event->start = time_service_make_local(day, 0);
+        event->end = time_service_make_local(day, END_OF_DAY_SECONDS);
+    }
+    
+    // Override instance: hide the occurrence it replaces, then index it as a normal event
+    if (ctx->recurrence_id && ctx->uid[0] &&
+        event_index_add_override(ctx->index, ctx->uid, ctx->recurrence_id) != 0) {
+        ctx->failed = 1;
+        return;
+    }
+    
+    if (ctx->rrule[0] && !ctx->recurrence_id) {
+        RecurrenceRule rule;
+        if (recurrence_parse(ctx->rrule, &rule) == 0) {
+            if (event_index_add_series(ctx->index, event, &rule, ctx->uid, ctx->exdates, ctx->exdate_count) != 0) {
+                ctx->failed = 1;
+            }
+            return;
+        }
+        // Unsupported rule: keep the first occurrence as before
+        LOG_DEBUG("📅 Unsupported RRULE for '%s': %s", event->title, ctx->rrule);
+        ctx->index->unsupported_rules++;
+    }
+    
+    if (event_index_add(ctx->index, event) != 0) {
+        ctx->failed = 1;
+    }
+}
+
+// Tokenizer fed by the download, with the time spent parsing (excluding network waits)
+typedef struct {
+    IcalParser *parser;
+    uint64_t parse_ns;
+} IcalStream;
+
+// curl write callback target: feed each received chunk straight into the tokenizer
+static int feed_ical_chunk(const char *chunk, size_t length, void *user_data) {
+    IcalStream *stream = (IcalStream *)user_data;
+    uint64_t started = metrics_start();
+    int result = ical_parser_feed(stream->parser, chunk, length);
+    stream->parse_ns += metrics_start() - started;
+    return result;
+}
+
+/**
+ * Download the feed (conditionally) and rebuild the event index while it streams in
+ * The new index is built in the spare one and swapped in once complete, so both keep
+ * their arrays from one feed to the next.
+ * Returns: HTTP_RESULT_OK, HTTP_RESULT_NOT_MODIFIED or HTTP_RESULT_ERROR
+ */
+static int refresh_event_index(CalendarClient *client) {
+    EventIndex *fresh = &client->spare;
+    event_index_reset(fresh);
+    
+    CalendarParseContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.index = fresh;
+    
+    IcalCallbacks callbacks = { on_ical_begin, on_ical_end, on_ical_property };
+    if (client->parser) {
+        ical_parser_reset(client->parser, &ctx);
+    } else if (!(client->parser = ical_parser_create(&callbacks, &ctx))) {
+        return HTTP_RESULT_ERROR;
+    }
+    IcalParser *parser = client->parser;
+    
+    // Validators cover the whole feed, so they stay valid across date changes
+    const HttpValidators *validators = client->index_valid ? &client->validators : NULL;
+    
+    HttpResponse response;
+    IcalStream stream = { parser, 0 };
+    uint64_t started = metrics_start();
+    int fetch = http_get_stream(client->ical_url, validators, &response, feed_ical_chunk, &stream);
+    metrics_observe(METRIC_FETCH_CALENDAR, started);
+    if (fetch == HTTP_RESULT_OK) {
+        uint64_t finish_started = metrics_start();
+        ical_parser_finish(parser);
+        stream.parse_ns += metrics_start() - finish_started;
+        metrics_observe_ns(METRIC_PARSE_CALENDAR, stream.parse_ns);
+        
+        if (ctx.failed || event_index_finalize(fresh) != 0) {
+            LOG_ERROR("❌ Out of memory while indexing calendar events");
+            fetch = HTTP_RESULT_ERROR;
+        } else {
+            EventIndex previous = client->index;
+            client->index = *fresh;
+            *fresh = previous;
+            client->index_valid = 1;
+            client->validators = response.validators;
+            
+            LOG_DEBUG("📅 Indexed %d events and %d recurring series from iCal stream "
+                      "(%d exclusions, %d unsupported rules, %d unique strings, %zu bytes, %d truncated lines)",
+                      client->index.count, client->index.series_count, client->index.exclusion_count,
+                      client->index.unsupported_rules, client->index.unique_titles, client->index.titles_size,
+                      ical_parser_truncated_lines(parser));
+        }
+    }
+    
+    http_response_free(&response);
+    return fetch;
+}
+
+// ====================== DATA BUFFERS ======================
+
+static int alloc_event_arrays(CalendarData *data) {
+    size_t capacity;
+    memset(data, 0, sizeof(CalendarData));
+    data->today.events = buffer_pool_acquire(&calendar_event_pool, CALENDAR_EVENTS_SIZE, &capacity);
+    data->tomorrow.events = buffer_pool_acquire(&calendar_event_pool, CALENDAR_EVENTS_SIZE, &capacity);
     if (!data->today.events || !data->tomorrow.events) {
-        // Clean up on allocation failure
-        free(data->today.events);
-        free(data->tomorrow.events);
+        calendar_data_free(data);
+        return -1;
+    }
+    return 0;
+}
+
+int calendar_data_alloc(CalendarData *data, size_t titles_size) {
+    if (!data || alloc_event_arrays(data) != 0) {
+        return -1;
+    }
+    data->titles = buffer_pool_acquire(&calendar_title_pool, titles_size, &data->titles_capacity);
+    if (!data->titles) {
+        calendar_data_free(data);
+        return -1;
+    }
+    return 0;
+}
+
+void calendar_cleanup(void) {
+    buffer_pool_drain(&calendar_event_pool);
+    buffer_pool_drain(&calendar_title_pool);
+}
+
+/**
+ * Copy the titles of the selected events into one arena owned by data
+ * Occurrences sharing an interned title (recurring series, multi-day events) share one copy.
+ * Returns: 0 on success, -1 on failure
+ */
+static int copy_titles_to_arena(CalendarData *data) {
+    DayEvents *days[2] = { &data->today, &data->tomorrow };
+    size_t size = 1;
+    for (int d = 0; d < 2; d++) {
+        for (int i = 0; i < days[d]->count; i++) {
+            size += strlen(days[d]->events[i].title) + 1;
+        }
+    }
+    
+    data->titles = buffer_pool_acquire(&calendar_title_pool, size, &data->titles_capacity);
+    if (!data->titles) {
         return -1;
     }
     
-    data->today.count = 0;
-    data->tomorrow.count = 0;
+    const char *sources[2 * MAX_EVENTS_PER_DAY];
+    const char *copies[2 * MAX_EVENTS_PER_DAY];
+    int copied = 0;
+    size_t used = 0;
+    for (int d = 0; d < 2; d++) {
+        for (int i = 0; i < days[d]->count; i++) {
+            CalendarEvent *event = &days[d]->events[i];
+            int j = 0;
+            while (j < copied && sources[j] != event->title) j++;
+            
+            if (j == copied) {
+                size_t length = strlen(event->title) + 1;
+                memcpy(data->titles + used, event->title, length);
+                sources[copied] = event->title;
+                copies[copied++] = data->titles + used;
+                used += length;
+            }
+            event->title = copies[j];
+        }
+    }
+    return 0;
+}
 
-    char *ical_data = http_get(client->ical_url);
-    if (!ical_data) {
-        LOG_ERROR("❌ Error retrieving iCal");
+/**
+ * Fill data with today/tomorrow events for date from the in-memory index (no network)
+ * Returns: 0 on success, -1 on failure
+ */
+static int build_calendar_window(CalendarClient *client, CalendarData *data, time_t date) {
+    struct tm today_tm;
+    if (!time_service_local(date, &today_tm)) {
+        return -1;
+    }
+    
+    // Calculate tomorrow's date (month/year overflow is normalized by time_service_mktime)
+    struct tm tomorrow_tm = today_tm;
+    tomorrow_tm.tm_mday += 1;
+    tomorrow_tm.tm_isdst = -1;
+    
+    time_t window_start = get_start_of_day(&today_tm);
+    time_t window_end = get_end_of_day(&tomorrow_tm);
+    int today_date = time_to_date_int(window_start);
+    int tomorrow_date = time_to_date_int(window_end);
+    
+    // Pooled event arrays; the title arena follows once the titles are known
+    if (alloc_event_arrays(data) != 0) {
+        return -1;
+    }
+    
+    event_index_query(&client->index, data, MAX_EVENTS_PER_DAY, window_start, window_end,
+                      today_date, tomorrow_date);
+    
+    // Sort data by start time (multi-day occurrences are clamped to the day)
+    sort_events_by_start_time(data->today.events, data->today.count);
+    sort_events_by_start_time(data->tomorrow.events, data->tomorrow.count);
+    
+    // Titles still point into the index, which the next feed replaces
+    if (copy_titles_to_arena(data) != 0) {
         calendar_data_free(data);
         return -1;
     }
+    return 0;
+}
+
+int refresh_calendar_index(CalendarClient *client) {
+    if (!client) return -1;
     
-    int result = get_raw_calendar_events(client, data, ical_data, MAX_EVENTS_PER_DAY, date);
-    free(ical_data);  // Free ical_data here after processing
+    int fetch = refresh_event_index(client);
+    if (fetch == HTTP_RESULT_ERROR) {
+        LOG_ERROR(client->index_valid ? "❌ Error retrieving iCal, keeping the last indexed feed"
+                                      : "❌ Error retrieving iCal");
+        return -1;
+    }
+    if (fetch == HTTP_RESULT_NOT_MODIFIED) {
+        LOG_DEBUG("📅 iCal feed not modified (304), keeping the event index");
+        return CALENDAR_NOT_MODIFIED;
+    }
     
-    return result;
+    client->parsed_date = 0;  // New feed: the next query rebuilds the window
+    return 0;
+}
+
+int query_calendar_events(CalendarClient *client, CalendarData *data, time_t date) {
+    if (!client || !data || !client->index_valid) return -1;
+    
+    // Feed unchanged and data already built for this day: nothing to do
+    int date_int = time_to_date_int(date);
+    if (client->parsed_date == date_int) {
+        return CALENDAR_NOT_MODIFIED;
+    }
+    
+    // New feed or new day: range query on the index
+    if (build_calendar_window(client, data, date) != 0) {
+        client->parsed_date = 0;
+        return -1;
+    }
+    
+    client->parsed_date = date_int;
+    LOG_DEBUG("📅 Calendar window for %d: %d today, %d tomorrow (index lookup)", date_int,
+              data->today.count, data->tomorrow.count);
+    return 0;
+}
+
+// Get processed calendar events for a specific date
+int get_calendar_events_data(CalendarClient *client, CalendarData *data, time_t date) {
+    if (!client || !data) return -1;
+    
+    // A failed download leaves the last good index in place
+    refresh_calendar_index(client);
+    return query_calendar_events(client, data, date);
 }
 
 // Initialize calendar client with input validation
@@ -446,6 +1086,18 @@ CalendarClient* calendar_client_init(const char* ical_url, int debug) {
     strncpy(client->ical_url, ical_url, sizeof(client->ical_url) - 1);
     client->ical_url[sizeof(client->ical_url) - 1] = '\0';
     client->debug = debug;
+    memset(&client->validators, 0, sizeof(client->validators));
+    memset(&client->index, 0, sizeof(client->index));
+    memset(&client->spare, 0, sizeof(client->spare));
+    client->parser = NULL;
+    client->index_valid = 0;
+    client->parsed_date = 0;
+    
+    // Warm the data pools so steady-state queries never reach the heap
+    if (buffer_pool_prefill(&calendar_event_pool, 2 * CALENDAR_POOL_DEPTH, CALENDAR_EVENTS_SIZE) != 0 ||
+        buffer_pool_prefill(&calendar_title_pool, CALENDAR_POOL_DEPTH, CALENDAR_TITLES_PREFILL) != 0) {
+        LOG_ERROR("⚠️  Failed to preallocate calendar buffers");
+    }
     
     return client;
 }
@@ -453,6 +1105,9 @@ CalendarClient* calendar_client_init(const char* ical_url, int debug) {
 // Free calendar client
 void calendar_client_free(CalendarClient *client) {
     if (client) {
+        event_index_free(&client->index);
+        event_index_free(&client->spare);
+        ical_parser_free(client->parser);
         free(client);
     }
 }
@@ -460,14 +1115,13 @@ void calendar_client_free(CalendarClient *client) {
 // Free calendar data
 void calendar_data_free(CalendarData *data) {
     if (data) {
-        if (data->today.events) {
-            free(data->today.events);
-            data->today.events = NULL;
-        }
-        if (data->tomorrow.events) {
-            free(data->tomorrow.events);
-            data->tomorrow.events = NULL;
-        }
+        buffer_pool_release(&calendar_event_pool, data->today.events, CALENDAR_EVENTS_SIZE);
+        buffer_pool_release(&calendar_event_pool, data->tomorrow.events, CALENDAR_EVENTS_SIZE);
+        buffer_pool_release(&calendar_title_pool, data->titles, data->titles_capacity);
+        data->today.events = NULL;
+        data->tomorrow.events = NULL;
+        data->titles = NULL;
+        data->titles_capacity = 0;
         data->today.count = 0;
         data->tomorrow.count = 0;
     }
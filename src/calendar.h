@@ -1,6 +1,7 @@
 #ifndef CALENDAR_H
 #define CALENDAR_H
 
+#include <stddef.h>
 #include <time.h>
 
 // Constants
@@ -9,6 +10,9 @@
 #define MAX_URL_LENGTH 1024
 #define MAX_BUFFER_SIZE 1024
 
+// Result when the feed (refresh) or the feed and date (queries) are unchanged (data left untouched)
+#define CALENDAR_NOT_MODIFIED 1
+
 // Event types
 typedef enum {
     EVENT_TYPE_NORMAL,
@@ -17,9 +21,11 @@ typedef enum {
     EVENT_TYPE_END
 } EventType;
 
-// Event structure
+#define MAX_EVENT_TITLE_LENGTH 512
+
+// Event structure (title points into the CalendarData title arena)
 typedef struct {
-    char title[512];
+    const char *title;
     time_t start;
     time_t end;
     EventType event_type;
@@ -37,12 +43,43 @@ typedef struct {
 typedef struct {
     DayEvents today;
     DayEvents tomorrow;
+    char *titles;               // Arena holding the event titles, freed with the data
+    size_t titles_capacity;
 } CalendarData;
 
 // Public functions
 CalendarClient* calendar_client_init(const char* ical_url, int debug);
 void calendar_client_free(CalendarClient *client);
 void calendar_data_free(CalendarData *data);
+
+/**
+ * Take both event arrays (MAX_EVENTS_PER_DAY each, counts 0) and a title arena of at
+ * least titles_size bytes from the calendar pools; calendar_data_free hands them back
+ * Returns: 0 on success, -1 on allocation failure (data cleared)
+ */
+int calendar_data_alloc(CalendarData *data, size_t titles_size);
+
+// Free the pooled calendar buffers (at exit, once every CalendarData is released)
+void calendar_cleanup(void);
+
+/**
+ * Download the feed (conditional GET) and rebuild the event index from it
+ * On failure the index of the last good feed is kept for queries.
+ * Returns: 0 if a new feed was indexed, CALENDAR_NOT_MODIFIED if unchanged, -1 on failure
+ */
+int refresh_calendar_index(CalendarClient *client);
+
+/**
+ * Process events for date into data from the event index (no network, e.g. at midnight)
+ * Returns: 0 on success, CALENDAR_NOT_MODIFIED if data for this feed and date was already
+ * returned, -1 if no feed has been indexed yet or on failure
+ */
+int query_calendar_events(CalendarClient *client, CalendarData *data, time_t date);
+
+/**
+ * Refresh the index, then query events for date (a failed download falls back to the last feed)
+ * Returns: 0 on success, CALENDAR_NOT_MODIFIED if nothing changed, -1 on failure
+ */
 int get_calendar_events_data(CalendarClient *client, CalendarData *data, time_t date);
 
 #endif // CALENDAR_H
\ No newline at end of file
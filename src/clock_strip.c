@@ -0,0 +1,198 @@
+#include <string.h>
+#include <math.h>
+#include <cairo.h>
+#include "clock_strip.h"
+#include "logging.h"
+
+// ====================== CONSTANTS ======================
+
+// Glyph rasterization canvas (origin leaves room for bearings on every side)
+#define GLYPH_CANVAS_SIZE 64
+#define GLYPH_ORIGIN_X 16
+#define GLYPH_ORIGIN_Y 48
+#define GLYPH_MAX_COLUMNS GLYPH_CANVAS_SIZE
+
+// Luma at or below this is ink (same cut-off as the former time BMP writer)
+#define GLYPH_INK_THRESHOLD 192
+
+// Clock text occupies strip rows [CLOCK_TEXT_TOP, CLOCK_STRIP_HEIGHT)
+#define CLOCK_TEXT_TOP 6
+
+#define CLOCK_GLYPH_COUNT 11  // '0'..'9' and ':'
+#define CLOCK_COLON_INDEX 10
+
+// ====================== ATLAS ======================
+
+// One pre-rasterized glyph stored column by column (already rotated for the panel)
+typedef struct {
+    double x_bearing;                        // Ink extents, for centering like cairo_text_extents
+    double y_bearing;
+    double ink_width;
+    int advance;                             // Pen advance in pixels
+    int first_column;                        // Offset of column 0 from the pen position
+    int column_count;
+    uint64_t columns[GLYPH_MAX_COLUMNS];     // Ink mask per column, bit 63 = canvas row 0
+} ClockGlyph;
+
+static ClockGlyph clock_glyphs[CLOCK_GLYPH_COUNT];
+static int clock_atlas_ready = 0;
+
+/**
+ * Rasterize one glyph with Cairo and pack its ink into column masks
+ * Returns: 0 on success, -1 on failure
+ */
+static int rasterize_glyph(cairo_surface_t *canvas, const char *text, ClockGlyph *glyph) {
+    cairo_t *cr = cairo_create(canvas);
+    if (cairo_status(cr) != CAIRO_STATUS_SUCCESS) {
+        cairo_destroy(cr);
+        return -1;
+    }
+
+    cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+    cairo_paint(cr);
+    set_clock_font(cr);
+
+    cairo_text_extents_t extents;
+    cairo_text_extents(cr, text, &extents);
+    glyph->x_bearing = extents.x_bearing;
+    glyph->y_bearing = extents.y_bearing;
+    glyph->ink_width = extents.width;
+    glyph->advance = (int)lround(extents.x_advance);
+
+    cairo_move_to(cr, GLYPH_ORIGIN_X, GLYPH_ORIGIN_Y);
+    cairo_show_text(cr, text);
+    cairo_destroy(cr);
+    cairo_surface_flush(canvas);
+
+    const unsigned char *data = cairo_image_surface_get_data(canvas);
+    int stride = cairo_image_surface_get_stride(canvas);
+
+    // Collect per-column ink masks, then trim empty columns on both sides
+    uint64_t masks[GLYPH_CANVAS_SIZE] = {0};
+    int first = -1, last = -1;
+    for (int x = 0; x < GLYPH_CANVAS_SIZE; x++) {
+        for (int y = 0; y < GLYPH_CANVAS_SIZE; y++) {
+            if (data[y * stride + x * 4 + 1] <= GLYPH_INK_THRESHOLD) {
+                masks[x] |= (uint64_t)1 << (63 - y);
+            }
+        }
+        if (masks[x]) {
+            if (first < 0) first = x;
+            last = x;
+        }
+    }
+
+    memset(glyph->columns, 0, sizeof(glyph->columns));
+    if (first < 0) {
+        glyph->first_column = 0;
+        glyph->column_count = 0;
+        return 0;
+    }
+
+    glyph->first_column = first - GLYPH_ORIGIN_X;
+    glyph->column_count = last - first + 1;
+    memcpy(glyph->columns, masks + first, glyph->column_count * sizeof(uint64_t));
+    return 0;
+}
+
+int clock_strip_init(void) {
+    if (clock_atlas_ready) {
+        return 0; // Already built
+    }
+
+    cairo_surface_t *canvas = cairo_image_surface_create(CAIRO_FORMAT_RGB24, GLYPH_CANVAS_SIZE, GLYPH_CANVAS_SIZE);
+    if (cairo_surface_status(canvas) != CAIRO_STATUS_SUCCESS) {
+        LOG_ERROR("❌ Failed to create Cairo surface for clock glyphs");
+        cairo_surface_destroy(canvas);
+        return -1;
+    }
+
+    static const char glyph_chars[CLOCK_GLYPH_COUNT + 1] = "0123456789:";
+    for (int i = 0; i < CLOCK_GLYPH_COUNT; i++) {
+        char text[2] = { glyph_chars[i], '\0' };
+        if (rasterize_glyph(canvas, text, &clock_glyphs[i]) != 0) {
+            LOG_ERROR("❌ Failed to rasterize clock glyph '%c'", glyph_chars[i]);
+            cairo_surface_destroy(canvas);
+            return -1;
+        }
+    }
+
+    cairo_surface_destroy(canvas);
+    clock_atlas_ready = 1;
+    LOG_DEBUG("⏰ Clock glyph atlas ready (%d glyphs, %d bytes)", CLOCK_GLYPH_COUNT, (int)sizeof(clock_glyphs));
+    return 0;
+}
+
+void clock_strip_cleanup(void) {
+    clock_atlas_ready = 0;
+}
+
+// ====================== COMPOSITION ======================
+
+/**
+ * AND the ink columns of one glyph into the panel window buffer
+ * Portrait column X lands on buffer row (CLOCK_STRIP_WIDTH - 1 - X),
+ * portrait row Y on bit (31 - Y) of that row read as a big-endian word.
+ */
+static void blit_glyph(const ClockGlyph *glyph, int pen_x, int row_shift, uint8_t *buffer) {
+    // Keep ink inside the text rows, as the former 24-row render surface did
+    const uint32_t clip = (0xFFFFFFFFu >> CLOCK_TEXT_TOP) & ~(0xFFFFFFFFu >> CLOCK_STRIP_HEIGHT);
+
+    for (int c = 0; c < glyph->column_count; c++) {
+        int x = pen_x + glyph->first_column + c;
+        if (x < 0 || x >= CLOCK_STRIP_WIDTH) {
+            continue;
+        }
+
+        uint64_t column = glyph->columns[c];
+        uint32_t ink = (uint32_t)(row_shift >= 0 ? column >> row_shift : column << -row_shift) & clip;
+        if (!ink) {
+            continue;
+        }
+
+        uint8_t *row = buffer + (CLOCK_STRIP_WIDTH - 1 - x) * CLOCK_STRIP_ROW_BYTES;
+        for (int b = 0; b < CLOCK_STRIP_ROW_BYTES; b++) {
+            row[b] &= (uint8_t)~(ink >> (24 - 8 * b));
+        }
+    }
+}
+
+int clock_strip_render(int hour, int minute, uint8_t *buffer) {
+    if (!clock_atlas_ready || !buffer) {
+        return -1;
+    }
+
+    const ClockGlyph *text[5] = {
+        &clock_glyphs[(hour / 10) % 10], &clock_glyphs[hour % 10],
+        &clock_glyphs[CLOCK_COLON_INDEX],
+        &clock_glyphs[(minute / 10) % 10], &clock_glyphs[minute % 10]
+    };
+
+    // Same centering as render_clock_to_surface, from cached extents
+    int pen = 0;
+    double ink_right = 0.0;
+    double y_bearing = 0.0;
+    for (int i = 0; i < 5; i++) {
+        ink_right = pen + text[i]->x_bearing + text[i]->ink_width;
+        if (text[i]->y_bearing < y_bearing) y_bearing = text[i]->y_bearing;
+        pen += text[i]->advance;
+    }
+    double ink_width = ink_right - text[0]->x_bearing;
+    int origin_x = (int)(((CLOCK_STRIP_WIDTH - ink_width) / 2) - 1);
+    int baseline = (int)((CLOCK_STRIP_HEIGHT - y_bearing) / 2);
+
+    // Canvas row r ends up on strip row (r - GLYPH_ORIGIN_Y + baseline + CLOCK_TEXT_TOP)
+    int row_shift = 32 + baseline + CLOCK_TEXT_TOP - GLYPH_ORIGIN_Y;
+    if (row_shift <= -64 || row_shift >= 64) {
+        return -1;
+    }
+
+    memset(buffer, 0xFF, CLOCK_STRIP_BUFFER_SIZE);
+    pen = origin_x;
+    for (int i = 0; i < 5; i++) {
+        blit_glyph(text[i], pen, row_shift, buffer);
+        pen += text[i]->advance;
+    }
+
+    return 0;
+}
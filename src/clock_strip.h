@@ -0,0 +1,36 @@
+#ifndef CLOCK_STRIP_H
+#define CLOCK_STRIP_H
+
+#include <stdint.h>
+#include "dashboard_render.h"
+
+// Clock strip geometry (portrait layout: 120x30 area centered at the top of the header)
+#define CLOCK_STRIP_WIDTH 120
+#define CLOCK_STRIP_HEIGHT 30
+#define CLOCK_STRIP_X ((EINK_WIDTH - CLOCK_STRIP_WIDTH) / 2)
+#define CLOCK_STRIP_Y 40
+
+// Panel window buffer: one row per portrait column, CLOCK_STRIP_HEIGHT bits per row
+#define CLOCK_STRIP_ROW_BYTES ((CLOCK_STRIP_HEIGHT + 7) / 8)
+#define CLOCK_STRIP_BUFFER_SIZE (CLOCK_STRIP_ROW_BYTES * CLOCK_STRIP_WIDTH)
+
+/**
+ * Pre-rasterize digits 0-9 and ':' at FONT_SIZE_TIME into a packed 1bpp atlas
+ * Requires dashboard fonts to be initialized. Safe to call more than once.
+ * Returns: 0 on success, -1 on failure
+ */
+int clock_strip_init(void);
+
+// Release the glyph atlas
+void clock_strip_cleanup(void);
+
+/**
+ * Compose "HH:MM" into a panel window buffer (CLOCK_STRIP_BUFFER_SIZE bytes)
+ * The buffer matches EPD_7IN5_V2_Display_Part at panel x = CLOCK_STRIP_Y,
+ * y = EINK_WIDTH - CLOCK_STRIP_X - CLOCK_STRIP_WIDTH (1 = white, MSB first).
+ * No allocation, no Cairo, no file access.
+ * Returns: 0 on success, -1 if the atlas is not initialized
+ */
+int clock_strip_render(int hour, int minute, uint8_t *buffer);
+
+#endif // CLOCK_STRIP_H
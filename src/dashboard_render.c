@@ -1,12 +1,17 @@
 #define _GNU_SOURCE
 #include "dashboard_render.h"
 #include "logging.h"
+#include "time_service.h"
+#include "metrics.h"
+#include "buffer_pool.h"
 #include <cairo.h>
 #include <cairo-ft.h>
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <stdio.h>
 #include <math.h>
 
@@ -68,6 +73,8 @@ typedef struct {
 
 static FontManager g_fonts = {0};
 
+static void text_layout_cache_clear(void);
+
 /**
  * Initialize font manager and load all required fonts
  * Returns: 1 on success, 0 on failure
@@ -139,6 +146,9 @@ void cleanup_dashboard_fonts(void) {
         if (g_fonts.ft_regular) FT_Done_Face(g_fonts.ft_regular);
         if (g_fonts.ft_library) FT_Done_FreeType(g_fonts.ft_library);
         
+        // Glyph indices belong to the faces being released
+        text_layout_cache_clear();
+        
         memset(&g_fonts, 0, sizeof(g_fonts));
     }
 }
@@ -177,156 +187,330 @@ static int is_material_icon_byte(unsigned char byte) {
 }
 
 /**
- * Extract UTF-8 character length from starting byte
+ * Extract UTF-8 character length from starting byte (lead byte plus continuation bytes)
  */
 static int get_utf8_char_length(const char *p) {
-    const char *start = p;
-    while (*p && (*p & 0x80)) p++;
-    if (*p && !(*p & 0x80)) p++; // Include the final byte
-    return p - start;
+    int length = 1;
+    while (p[length] && ((unsigned char)p[length] & 0xC0) == 0x80) length++;
+    return length;
+}
+
+// ====================== TEXT LAYOUT CACHE ======================
+
+// Line breaks and glyph runs, cached per (text, weight, size, wrap width) so that
+// unchanged labels are drawn with cairo_show_glyphs without measuring again
+#define TEXT_LAYOUT_CACHE_SIZE 64
+#define TEXT_LAYOUT_MAX_LINES 3
+#define TEXT_LAYOUT_MAX_RUNS 16
+#define ICON_BASELINE_SHIFT 2
+
+typedef struct {
+    int icon;                       // Material Symbols run, drawn ICON_BASELINE_SHIFT higher
+    int glyph_start;
+    int glyph_count;
+} TextRun;
+
+typedef struct {
+    double width;                   // Ink width in the text font, used for alignment
+    int run_start;
+    int run_count;
+} TextLine;
+
+typedef struct {
+    int used;                       // 0: free slot (buffers below are kept for the next entry)
+    char *text;
+    size_t text_capacity;
+    uint64_t hash;
+    FontWeight weight;
+    int font_size;
+    int max_width;                  // 0: single line, no wrapping
+    unsigned long last_used;
+    int line_count;
+    TextLine lines[TEXT_LAYOUT_MAX_LINES];
+    int run_count;
+    TextRun runs[TEXT_LAYOUT_MAX_RUNS];
+    cairo_glyph_t *glyphs;          // Positioned relative to the start of their line
+    int glyph_count;
+    size_t glyph_capacity;          // Bytes
+} TextLayout;
+
+// Only touched from the render path, which runs one render at a time
+static TextLayout g_layouts[TEXT_LAYOUT_CACHE_SIZE];
+static unsigned long g_layout_clock = 0;
+
+#define FNV_OFFSET_BASIS 1469598103934665603ULL
+
+static uint64_t hash_bytes(uint64_t hash, const void *data, size_t length) {
+    const unsigned char *p = data; // FNV-1a
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ p[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+static uint64_t hash_text(const char *text) {
+    return hash_bytes(FNV_OFFSET_BASIS, text, strlen(text));
+}
+
+static void text_layout_release(TextLayout *layout) {
+    free(layout->text);
+    free(layout->glyphs);
+    memset(layout, 0, sizeof(*layout));
+}
+
+// Empty a slot for another text, keeping its text and glyph buffers
+static void text_layout_recycle(TextLayout *layout) {
+    layout->used = 0;
+    layout->line_count = 0;
+    layout->run_count = 0;
+    layout->glyph_count = 0;
+}
+
+static void text_layout_cache_clear(void) {
+    for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++) {
+        text_layout_release(&g_layouts[i]);
+    }
 }
 
 /**
- * Draw text with Material Icons support and alignment
+ * Ink width of length bytes of text in the font currently set on cr
  */
-static void draw_text_with_icons(cairo_t *cr, double x, double y, const char *text, 
-                                FontWeight weight, int font_size, TextAlignment align) {
-    if (!cr || !text || !*text) return;
-    
-    // Clear any previous font state to prevent bold text accumulation
-    cairo_save(cr);
-    
+static double measure_text(cairo_t *cr, const char *text, int length) {
+    cairo_scaled_font_t *font = cairo_get_scaled_font(cr);
+    cairo_glyph_t *glyphs = NULL;
+    int count = 0;
+    if (cairo_scaled_font_text_to_glyphs(font, 0, 0, text, length, &glyphs, &count,
+                                         NULL, NULL, NULL) != CAIRO_STATUS_SUCCESS) {
+        return 0;
+    }
+
     cairo_text_extents_t extents;
-    double current_x = x;
-    
-    // Handle text alignment
-    if (align != ALIGN_LEFT) {
-        set_font(cr, weight, font_size);
-        cairo_text_extents(cr, text, &extents);
-        
-        if (align == ALIGN_CENTER) {
-            current_x = x - extents.width / 2.0;
-        } else if (align == ALIGN_RIGHT) {
-            current_x = x - extents.width;
-        }
+    cairo_scaled_font_glyph_extents(font, glyphs, count, &extents);
+    cairo_glyph_free(glyphs);
+    return extents.width;
+}
+
+/**
+ * Shape one run at *pen_x and append its glyphs to the layout
+ * Returns: 0 on success, -1 on failure
+ */
+static int text_layout_add_run(cairo_t *cr, TextLayout *layout, const char *text, int length,
+                               int icon, double *pen_x) {
+    if (layout->run_count >= TEXT_LAYOUT_MAX_RUNS) return -1;
+
+    if (icon) {
+        set_material_font(cr, layout->font_size);
+    } else {
+        set_font(cr, layout->weight, layout->font_size);
     }
-    
-    // Process text character by character for Material Icons
+    cairo_scaled_font_t *font = cairo_get_scaled_font(cr);
+
+    cairo_glyph_t *glyphs = NULL;
+    int count = 0;
+    if (cairo_scaled_font_text_to_glyphs(font, *pen_x, icon ? -ICON_BASELINE_SHIFT : 0, text, length,
+                                         &glyphs, &count, NULL, NULL, NULL) != CAIRO_STATUS_SUCCESS) {
+        return -1;
+    }
+    if (count == 0) {
+        cairo_glyph_free(glyphs);
+        return 0;
+    }
+
+    cairo_glyph_t *grown = buffer_pool_reserve(layout->glyphs, &layout->glyph_capacity,
+                                               (layout->glyph_count + count) * sizeof(cairo_glyph_t));
+    if (!grown) {
+        cairo_glyph_free(glyphs);
+        return -1;
+    }
+    layout->glyphs = grown;
+    memcpy(layout->glyphs + layout->glyph_count, glyphs, count * sizeof(cairo_glyph_t));
+
+    cairo_text_extents_t extents;
+    cairo_scaled_font_glyph_extents(font, glyphs, count, &extents);
+    *pen_x += extents.x_advance;
+    cairo_glyph_free(glyphs);
+
+    TextRun *run = &layout->runs[layout->run_count++];
+    run->icon = icon;
+    run->glyph_start = layout->glyph_count;
+    run->glyph_count = count;
+    layout->glyph_count += count;
+    return 0;
+}
+
+/**
+ * Split one line into Material Icon and text runs
+ * Returns: 0 on success, -1 on failure
+ */
+static int text_layout_add_line(cairo_t *cr, TextLayout *layout, const char *text, int length) {
+    TextLine *line = &layout->lines[layout->line_count++];
+
+    set_font(cr, layout->weight, layout->font_size);
+    line->width = measure_text(cr, text, length);
+    line->run_start = layout->run_count;
+
+    double pen_x = 0;
     const char *p = text;
-    while (*p) {
-        unsigned char byte = (unsigned char)*p;
-        
-        if (is_material_icon_byte(byte)) {
-            // Handle Material Icon
-            const char *char_start = p;
-            int char_len = get_utf8_char_length(p);
-            p += char_len;
-            
-            if (char_len > 0 && char_len < MAX_ICON_BUFFER) {
-                char icon_char[MAX_ICON_BUFFER];
-                strncpy(icon_char, char_start, char_len);
-                icon_char[char_len] = '\0';
-                
-                // Draw with Material font (with vertical offset for alignment)
-                set_material_font(cr, font_size);
-                cairo_move_to(cr, current_x, y - 2);  // Slight adjustment for icon alignment
-                cairo_show_text(cr, icon_char);
-                
-                cairo_text_extents(cr, icon_char, &extents);
-                current_x += extents.x_advance;
-            }
+    const char *end = text + length;
+    while (p < end) {
+        const char *run_start = p;
+        int icon = is_material_icon_byte((unsigned char)*p);
+        while (p < end && is_material_icon_byte((unsigned char)*p) == icon) {
+            p += icon ? get_utf8_char_length(p) : 1;
+        }
+        if (p > end) p = end;
+
+        if (text_layout_add_run(cr, layout, run_start, (int)(p - run_start), icon, &pen_x) != 0) {
+            return -1;
+        }
+    }
+
+    line->run_count = layout->run_count - line->run_start;
+    return 0;
+}
+
+/**
+ * Break text into lines of at most max_width (words separated by single spaces)
+ * A word wider than max_width gets a line of its own.
+ * Returns: 0 on success, -1 on failure
+ */
+static int text_layout_wrap(cairo_t *cr, TextLayout *layout, const char *text) {
+    // Words joined by single spaces, so that every candidate line is a slice of this buffer
+    char words[MAX_TEXT_BUFFER];
+    int length = 0;
+    for (const char *p = text; *p && length < MAX_TEXT_BUFFER - 1; p++) {
+        if (*p == ' ' && (length == 0 || words[length - 1] == ' ')) continue;
+        words[length++] = *p;
+    }
+    while (length > 0 && words[length - 1] == ' ') length--;
+    words[length] = '\0';
+
+    set_font(cr, layout->weight, layout->font_size);
+
+    int line_start = 0;
+    int line_end = -1;              // -1: current line is empty
+    int word_start = 0;
+    while (word_start < length) {
+        int word_end = word_start;
+        while (word_end < length && words[word_end] != ' ') word_end++;
+
+        if (line_end < 0) {
+            line_start = word_start;
+            line_end = word_end;
+        } else if (measure_text(cr, words + line_start, word_end - line_start) <= layout->max_width) {
+            line_end = word_end;
         } else {
-            // Handle regular text
-            const char *text_start = p;
-            while (*p && !is_material_icon_byte((unsigned char)*p)) {
-                p++;
-            }
-            
-            if (p > text_start) {
-                int len = p - text_start;
-                if (len < MAX_TEXT_BUFFER) {
-                    char regular_text[MAX_TEXT_BUFFER];
-                    strncpy(regular_text, text_start, len);
-                    regular_text[len] = '\0';
-                    
-                    // Draw with regular font
-                    set_font(cr, weight, font_size);
-                    cairo_move_to(cr, current_x, y);
-                    cairo_show_text(cr, regular_text);
-                    
-                    cairo_text_extents(cr, regular_text, &extents);
-                    current_x += extents.x_advance;
-                }
+            if (text_layout_add_line(cr, layout, words + line_start, line_end - line_start) != 0) {
+                return -1;
             }
+            if (layout->line_count == TEXT_LAYOUT_MAX_LINES) return 0;
+            set_font(cr, layout->weight, layout->font_size);
+            line_start = word_start;
+            line_end = word_end;
         }
+        word_start = word_end + 1;
     }
-    
-    // Restore Cairo context to clear font state
+
+    if (line_end >= 0) {
+        return text_layout_add_line(cr, layout, words + line_start, line_end - line_start);
+    }
+    return 0;
+}
+
+/**
+ * Look up, or break and shape, the layout of text
+ * max_width > 0 wraps the text on up to TEXT_LAYOUT_MAX_LINES lines, 0 keeps it on one line.
+ * Returns: cached layout (valid until the next lookup evicts it), NULL on failure
+ */
+static const TextLayout* text_layout_get(cairo_t *cr, const char *text, FontWeight weight,
+                                         int font_size, int max_width) {
+    if (!cr || !text || !g_fonts.initialized) return NULL;
+
+    uint64_t hash = hash_text(text);
+    TextLayout *victim = NULL;
+    for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++) {
+        TextLayout *entry = &g_layouts[i];
+        if (!entry->used) {
+            if (!victim || victim->used) victim = entry;
+            continue;
+        }
+        if (entry->hash == hash && entry->weight == weight && entry->font_size == font_size &&
+            entry->max_width == max_width && strcmp(entry->text, text) == 0) {
+            entry->last_used = ++g_layout_clock;
+            metrics_count(METRIC_CACHE_HIT_LAYOUT);
+            return entry;
+        }
+        if (!victim || (victim->used && entry->last_used < victim->last_used)) {
+            victim = entry;
+        }
+    }
+    metrics_count(METRIC_CACHE_MISS_LAYOUT);
+
+    // Least recently used (or free) slot
+    text_layout_recycle(victim);
+    size_t length = strlen(text) + 1;
+    char *copy = buffer_pool_reserve(victim->text, &victim->text_capacity, length);
+    if (!copy) return NULL;
+    victim->text = copy;
+    memcpy(victim->text, text, length);
+    victim->used = 1;
+    victim->hash = hash;
+    victim->weight = weight;
+    victim->font_size = font_size;
+    victim->max_width = max_width;
+    victim->last_used = ++g_layout_clock;
+
+    cairo_save(cr);
+    int result = (max_width > 0) ? text_layout_wrap(cr, victim, text)
+                                 : text_layout_add_line(cr, victim, text, (int)strlen(text));
     cairo_restore(cr);
+
+    if (result != 0) {
+        LOG_ERROR("❌ Failed to lay out text: %s", text);
+        text_layout_recycle(victim);
+        return NULL;
+    }
+    return victim;
 }
 
 /**
- * Wrap text to fit within specified width
- * Returns: number of lines created
+ * Draw one line of a cached layout with its baseline at (x, y)
  */
-static int wrap_text(const char *text, int max_width, FontWeight weight, int font_size,
-                    char lines[][MAX_TEXT_BUFFER], int max_lines, cairo_t *cr) {
-    if (!text || !*text || !cr) return 0;
-    
-    set_font(cr, weight, font_size);
-    
-    char *text_copy = strdup(text);
-    if (!text_copy) return 0;
-    
-    char *saveptr;
-    char *word = strtok_r(text_copy, " ", &saveptr);
-    int line_count = 0;
-    
-    // Initialize first line
-    if (max_lines > 0) {
-        strcpy(lines[0], "");
+static void draw_text_layout_line(cairo_t *cr, const TextLayout *layout, int line_index,
+                                  double x, double y, TextAlignment align) {
+    if (!cr || !layout || line_index < 0 || line_index >= layout->line_count) return;
+    const TextLine *line = &layout->lines[line_index];
+
+    if (align == ALIGN_CENTER) {
+        x -= line->width / 2.0;
+    } else if (align == ALIGN_RIGHT) {
+        x -= line->width;
     }
-    
-    while (word && line_count < max_lines) {
-        char test_line[MAX_LINE_BUFFER];
-        
-        // Create test line with new word
-        if (strlen(lines[line_count]) > 0) {
-            snprintf(test_line, sizeof(test_line), "%s %s", lines[line_count], word);
-        } else {
-            strncpy(test_line, word, sizeof(test_line) - 1);
-            test_line[sizeof(test_line) - 1] = '\0';
-        }
-        
-        // Check if test line fits
-        cairo_text_extents_t extents;
-        cairo_text_extents(cr, test_line, &extents);
-        
-        if (extents.width <= max_width) {
-            // Fits on current line
-            strncpy(lines[line_count], test_line, MAX_TEXT_BUFFER - 1);
-            lines[line_count][MAX_TEXT_BUFFER - 1] = '\0';
+
+    // Clear any previous font state to prevent bold text accumulation
+    cairo_save(cr);
+    cairo_translate(cr, x, y);
+    for (int i = line->run_start; i < line->run_start + line->run_count; i++) {
+        const TextRun *run = &layout->runs[i];
+        if (run->icon) {
+            set_material_font(cr, layout->font_size);
         } else {
-            // Doesn't fit, handle overflow
-            if (strlen(lines[line_count]) == 0) {
-                // Single word too long, truncate it
-                strncpy(lines[line_count], word, MAX_TEXT_BUFFER - 1);
-                lines[line_count][MAX_TEXT_BUFFER - 1] = '\0';
-            }
-            
-            // Move to next line
-            line_count++;
-            if (line_count < max_lines) {
-                strncpy(lines[line_count], word, MAX_TEXT_BUFFER - 1);
-                lines[line_count][MAX_TEXT_BUFFER - 1] = '\0';
-            }
+            set_font(cr, layout->weight, layout->font_size);
         }
-        
-        word = strtok_r(NULL, " ", &saveptr);
+        cairo_show_glyphs(cr, layout->glyphs + run->glyph_start, run->glyph_count);
     }
+    cairo_restore(cr);
+}
+
+/**
+ * Draw text with Material Icons support and alignment
+ */
+static void draw_text_with_icons(cairo_t *cr, double x, double y, const char *text, 
+                                FontWeight weight, int font_size, TextAlignment align) {
+    if (!cr || !text || !*text) return;
     
-    free(text_copy);
-    return line_count + 1;
+    const TextLayout *layout = text_layout_get(cr, text, weight, font_size, 0);
+    draw_text_layout_line(cr, layout, 0, x, y, align);
 }
 
 /**
@@ -411,12 +595,12 @@ static void draw_menu_item(cairo_t *cr, int x, int y, int col_width,
     
     // Draw content (wrapped if necessary)
     if (content && strlen(content) > 0) {
-        char lines[3][MAX_TEXT_BUFFER];
-        int line_count = wrap_text(content, col_width - 20, FONT_REGULAR, FONT_SIZE_SMALL, lines, 3, cr);
+        const TextLayout *layout = text_layout_get(cr, content, FONT_REGULAR, FONT_SIZE_SMALL, col_width - 20);
+        int line_count = layout ? layout->line_count : 0;
         
         for (int i = 0; i < line_count && i < 3; i++) {
-            draw_text_with_icons(cr, x + COLUMN_PADDING, y + 18 + i * MENU_ITEM_LINE_HEIGHT, lines[i],
-                                FONT_REGULAR, FONT_SIZE_SMALL, ALIGN_LEFT);
+            draw_text_layout_line(cr, layout, i, x + COLUMN_PADDING, y + 18 + i * MENU_ITEM_LINE_HEIGHT,
+                                  ALIGN_LEFT);
         }
     } else {
         draw_text_with_icons(cr, x + COLUMN_PADDING, y + 18, "-",
@@ -430,7 +614,9 @@ static void draw_menu_item(cairo_t *cr, int x, int y, int col_width,
 static void format_event_line(const CalendarEvent *event, char *buffer, size_t buffer_size) {
     if (!event || !buffer) return;
     
-    struct tm *start_tm = localtime(&event->start);
+    struct tm start_tm_buf;
+    
+    struct tm *start_tm = time_service_local(event->start, &start_tm_buf);
     if (!start_tm) return;
     
     switch (event->event_type) {
@@ -443,7 +629,8 @@ static void format_event_line(const CalendarEvent *event, char *buffer, size_t b
             break;
         case EVENT_TYPE_END:
             {
-                struct tm *end_tm = localtime(&event->end);
+                struct tm end_tm_buf;
+                struct tm *end_tm = time_service_local(event->end, &end_tm_buf);
                 if (end_tm) {
                     snprintf(buffer, buffer_size, "Jusqu'à %02d:%02d: %s", 
                             end_tm->tm_hour, end_tm->tm_min, event->title);
@@ -461,33 +648,325 @@ static void format_event_line(const CalendarEvent *event, char *buffer, size_t b
 
 // ====================== MAIN RENDERING FUNCTION ======================
 
+// Native position of each section; the draw functions always work in these coordinates
+static int native_section_bounds(DashboardSection section, int *x, int *y, int *width, int *height) {
+    switch (section) {
+        case SECTION_HEADER:
+            *x = HEADER_X; *y = HEADER_Y; *width = HEADER_WIDTH; *height = HEADER_HEIGHT;
+            return 1;
+        case SECTION_WEATHER:
+            *x = WEATHER_X; *y = WEATHER_Y; *width = WEATHER_WIDTH; *height = WEATHER_HEIGHT;
+            return 1;
+        case SECTION_MENU:
+            *x = MENU_X; *y = MENU_Y; *width = MENU_WIDTH; *height = MENU_HEIGHT;
+            return 1;
+        case SECTION_CALENDAR:
+            *x = CALENDAR_X; *y = CALENDAR_Y; *width = CALENDAR_WIDTH; *height = CALENDAR_HEIGHT;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Layout: the header stays on top (the clock strip lives there), the other sections are
+// stacked below it in profile order at their native size; sections left out are not shown
+#define LAYOUT_SECTION_GAP (MENU_Y - (WEATHER_Y + WEATHER_HEIGHT))
+
+static const struct {
+    const char *name;
+    DashboardSection section;
+} layout_names[] = {
+    {"weather", SECTION_WEATHER},
+    {"menu", SECTION_MENU},
+    {"calendar", SECTION_CALENDAR}
+};
+#define LAYOUT_NAME_COUNT ((int)(sizeof(layout_names) / sizeof(layout_names[0])))
+
+static unsigned int g_layout_visible = SECTION_ALL;
+static int g_layout_y[LAYOUT_NAME_COUNT] = { WEATHER_Y, MENU_Y, CALENDAR_Y };
+
 /**
- * Core rendering function - renders dashboard to any Cairo surface
+ * Select and order the sections shown below the header, e.g. "calendar,weather"
+ * Call before the first render (retained layers and the panel frame are not invalidated).
+ * Returns: 1 on success, 0 if the list is empty or names an unknown or repeated section
  */
-void render_dashboard_to_surface(cairo_surface_t *surface, time_t display_date,
+int configure_dashboard_layout(const char *sections) {
+    if (!sections) return 0;
+    
+    unsigned int visible = SECTION_HEADER;
+    int y[LAYOUT_NAME_COUNT] = { 0 };
+    int cursor = WEATHER_Y;
+    const char *name = sections;
+    
+    while (*name) {
+        size_t length = strcspn(name, ",");
+        int found = -1;
+        for (int i = 0; i < LAYOUT_NAME_COUNT; i++) {
+            if (strlen(layout_names[i].name) == length && strncasecmp(name, layout_names[i].name, length) == 0) {
+                found = i;
+                break;
+            }
+        }
+        if (found < 0 || (visible & layout_names[found].section)) {
+            LOG_ERROR("❌ Invalid dashboard layout '%s' (use weather, menu, calendar once each)", sections);
+            return 0;
+        }
+        
+        int x, section_y, width, height;
+        native_section_bounds(layout_names[found].section, &x, &section_y, &width, &height);
+        visible |= layout_names[found].section;
+        y[found] = cursor;
+        cursor += height + LAYOUT_SECTION_GAP;
+        
+        name += length;
+        if (*name == ',') name++;
+    }
+    
+    if (visible == SECTION_HEADER) {
+        LOG_ERROR("❌ Invalid dashboard layout '%s' (no section listed)", sections);
+        return 0;
+    }
+    
+    g_layout_visible = visible;
+    memcpy(g_layout_y, y, sizeof(g_layout_y));
+    LOG_DEBUG("🖼️  Dashboard layout: header,%s", sections);
+    return 1;
+}
+
+/**
+ * Get portrait layout bounds of a single section, where the layout placed it
+ * Returns: 1 on success, 0 if section is unknown or not part of the layout
+ */
+int get_section_bounds(DashboardSection section, int *x, int *y, int *width, int *height) {
+    if (!x || !y || !width || !height) return 0;
+    if (!(g_layout_visible & section) || !native_section_bounds(section, x, y, width, height)) return 0;
+    
+    for (int i = 0; i < LAYOUT_NAME_COUNT; i++) {
+        if (layout_names[i].section == section) {
+            *y = g_layout_y[i];
+        }
+    }
+    return 1;
+}
+
+// ====================== SECTION LAYERS ======================
+
+// Each section is drawn into its own retained surface, tagged with a version of the data it
+// shows; a render only redraws the layers whose version moved and composites the rest
+#define LAYER_MARGIN 1              // Stroke overflow around the section border
+
+typedef struct {
+    cairo_surface_t *surface;
+    uint64_t version;
+    int valid;
+} SectionLayer;
+
+static const DashboardSection layer_sections[] = {
+    SECTION_HEADER, SECTION_WEATHER, SECTION_MENU, SECTION_CALENDAR
+};
+#define LAYER_COUNT ((int)(sizeof(layer_sections) / sizeof(layer_sections[0])))
+
+static SectionLayer g_section_layers[LAYER_COUNT];
+
+static uint64_t hash_string(uint64_t hash, const char *text) {
+    return hash_bytes(hash, text, strlen(text) + 1);
+}
+
+/**
+ * Version of what a section displays (fields the draw functions read, nothing else)
+ */
+static uint64_t section_version(DashboardSection section, time_t display_date,
                                 const WeatherData *weather_data,
                                 const MenuData *menu_data,
                                 const CalendarData *calendar_data) {
-    if (!surface) return;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    int present;
     
-    cairo_t *cr = cairo_create(surface);
-    if (!cr) return;
+    switch (section) {
+        case SECTION_HEADER: {
+            long long minute = (long long)display_date / 60; // Date and HH:MM
+            return hash_bytes(hash, &minute, sizeof(minute));
+        }
+        case SECTION_WEATHER:
+            present = weather_data != NULL;
+            hash = hash_bytes(hash, &present, sizeof(present));
+            if (!present) return hash;
+            hash = hash_bytes(hash, &weather_data->current, sizeof(WeatherCurrent));
+            hash = hash_bytes(hash, &weather_data->forecast_count, sizeof(int));
+            for (int i = 0; i < weather_data->forecast_count && i < MAX_FORECAST_HOURS; i++) {
+                const WeatherForecast *forecast = &weather_data->forecasts[i];
+                hash = hash_bytes(hash, &forecast->datetime, sizeof(time_t));
+                hash = hash_bytes(hash, &forecast->temperature, sizeof(forecast->temperature));
+                hash = hash_bytes(hash, &forecast->weather_code, sizeof(forecast->weather_code));
+                hash = hash_bytes(hash, &forecast->is_day, sizeof(forecast->is_day));
+            }
+            return hash;
+        case SECTION_MENU:
+            present = menu_data != NULL;
+            hash = hash_bytes(hash, &present, sizeof(present));
+            if (!present) return hash;
+            hash = hash_string(hash, menu_data->today.midi);
+            hash = hash_string(hash, menu_data->today.soir);
+            hash = hash_string(hash, menu_data->tomorrow.midi);
+            return hash_string(hash, menu_data->tomorrow.soir);
+        case SECTION_CALENDAR:
+            present = calendar_data != NULL;
+            hash = hash_bytes(hash, &present, sizeof(present));
+            if (!present) return hash;
+            for (int d = 0; d < 2; d++) {
+                const DayEvents *day = d ? &calendar_data->tomorrow : &calendar_data->today;
+                hash = hash_bytes(hash, &day->count, sizeof(int));
+                for (int i = 0; i < day->count && day->events; i++) {
+                    const CalendarEvent *event = &day->events[i];
+                    hash = hash_string(hash, event->title);
+                    hash = hash_bytes(hash, &event->start, sizeof(time_t));
+                    hash = hash_bytes(hash, &event->end, sizeof(time_t));
+                    hash = hash_bytes(hash, &event->event_type, sizeof(EventType));
+                }
+            }
+            return hash;
+        default:
+            return hash;
+    }
+}
+
+/**
+ * Redraw one section into its layer (white background, native dashboard coordinates)
+ * Returns: 0 on success, -1 on failure
+ */
+static int draw_section_layer(SectionLayer *layer, DashboardSection section, time_t display_date,
+                              const WeatherData *weather_data,
+                              const MenuData *menu_data,
+                              const CalendarData *calendar_data) {
+    int x, y, width, height;
+    if (!native_section_bounds(section, &x, &y, &width, &height)) return -1;
+    
+    if (!layer->surface) {
+        layer->surface = cairo_image_surface_create(CAIRO_FORMAT_RGB24, width + 2 * LAYER_MARGIN,
+                                                    height + 2 * LAYER_MARGIN);
+        if (cairo_surface_status(layer->surface) != CAIRO_STATUS_SUCCESS) {
+            LOG_ERROR("❌ Failed to create layer surface for section %d", section);
+            cairo_surface_destroy(layer->surface);
+            layer->surface = NULL;
+            return -1;
+        }
+    }
     
-    // Clear background to white
+    cairo_t *cr = cairo_create(layer->surface);
     cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
     cairo_paint(cr);
+    cairo_translate(cr, LAYER_MARGIN - x, LAYER_MARGIN - y);
     
     // Set default drawing color to black
     cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
     cairo_set_line_width(cr, 1.0);
     
-    // Draw all dashboard sections
-    draw_header_section(cr, display_date);
-    draw_weather_section(cr, weather_data);
-    draw_menu_section(cr, menu_data, display_date);
-    draw_calendar_section(cr, calendar_data);
+    uint64_t started = metrics_start();
+    switch (section) {
+        case SECTION_HEADER:
+            draw_header_section(cr, display_date);
+            metrics_observe(METRIC_DRAW_HEADER, started);
+            break;
+        case SECTION_WEATHER:
+            draw_weather_section(cr, weather_data);
+            metrics_observe(METRIC_DRAW_WEATHER, started);
+            break;
+        case SECTION_MENU:
+            draw_menu_section(cr, menu_data, display_date);
+            metrics_observe(METRIC_DRAW_MENU, started);
+            break;
+        case SECTION_CALENDAR:
+            draw_calendar_section(cr, calendar_data);
+            metrics_observe(METRIC_DRAW_CALENDAR, started);
+            break;
+        default:
+            break;
+    }
+    
+    cairo_destroy(cr);
+    cairo_surface_flush(layer->surface);
+    return 0;
+}
+
+/**
+ * Mark every layer stale (next render redraws all sections)
+ */
+void invalidate_dashboard_layers(void) {
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        g_section_layers[i].valid = 0;
+    }
+}
+
+/**
+ * Free the layer surfaces
+ */
+void release_dashboard_layers(void) {
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        if (g_section_layers[i].surface) {
+            cairo_surface_destroy(g_section_layers[i].surface);
+        }
+    }
+    memset(g_section_layers, 0, sizeof(g_section_layers));
+}
+
+/**
+ * Refresh the selected sections of the surface from their layers, redrawing stale layers only
+ */
+void render_dashboard_sections(cairo_surface_t *surface, unsigned int sections, time_t display_date,
+                               const WeatherData *weather_data,
+                               const MenuData *menu_data,
+                               const CalendarData *calendar_data) {
+    if (!surface || !(sections & SECTION_ALL)) return;
+    
+    uint64_t render_started = metrics_start();
+    cairo_t *cr = cairo_create(surface);
+    if (!cr) return;
+    
+    // White around the sections (layers cover the sections themselves)
+    if ((sections & SECTION_ALL) == SECTION_ALL) {
+        cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+        cairo_paint(cr);
+    }
+    
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        DashboardSection section = layer_sections[i];
+        SectionLayer *layer = &g_section_layers[i];
+        int x, y, width, height;
+        if (!(sections & section) || !get_section_bounds(section, &x, &y, &width, &height)) {
+            continue;
+        }
+        
+        uint64_t version = section_version(section, display_date, weather_data, menu_data, calendar_data);
+        if (!layer->valid || layer->version != version) {
+            layer->valid = 0;
+            if (draw_section_layer(layer, section, display_date, weather_data, menu_data, calendar_data) != 0) {
+                continue;
+            }
+            layer->version = version;
+            layer->valid = 1;
+            metrics_count(METRIC_CACHE_MISS_LAYER);
+        } else {
+            metrics_count(METRIC_CACHE_HIT_LAYER);
+        }
+        
+        cairo_set_source_surface(cr, layer->surface, x - LAYER_MARGIN, y - LAYER_MARGIN);
+        cairo_rectangle(cr, x - LAYER_MARGIN, y - LAYER_MARGIN,
+                        width + 2 * LAYER_MARGIN, height + 2 * LAYER_MARGIN);
+        cairo_fill(cr);
+    }
     
     cairo_destroy(cr);
+    metrics_observe(METRIC_RENDER, render_started);
+}
+
+/**
+ * Core rendering function - renders dashboard to any Cairo surface
+ */
+void render_dashboard_to_surface(cairo_surface_t *surface, time_t display_date,
+                                const WeatherData *weather_data,
+                                const MenuData *menu_data,
+                                const CalendarData *calendar_data) {
+    render_dashboard_sections(surface, SECTION_ALL, display_date, weather_data, menu_data, calendar_data);
 }
 
 // ====================== SECTION DRAWING FUNCTIONS ======================
@@ -498,7 +977,9 @@ void render_dashboard_to_surface(cairo_surface_t *surface, time_t display_date,
 void draw_header_section(cairo_t *cr, time_t display_date) {
     if (!cr) return;
     
-    struct tm *tm_info = localtime(&display_date);
+    struct tm tm_info_buf;
+    
+    struct tm *tm_info = time_service_local(display_date, &tm_info_buf);
     if (!tm_info) return;
     
     // Draw border
@@ -570,9 +1051,12 @@ void draw_weather_section(cairo_t *cr, const WeatherData *weather_data) {
     // Current weather section (left side)
     int content_y = WEATHER_Y + 75;
     
+    const char *current_icon = get_weather_icon_unicode(weather_data->current.weather_code,
+                                                        weather_data->current.is_day);
+    
     // Format temperature
     char temp_str[32];
-    snprintf(temp_str, sizeof(temp_str), "%.0f°C", weather_data->current.temperature);
+    snprintf(temp_str, sizeof(temp_str), "%d°C", weather_data->current.temperature);
     
     // Calculate positioning for centered weather icon and temperature
     cairo_text_extents_t temp_extents, weather_icon_extents;
@@ -586,7 +1070,7 @@ void draw_weather_section(cairo_t *cr, const WeatherData *weather_data) {
     // Isolate large weather icon font calculations
     cairo_save(cr);
     set_material_font(cr, FONT_SIZE_WEATHER_ICON);
-    cairo_text_extents(cr, weather_data->current.icon_unicode, &weather_icon_extents);
+    cairo_text_extents(cr, current_icon, &weather_icon_extents);
     cairo_restore(cr);
     
     double weather_total_width = weather_icon_extents.width + WEATHER_ICON_TEMP_SPACING + temp_extents.width;
@@ -596,7 +1080,7 @@ void draw_weather_section(cairo_t *cr, const WeatherData *weather_data) {
     cairo_save(cr);
     set_material_font(cr, FONT_SIZE_WEATHER_ICON);
     cairo_move_to(cr, start_x, content_y + 55);
-    cairo_show_text(cr, weather_data->current.icon_unicode);
+    cairo_show_text(cr, current_icon);
     cairo_restore(cr);
     
     // Draw temperature with font isolation
@@ -608,7 +1092,7 @@ void draw_weather_section(cairo_t *cr, const WeatherData *weather_data) {
     
     // Draw weather description centered below
     draw_text_with_icons(cr, WEATHER_X + SECTION_MARGIN + WEATHER_LEFT_SECTION_WIDTH/2, content_y + 85,
-                        weather_data->current.description, FONT_REGULAR, FONT_SIZE_MEDIUM, ALIGN_CENTER);
+                        get_weather_description(weather_data->current.weather_code), FONT_REGULAR, FONT_SIZE_MEDIUM, ALIGN_CENTER);
     
     // Forecasts section (right side)
     int forecast_x = WEATHER_X + 230;
@@ -635,7 +1119,8 @@ void draw_weather_section(cairo_t *cr, const WeatherData *weather_data) {
     int item_y = forecast_y + 50;
     
     for (int i = 0; i < weather_data->forecast_count && i < 12; i++) {
-        struct tm *tm_info = localtime(&weather_data->forecasts[i].datetime);
+        struct tm tm_info_buf;
+        struct tm *tm_info = time_service_local(weather_data->forecasts[i].datetime, &tm_info_buf);
         if (!tm_info) continue;
         
         int x = (i < WEATHER_FORECAST_ITEMS_PER_COL) ? col1_x : col2_x;
@@ -658,12 +1143,14 @@ void draw_weather_section(cairo_t *cr, const WeatherData *weather_data) {
         set_material_font(cr, FONT_SIZE_TINY);
         cairo_move_to(cr, x + time_extents.x_advance, y + ICON_VERTICAL_OFFSET);
         cairo_text_extents_t icon_extents;
-        cairo_text_extents(cr, weather_data->forecasts[i].icon_unicode, &icon_extents);
-        cairo_show_text(cr, weather_data->forecasts[i].icon_unicode);
+        const char *icon = get_weather_icon_unicode(weather_data->forecasts[i].weather_code,
+                                                    weather_data->forecasts[i].is_day);
+        cairo_text_extents(cr, icon, &icon_extents);
+        cairo_show_text(cr, icon);
         
         // Draw temperature
         char temp_part[16];
-        snprintf(temp_part, sizeof(temp_part), " %.0f°C", weather_data->forecasts[i].temperature);
+        snprintf(temp_part, sizeof(temp_part), " %d°C", weather_data->forecasts[i].temperature);
         set_font(cr, FONT_REGULAR, FONT_SIZE_TINY);
         cairo_move_to(cr, x + time_extents.x_advance + icon_extents.x_advance, y);
         cairo_show_text(cr, temp_part);
@@ -781,14 +1268,14 @@ void draw_calendar_section(cairo_t *cr, const CalendarData *calendar_data) {
         char event_line[MAX_TEXT_BUFFER];
         format_event_line(event, event_line, sizeof(event_line));
         
-        char lines[2][MAX_TEXT_BUFFER];
-        int line_count = wrap_text(event_line, col_width - 10, FONT_REGULAR, FONT_SIZE_TINY, lines, 2, cr);
+        const TextLayout *layout = text_layout_get(cr, event_line, FONT_REGULAR, FONT_SIZE_TINY, col_width - 10);
+        int line_count = layout ? layout->line_count : 0;
         
         for (int j = 0; j < line_count && j < 2; j++) {
             if (event_y > col_y + 200) break;
             
-            draw_text_with_icons(cr, today_x + COLUMN_PADDING + (j > 0 ? 10 : 0), event_y, lines[j],
-                                FONT_REGULAR, FONT_SIZE_TINY, ALIGN_LEFT);
+            draw_text_layout_line(cr, layout, j, today_x + COLUMN_PADDING + (j > 0 ? 10 : 0), event_y,
+                                  ALIGN_LEFT);
             event_y += CALENDAR_ITEM_LINE_HEIGHT;
         }
         
@@ -820,14 +1307,14 @@ void draw_calendar_section(cairo_t *cr, const CalendarData *calendar_data) {
         char event_line[MAX_TEXT_BUFFER];
         format_event_line(event, event_line, sizeof(event_line));
         
-        char lines[2][MAX_TEXT_BUFFER];
-        int line_count = wrap_text(event_line, col_width - 10, FONT_REGULAR, FONT_SIZE_TINY, lines, 2, cr);
+        const TextLayout *layout = text_layout_get(cr, event_line, FONT_REGULAR, FONT_SIZE_TINY, col_width - 10);
+        int line_count = layout ? layout->line_count : 0;
         
         for (int j = 0; j < line_count && j < 2; j++) {
             if (event_y > col_y + 200) break;
             
-            draw_text_with_icons(cr, tomorrow_x + COLUMN_PADDING + (j > 0 ? 10 : 0), event_y, lines[j],
-                                FONT_REGULAR, FONT_SIZE_TINY, ALIGN_LEFT);
+            draw_text_layout_line(cr, layout, j, tomorrow_x + COLUMN_PADDING + (j > 0 ? 10 : 0), event_y,
+                                  ALIGN_LEFT);
             event_y += CALENDAR_ITEM_LINE_HEIGHT;
         }
         
@@ -852,7 +1339,8 @@ int render_clock_to_surface(cairo_t *cr, time_t current_time, int width, int hei
     cairo_paint(cr);
     
     // Format time string
-    struct tm *tm_info = localtime(&current_time);
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(current_time, &tm_info_buf);
     if (!tm_info) {
         return -1;
     }
@@ -862,7 +1350,7 @@ int render_clock_to_surface(cairo_t *cr, time_t current_time, int width, int hei
     
     // Clear any previous font state and set consistent font once
     cairo_save(cr);
-    set_font(cr, FONT_BOLD, FONT_SIZE_TIME);
+    set_clock_font(cr);
     
     cairo_text_extents_t text_extents;
     cairo_text_extents(cr, time_str, &text_extents);
@@ -879,4 +1367,11 @@ int render_clock_to_surface(cairo_t *cr, time_t current_time, int width, int hei
     cairo_restore(cr);
     
     return 0;
-}
\ No newline at end of file
+}
+
+/**
+ * Select the clock font, shared by render_clock_to_surface and the clock glyph atlas
+ */
+void set_clock_font(cairo_t *cr) {
+    set_font(cr, FONT_BOLD, FONT_SIZE_TIME);
+}
@@ -55,6 +55,15 @@
 #define ICON_LUNCH "\ue56c"        // Lunch icon
 #define ICON_DINNER "\uea57"       // Dinner icon
 
+// Dashboard sections (bitmask for selective re-rendering)
+typedef enum {
+    SECTION_HEADER = 1 << 0,
+    SECTION_WEATHER = 1 << 1,
+    SECTION_MENU = 1 << 2,
+    SECTION_CALENDAR = 1 << 3,
+    SECTION_ALL = SECTION_HEADER | SECTION_WEATHER | SECTION_MENU | SECTION_CALENDAR
+} DashboardSection;
+
 // Text alignment
 typedef enum {
     ALIGN_LEFT,
@@ -82,6 +91,26 @@ void render_dashboard_to_surface(cairo_surface_t *surface, time_t display_date,
                                 const MenuData *menu_data,
                                 const CalendarData *calendar_data);
 
+// Refresh only the selected sections (bitmask of DashboardSection) in place; each one is
+// composited from a retained layer that is redrawn only when its data changed
+void render_dashboard_sections(cairo_surface_t *surface, unsigned int sections, time_t display_date,
+                               const WeatherData *weather_data,
+                               const MenuData *menu_data,
+                               const CalendarData *calendar_data);
+
+// Mark every section layer stale, so the next render redraws all sections
+void invalidate_dashboard_layers(void);
+
+// Free the retained section layers
+void release_dashboard_layers(void);
+
+// Get portrait layout bounds of a single section (returns 1 on success, 0 if unknown or not shown)
+int get_section_bounds(DashboardSection section, int *x, int *y, int *width, int *height);
+
+// Select and order the sections shown below the header, e.g. "calendar,weather" (render profile)
+// Call before the first render. Returns 1 on success, 0 on an invalid list
+int configure_dashboard_layout(const char *sections);
+
 // Individual section renderers
 void draw_header_section(cairo_t *cr, time_t display_date);
 void draw_weather_section(cairo_t *cr, const WeatherData *weather_data);
@@ -91,4 +120,7 @@ void draw_calendar_section(cairo_t *cr, const CalendarData *calendar_data);
 // Clock rendering for partial updates
 int render_clock_to_surface(cairo_t *cr, time_t current_time, int width, int height);
 
+// Select the clock font (bold, FONT_SIZE_TIME, black) on a Cairo context
+void set_clock_font(cairo_t *cr);
+
 #endif // DASHBOARD_RENDER_H
\ No newline at end of file
@@ -1,13 +1,20 @@
 #define _GNU_SOURCE
 #include "display_dashboard.h"
 #include "dashboard_render.h"
+#include "eink_regions.h"
+#include "pixel_convert.h"
+#include "dither.h"
+#include "clock_strip.h"
 #include "logging.h"
+#include "time_service.h"
+#include "metrics.h"
 #include <cairo.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
 #include <math.h>
+#include <pthread.h>
 
 // Waveshare e-ink includes
 #include "EPD_7in5_V2.h"
@@ -15,6 +22,9 @@
 #include "GUI_BMPfile.h"
 #include "DEV_Config.h"
 #include "fonts.h"
+#ifdef USE_LGPIO_LIB
+#include <lgpio.h>
+#endif
 
 // ====================== CONSTANTS ======================
 
@@ -23,6 +33,10 @@
 #define BMP_BITS_PER_PIXEL 1
 #define BMP_COLOR_TABLE_SIZE 8  // 2 colors × 4 bytes each
 
+// Packed 1-bit e-ink frame layout (landscape, top-down rows)
+#define EPD_FRAME_ROW_BYTES ((EPD_7IN5_V2_WIDTH % 8 == 0) ? (EPD_7IN5_V2_WIDTH / 8) : (EPD_7IN5_V2_WIDTH / 8 + 1))
+#define EPD_FRAME_SIZE (EPD_FRAME_ROW_BYTES * EPD_7IN5_V2_HEIGHT)
+
 
 // ====================== GLOBAL STATE ======================
 
@@ -39,6 +53,54 @@ typedef enum {
 
 static EinkMode current_eink_mode = EINK_MODE_NONE;
 
+// Panel power state (the controller mode above survives a power-off, not a deep sleep)
+static EinkPower current_eink_power = EINK_POWER_ON;
+static int panel_ram_stale = 0;     // Controller lost its previous-frame RAM: next partial sends the whole frame
+
+// Controller commands sent outside the vendor driver (UC8179 command set)
+#define EPD_CMD_POWER_OFF 0x02
+#define EPD_CMD_POWER_ON 0x04
+
+// Long-lived full-frame buffer (allocated once, reused for every refresh)
+static UBYTE *eink_frame_buffer = NULL;
+static UBYTE *luma_scratch_buffer = NULL;          // Rotated 8-bit luma plane used during conversion
+
+// Region-based refresh state
+static cairo_surface_t *dashboard_surface = NULL;  // Persistent render target (sections re-rendered in place)
+static UBYTE *last_frame_buffer = NULL;            // Frame content currently shown on the panel
+static UBYTE *window_buffer = NULL;                // Compact buffer for partial window transfers
+static int last_frame_valid = 0;
+static int last_frame_yday = -1;                   // Day of year of the last header render
+static int surface_complete = 0;                   // Every section rendered into dashboard_surface at least once
+static GhostingPolicy ghosting_policy = {
+    GHOSTING_DEFAULT_FULL_EVERY, GHOSTING_DEFAULT_NIGHTLY_HOUR, 0, 0
+};
+
+// Per-section quantizer: text stays crisp, only the weather icons pay for diffusion
+#define FRAME_DITHER_MODE DITHER_THRESHOLD  // Borders, separators and anything outside sections
+static const DashboardSection dither_sections[] = {
+    SECTION_HEADER, SECTION_WEATHER, SECTION_MENU, SECTION_CALENDAR
+};
+static DitherMode section_dither[] = {
+    DITHER_THRESHOLD, DITHER_FLOYD_STEINBERG, DITHER_THRESHOLD, DITHER_THRESHOLD
+};
+#define DITHER_SECTION_COUNT ((int)(sizeof(dither_sections) / sizeof(dither_sections[0])))
+
+// Frame restored from the state file before the hardware is initialized (eink_restore_frame)
+typedef enum {
+    RESTORE_NONE,
+    RESTORE_SHOWN,      // Panel still shows the frame (crash or power loss): init skips the clear
+    RESTORE_REDRAW      // Panel was cleared at shutdown: init puts the frame back with one full refresh
+} FrameRestore;
+static FrameRestore frame_restore = RESTORE_NONE;
+
+// BUSY line (low while the controller refreshes); the lgpio edge alert wakes waiters on release
+static pthread_mutex_t busy_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t busy_released = PTHREAD_COND_INITIALIZER;
+static int busy_alert_armed = 0;
+#define BUSY_RECHECK_MS 250     // Re-read the line this often in case an edge was missed
+#define BUSY_POLL_MS 10         // Polling fallback when alerts could not be claimed
+
 // Partial display state
 static UBYTE *time_image_buffer = NULL;
 static int partial_display_initialized = 0;
@@ -65,84 +127,54 @@ static void write_le16(unsigned char *buffer, int offset, int value) {
 }
 
 /**
- * Write RGB24 Cairo surface as monochrome BMP without rotation
+ * Convert Cairo surface to packed 1-bit e-ink frame (1 = white, MSB first)
+ * Rotates 90° clockwise to convert portrait (480x800) to landscape (800x480)
+ * Returns: 1 on success, 0 on failure
  */
-static int write_surface_as_bmp_no_rotate(cairo_surface_t *surface, const char *filename) {
+static int convert_surface_to_frame(cairo_surface_t *surface, UBYTE *frame) {
     int width = cairo_image_surface_get_width(surface);
     int height = cairo_image_surface_get_height(surface);
     unsigned char *data = cairo_image_surface_get_data(surface);
     int stride = cairo_image_surface_get_stride(surface);
     
-    FILE *f = fopen(filename, "wb");
-    if (!f) {
-        LOG_ERROR("❌ Failed to create BMP file: %s", filename);
+    if (!data || height != EPD_7IN5_V2_WIDTH || width != EPD_7IN5_V2_HEIGHT) {
+        LOG_ERROR("❌ Surface size %dx%d does not match e-ink frame", width, height);
         return 0;
     }
     
-    // Calculate row padding (rows must be aligned to 4 bytes)
-    int bits_per_row = width;
-    int bytes_per_row = (bits_per_row + 7) / 8;
-    int row_padded = (bytes_per_row + 3) & (~3);
-    int pixel_data_size = row_padded * height;
-    int file_size = BMP_HEADER_SIZE + pixel_data_size;
+    if (!luma_scratch_buffer) {
+        LOG_ERROR("❌ Luma scratch buffer not allocated");
+        return 0;
+    }
     
-    // Create BMP header
-    unsigned char bmp_header[BMP_HEADER_SIZE] = {0};
-    bmp_header[0] = 'B'; bmp_header[1] = 'M';
-    write_le32(bmp_header, 2, file_size);
-    write_le32(bmp_header, 10, BMP_HEADER_SIZE);
-    write_le32(bmp_header, 14, 40);
-    write_le32(bmp_header, 18, width);
-    write_le32(bmp_header, 22, height);
-    write_le16(bmp_header, 26, 1);
-    write_le16(bmp_header, 28, 1);
-    write_le32(bmp_header, 34, pixel_data_size);
-    write_le32(bmp_header, 46, 2);
-    write_le32(bmp_header, 50, 2);
-    
-    // Color table: Black and White
-    bmp_header[58] = 0xFF; bmp_header[59] = 0xFF; bmp_header[60] = 0xFF;
-    
-    fwrite(bmp_header, 1, BMP_HEADER_SIZE, f);
-    
-    // Write pixel data (no rotation, convert RGB24 to monochrome with Floyd-Steinberg dithering)
-    unsigned char *row_data = malloc(row_padded);
+    // Tiled rotate + fixed-point grayscale into the luma plane
+    uint64_t started = metrics_start();
+    pixel_luma_rotate(data, width, height, stride, luma_scratch_buffer);
     
-    for (int y = height - 1; y >= 0; y--) {
-        memset(row_data, 0, row_padded);
-        for (int x = 0; x < width; x++) {
-            int cairo_offset = y * stride + x * 4;
-            unsigned char blue = data[cairo_offset];
-            unsigned char green = data[cairo_offset + 1];
-            unsigned char red = data[cairo_offset + 2];
-            
-            // Convert to grayscale and quantize with improved threshold
-            float gray = 0.299f * red + 0.587f * green + 0.114f * blue;
-            // Use a more conservative threshold to avoid antialiasing artifacts
-            int bit_value = (gray > 192) ? 1 : 0;
-            
-            int byte_index = x / 8;
-            int bit_index = 7 - (x % 8);
-            if (bit_value) {
-                row_data[byte_index] |= (1 << bit_index);
-            }
+    // Cheap threshold everywhere, then re-quantize sections that asked for another mode
+    EinkRect whole_frame = {0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT};
+    dither_region(luma_scratch_buffer, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, FRAME_DITHER_MODE,
+                  whole_frame, frame, EPD_FRAME_ROW_BYTES);
+    
+    for (int i = 0; i < DITHER_SECTION_COUNT; i++) {
+        if (section_dither[i] == FRAME_DITHER_MODE) {
+            continue;
         }
-        fwrite(row_data, 1, row_padded, f);
+        EinkRect rect = eink_section_rect(dither_sections[i], EPD_7IN5_V2_HEIGHT);
+        dither_region(luma_scratch_buffer, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, section_dither[i],
+                      rect, frame, EPD_FRAME_ROW_BYTES);
     }
     
-    free(row_data);
-    fclose(f);
+    metrics_observe(METRIC_PIXEL_CONVERT, started);
     return 1;
 }
 
 /**
- * Write Cairo surface as monochrome BMP file (1-bit, compatible with e-ink)
+ * Write packed 1-bit e-ink frame as monochrome BMP file (debug output)
  */
-static int write_surface_as_bmp(cairo_surface_t *surface, const char *filename) {
-    int width = cairo_image_surface_get_width(surface);
-    int height = cairo_image_surface_get_height(surface);
-    unsigned char *data = cairo_image_surface_get_data(surface);
-    int stride = cairo_image_surface_get_stride(surface);
+static int write_frame_as_bmp(const UBYTE *frame, const char *filename) {
+    int width = EPD_7IN5_V2_WIDTH;
+    int height = EPD_7IN5_V2_HEIGHT;
     
     FILE *f = fopen(filename, "wb");
     if (!f) {
@@ -151,9 +183,7 @@ static int write_surface_as_bmp(cairo_surface_t *surface, const char *filename)
     }
     
     // Calculate row padding for 1-bit bitmap (rows must be aligned to 4 bytes)
-    int bits_per_row = width;
-    int bytes_per_row = (bits_per_row + 7) / 8;  // Round up to nearest byte
-    int row_padded = (bytes_per_row + 3) & (~3); // Align to 4-byte boundary
+    int row_padded = (EPD_FRAME_ROW_BYTES + 3) & (~3);
     int pixel_data_size = row_padded * height;
     int file_size = BMP_HEADER_SIZE + pixel_data_size;
     
@@ -181,16 +211,10 @@ static int write_surface_as_bmp(cairo_surface_t *surface, const char *filename)
     write_le32(bmp_header, 50, 2);                  // Important colors (2)
     
     // Color table (8 bytes: 2 colors × 4 bytes each, BGRA format)
-    // Color 0: Black (0x00000000)
-    bmp_header[54] = 0x00; // Blue
-    bmp_header[55] = 0x00; // Green  
-    bmp_header[56] = 0x00; // Red
-    bmp_header[57] = 0x00; // Alpha
-    // Color 1: White (0x00FFFFFF)
+    // Color 0: Black (0x00000000), Color 1: White (0x00FFFFFF)
     bmp_header[58] = 0xFF; // Blue
     bmp_header[59] = 0xFF; // Green
     bmp_header[60] = 0xFF; // Red
-    bmp_header[61] = 0x00; // Alpha
     
     if (fwrite(bmp_header, 1, BMP_HEADER_SIZE, f) != BMP_HEADER_SIZE) {
         LOG_ERROR("❌ Failed to write BMP header");
@@ -198,187 +222,149 @@ static int write_surface_as_bmp(cairo_surface_t *surface, const char *filename)
         return 0;
     }
     
-    // Allocate row buffer
-    unsigned char *row_data = malloc(row_padded);
-    if (!row_data) {
-        LOG_ERROR("❌ Failed to allocate row buffer");
-        fclose(f);
-        return 0;
-    }
-    
-    // Calculate rotated dimensions for buffer allocation
-    int rotated_width_for_buffer = height;   // Will be used for rotated image
-    
-    // Create error diffusion buffer for dithering (sized for rotated image)
-    float *error_buffer = calloc(rotated_width_for_buffer + 2, sizeof(float)); // +2 for boundary handling
-    if (!error_buffer) {
-        LOG_ERROR("❌ Failed to allocate error buffer for dithering");
-        free(row_data);
-        fclose(f);
-        return 0;
-    }
-    
-    // Write pixel data (BMP is bottom-up, 1-bit packed format with Floyd-Steinberg dithering)
-    // Rotate image 90° clockwise to convert portrait (480x800) to landscape (800x480)
-    int rotated_width = height;   // Rotated width = original height
-    int rotated_height = width;   // Rotated height = original width
-    int rotated_bytes_per_row = (rotated_width + 7) / 8;
-    int rotated_row_padded = (rotated_bytes_per_row + 3) & (~3);
-    
-    // Update file size for rotated dimensions
-    fseek(f, 2, SEEK_SET);
-    int rotated_pixel_data_size = rotated_row_padded * rotated_height;
-    int rotated_file_size = BMP_HEADER_SIZE + rotated_pixel_data_size;
-    write_le32((unsigned char*)&rotated_file_size, 0, rotated_file_size);
-    fwrite(&rotated_file_size, 4, 1, f);
-    
-    // Update width/height in header
-    fseek(f, 18, SEEK_SET);
-    write_le32((unsigned char*)&rotated_width, 0, rotated_width);
-    fwrite(&rotated_width, 4, 1, f);
-    write_le32((unsigned char*)&rotated_height, 0, rotated_height);
-    fwrite(&rotated_height, 4, 1, f);
-    
-    // Update image size in header
-    fseek(f, 34, SEEK_SET);
-    write_le32((unsigned char*)&rotated_pixel_data_size, 0, rotated_pixel_data_size);
-    fwrite(&rotated_pixel_data_size, 4, 1, f);
-    
-    // Seek back to data section
-    fseek(f, BMP_HEADER_SIZE, SEEK_SET);
-    
-    // Reallocate row buffer for rotated dimensions
-    free(row_data);
-    row_data = malloc(rotated_row_padded);
-    if (!row_data) {
-        LOG_ERROR("❌ Failed to allocate rotated row buffer");
-        free(error_buffer);
-        fclose(f);
-        return 0;
-    }
-    
-    // Write rotated pixel data (BMP is bottom-up)
-    for (int y = rotated_height - 1; y >= 0; y--) {
-        // Clear row buffer
-        memset(row_data, 0, rotated_row_padded);
-        
-        // Reset error buffer for new row (only reset current and next pixel)
-        for (int i = 0; i < rotated_width + 2; i++) {
-            error_buffer[i] = 0.0f;
-        }
-        
-        // Convert rotated coordinates back to original image coordinates
-        for (int x = 0; x < rotated_width; x++) {
-            // Rotation mapping: rotated(x,y) = original(original_width-1-y, x)
-            int orig_x = width - 1 - y;   // Original x from rotated y
-            int orig_y = x;               // Original y from rotated x
-            
-            // Skip if outside original bounds
-            if (orig_x < 0 || orig_x >= width || orig_y < 0 || orig_y >= height) {
-                continue;
-            }
-            
-            int cairo_offset = orig_y * stride + orig_x * 4;
-            
-            // Get RGB values from Cairo ARGB32 format: B-G-R-A
-            unsigned char blue = data[cairo_offset];
-            unsigned char green = data[cairo_offset + 1];
-            unsigned char red = data[cairo_offset + 2];
-            
-            // Convert to grayscale using standard weights
-            float gray = 0.299f * red + 0.587f * green + 0.114f * blue;
-            
-            // Apply accumulated error from previous pixels
-            gray += error_buffer[x + 1]; // +1 for boundary offset
-            
-            // Clamp to valid range
-            if (gray < 0) gray = 0;
-            if (gray > 255) gray = 255;
-            
-            // Quantize: > 128 = white (255), <= 128 = black (0)
-            int quantized = (gray > 128) ? 255 : 0;
-            int bit_value = (quantized > 0) ? 1 : 0;
-            
-            // Calculate quantization error
-            float error = gray - quantized;
-            
-            // Distribute error to neighboring pixels (Floyd-Steinberg pattern)
-            if (x + 1 < rotated_width) {
-                error_buffer[x + 2] += error * 7.0f / 16.0f; // Right pixel
-            }
-            
-            // Pack into bit array (MSB first)
-            int byte_index = x / 8;
-            int bit_index = 7 - (x % 8);
-            
-            if (bit_value) {
-                row_data[byte_index] |= (1 << bit_index);
-            }
-        }
-        
-        if (fwrite(row_data, 1, rotated_row_padded, f) != (size_t)rotated_row_padded) {
+    // Write pixel data (BMP is bottom-up)
+    unsigned char padding[4] = {0};
+    for (int y = height - 1; y >= 0; y--) {
+        if (fwrite(frame + y * EPD_FRAME_ROW_BYTES, 1, EPD_FRAME_ROW_BYTES, f) != EPD_FRAME_ROW_BYTES ||
+            fwrite(padding, 1, row_padded - EPD_FRAME_ROW_BYTES, f) != (size_t)(row_padded - EPD_FRAME_ROW_BYTES)) {
             LOG_ERROR("❌ Failed to write BMP row data");
-            free(error_buffer);
-            free(row_data);
             fclose(f);
             return 0;
         }
     }
     
-    free(error_buffer);
-    
-    free(row_data);
     fclose(f);
     return 1;
 }
 
 /**
- * Generate dashboard as BMP file for e-ink display
+ * Allocate the long-lived e-ink frame buffers shared by all refreshes
+ * Returns: 0 on success, -1 on failure
  */
-int generate_dashboard_bmp(const char *filename, time_t display_date, 
-                          const WeatherData *weather_data, 
-                          const MenuData *menu_data, 
-                          const CalendarData *calendar_data) {
+static int init_frame_buffer(void) {
+    if (eink_frame_buffer) {
+        return 0; // Already allocated
+    }
     
-    if (!filename) {
-        LOG_ERROR("❌ Invalid filename for BMP generation");
-        return 0;
+    eink_frame_buffer = (UBYTE *)malloc(EPD_FRAME_SIZE);
+    last_frame_buffer = (UBYTE *)malloc(EPD_FRAME_SIZE);
+    window_buffer = (UBYTE *)malloc(EPD_FRAME_SIZE);
+    luma_scratch_buffer = (UBYTE *)malloc(EPD_7IN5_V2_WIDTH * EPD_7IN5_V2_HEIGHT);
+    if (!eink_frame_buffer || !last_frame_buffer || !window_buffer || !luma_scratch_buffer) {
+        LOG_ERROR("❌ Failed to allocate e-ink frame buffers (3 x %d bytes + luma plane)", EPD_FRAME_SIZE);
+        free(eink_frame_buffer);
+        free(last_frame_buffer);
+        free(window_buffer);
+        free(luma_scratch_buffer);
+        eink_frame_buffer = last_frame_buffer = window_buffer = luma_scratch_buffer = NULL;
+        return -1;
+    }
+    
+    LOG_DEBUG("🔧 Pixel conversion backend: %s", pixel_convert_backend());
+    
+    memset(eink_frame_buffer, 0xFF, EPD_FRAME_SIZE);
+    memset(last_frame_buffer, 0xFF, EPD_FRAME_SIZE);
+    last_frame_valid = 0;
+    return 0;
+}
+
+/**
+ * Release frame buffers, the persistent dashboard surface and its section layers
+ */
+static void release_frame_buffers(void) {
+    free(eink_frame_buffer);
+    free(last_frame_buffer);
+    free(window_buffer);
+    free(luma_scratch_buffer);
+    eink_frame_buffer = last_frame_buffer = window_buffer = luma_scratch_buffer = NULL;
+    last_frame_valid = 0;
+    
+    if (dashboard_surface) {
+        cairo_surface_destroy(dashboard_surface);
+        dashboard_surface = NULL;
+        surface_complete = 0;
+    }
+    release_dashboard_layers();
+}
+
+/**
+ * Get the persistent dashboard surface, creating it on first use
+ * Returns: surface on success, NULL on failure
+ */
+static cairo_surface_t* get_dashboard_surface(void) {
+    if (dashboard_surface) {
+        return dashboard_surface;
     }
     
-    // Create surface in RGB24 format for BMP compatibility
+    // Create surface in RGB24 format for monochrome conversion
     cairo_surface_t *surface = cairo_image_surface_create(CAIRO_FORMAT_RGB24, EINK_WIDTH, EINK_HEIGHT);
     if (cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS) {
-        LOG_ERROR("❌ Failed to create Cairo surface for BMP generation");
-        return 0;
+        LOG_ERROR("❌ Failed to create Cairo surface for dashboard");
+        cairo_surface_destroy(surface);
+        return NULL;
     }
     
-    cairo_t *cr = cairo_create(surface);
-    if (cairo_status(cr) != CAIRO_STATUS_SUCCESS) {
-        LOG_ERROR("❌ Failed to create Cairo context for BMP generation");
-        cairo_surface_destroy(surface);
-        return 0;
+    dashboard_surface = surface;
+    return dashboard_surface;
+}
+
+/**
+ * Render the selected dashboard sections into the persistent surface
+ * Returns: surface on success, NULL on failure
+ */
+static cairo_surface_t* render_dashboard_surface(unsigned int sections, time_t display_date,
+                                                 const WeatherData *weather_data,
+                                                 const MenuData *menu_data,
+                                                 const CalendarData *calendar_data) {
+    cairo_surface_t *surface = get_dashboard_surface();
+    if (!surface) {
+        return NULL;
     }
     
     // Initialize fonts
     if (!init_dashboard_fonts()) {
-        LOG_ERROR("❌ Failed to initialize fonts for BMP generation");
-        cairo_destroy(cr);
-        cairo_surface_destroy(surface);
-        return 0;
+        LOG_ERROR("❌ Failed to initialize fonts for dashboard");
+        return NULL;
     }
     
-    // Render dashboard to surface
-    render_dashboard_to_surface(surface, display_date, weather_data, menu_data, calendar_data);
+    // Render dashboard sections to surface
+    render_dashboard_sections(surface, sections, display_date, weather_data, menu_data, calendar_data);
+    if ((sections & SECTION_ALL) == SECTION_ALL) {
+        surface_complete = 1;
+    }
     
     // Ensure all drawing operations are completed
     cairo_surface_flush(surface);
     
-    // Write as BMP
-    int success = write_surface_as_bmp(surface, filename);
+    return surface;
+}
+
+/**
+ * Generate dashboard as BMP file (debug mode only, production uses update_dashboard_on_eink)
+ */
+int generate_dashboard_bmp(const char *filename, time_t display_date, 
+                          const WeatherData *weather_data, 
+                          const MenuData *menu_data, 
+                          const CalendarData *calendar_data) {
+    
+    if (!filename) {
+        LOG_ERROR("❌ Invalid filename for BMP generation");
+        return 0;
+    }
+    
+    if (init_frame_buffer() != 0) {
+        return 0;
+    }
     
-    // Cleanup Cairo objects
-    cairo_destroy(cr);
-    cairo_surface_destroy(surface);
+    cairo_surface_t *surface = render_dashboard_surface(SECTION_ALL, display_date,
+                                                        weather_data, menu_data, calendar_data);
+    if (!surface) {
+        return 0;
+    }
+    
+    // Pack into frame buffer and write as BMP
+    int success = convert_surface_to_frame(surface, eink_frame_buffer) &&
+                  write_frame_as_bmp(eink_frame_buffer, filename);
     
     if (success) {
         LOG_INFO("✅ Dashboard BMP generated successfully: %s", filename);
@@ -391,8 +377,18 @@ int generate_dashboard_bmp(const char *filename, time_t display_date,
 
 // ====================== E-INK MODE MANAGEMENT ======================
 
+// One command byte on the panel bus (same sequence as the vendor driver's EPD_SendCommand)
+static void send_panel_command(UBYTE command) {
+    DEV_Digital_Write(EPD_DC_PIN, 0);
+    DEV_Digital_Write(EPD_CS_PIN, 0);
+    DEV_SPI_WriteByte(command);
+    DEV_Digital_Write(EPD_CS_PIN, 1);
+}
+
 /**
  * Switch e-ink to the specified mode only if not already in that mode
+ * Wakes the panel on the way: a powered-off panel in the right mode only needs a
+ * power-on command; after a deep sleep the mode is gone and Init runs (reset included).
  * Returns: 0 on success, -1 on failure
  */
 static int switch_eink_mode(RefreshType refresh_type) {
@@ -418,13 +414,22 @@ static int switch_eink_mode(RefreshType refresh_type) {
             return -1;
     }
     
-    // Skip if already in target mode
+    // Skip if already in target mode (powering on again after an idle power-off)
+    uint64_t started = metrics_start();
     if (current_eink_mode == target_mode) {
+        if (current_eink_power == EINK_POWER_OFF) {
+            send_panel_command(EPD_CMD_POWER_ON);
+            if (eink_wait_idle(EINK_BUSY_TIMEOUT_MS) != 0) {
+                eink_force_reinit();
+                return -1;
+            }
+            current_eink_power = EINK_POWER_ON;
+            metrics_observe(METRIC_PANEL_WAKE, started);
+        }
         return 0;
     }
     
-    
-    // Perform mode switch
+    // Perform mode switch (each init waits for the panel's BUSY line)
     switch (target_mode) {
         case EINK_MODE_FULL:
             if (EPD_7IN5_V2_Init() != 0) {
@@ -451,12 +456,144 @@ static int switch_eink_mode(RefreshType refresh_type) {
             return -1;
     }
     
+    metrics_observe(current_eink_power == EINK_POWER_DEEP_SLEEP ? METRIC_PANEL_WAKE : METRIC_PANEL_INIT, started);
+    metrics_count(target_mode == EINK_MODE_FULL ? METRIC_MODE_SWITCH_FULL :
+                  target_mode == EINK_MODE_FAST ? METRIC_MODE_SWITCH_FAST : METRIC_MODE_SWITCH_PARTIAL);
+    LOG_DEBUG("🖥️  E-ink controller switched to %s mode", mode_name);
     current_eink_mode = target_mode;
+    current_eink_power = EINK_POWER_ON;     // Every Init powers the panel on
     return 0;
 }
 
+// ====================== PANEL BUSY LINE ======================
+
+#ifdef USE_LGPIO_LIB
+// lgpio alert thread: wake every waiter when BUSY goes high (panel idle)
+static void busy_alert(int num_alerts, lgGpioAlert_p alerts, void *userdata __attribute__((unused))) {
+    for (int i = 0; i < num_alerts; i++) {
+        if (alerts[i].report.level == 1) {
+            pthread_mutex_lock(&busy_mutex);
+            pthread_cond_broadcast(&busy_released);
+            pthread_mutex_unlock(&busy_mutex);
+            return;
+        }
+    }
+}
+#endif
+
+/**
+ * Watch the BUSY line for rising edges (falls back to short polling when alerts are unavailable)
+ */
+static void arm_busy_alert(void) {
+#ifdef USE_LGPIO_LIB
+    if (lgGpioClaimAlert(GPIO_Handle, 0, LG_RISING_EDGE, EPD_BUSY_PIN, -1) >= 0 &&
+        lgGpioSetAlertsFunc(GPIO_Handle, EPD_BUSY_PIN, busy_alert, NULL) >= 0) {
+        busy_alert_armed = 1;
+        return;
+    }
+#endif
+    busy_alert_armed = 0;
+    LOG_DEBUG("🔧 BUSY edge alerts unavailable, idle waits poll the line");
+}
+
+static void disarm_busy_alert(void) {
+#ifdef USE_LGPIO_LIB
+    if (busy_alert_armed) {
+        lgGpioSetAlertsFunc(GPIO_Handle, EPD_BUSY_PIN, NULL, NULL);
+    }
+#endif
+    busy_alert_armed = 0;
+}
+
+static long long realtime_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/**
+ * Block until the panel releases BUSY (edge-triggered, no fixed delay)
+ * Returns: 0 when idle, -1 on timeout
+ */
+int eink_wait_idle(int timeout_ms) {
+    if (!eink_hardware_initialized) {
+        return 0;
+    }
+    
+    long long deadline_ms = realtime_ms() + timeout_ms;
+    int result = 0;
+    
+    // The line is read under busy_mutex, so a release between the read and the wait is not lost
+    pthread_mutex_lock(&busy_mutex);
+    while (!DEV_Digital_Read(EPD_BUSY_PIN)) {
+        long long now_ms = realtime_ms();
+        if (now_ms >= deadline_ms) {
+            result = -1;
+            break;
+        }
+        
+        long long wake_ms = now_ms + (busy_alert_armed ? BUSY_RECHECK_MS : BUSY_POLL_MS);
+        if (wake_ms > deadline_ms) wake_ms = deadline_ms;
+        struct timespec wake = { (time_t)(wake_ms / 1000), (long)(wake_ms % 1000) * 1000000L };
+        pthread_cond_timedwait(&busy_released, &busy_mutex, &wake);
+    }
+    pthread_mutex_unlock(&busy_mutex);
+    
+    if (result != 0) {
+        LOG_ERROR("❌ E-ink panel still busy after %d ms", timeout_ms);
+    }
+    return result;
+}
+
+/**
+ * Forget the current controller mode so the next refresh re-runs its Init (hardware reset included)
+ */
+void eink_force_reinit(void) {
+    current_eink_mode = EINK_MODE_NONE;
+    panel_ram_stale = 1;
+}
+
+// ====================== PANEL POWER STATE ======================
+
+EinkPower eink_power_state(void) {
+    return current_eink_power;
+}
+
+/**
+ * Turn the booster off between refreshes; registers and frame RAM are kept
+ */
+void eink_power_off(void) {
+    if (!eink_hardware_initialized || current_eink_power != EINK_POWER_ON) {
+        return;
+    }
+    
+    send_panel_command(EPD_CMD_POWER_OFF);
+    eink_wait_idle(EINK_BUSY_TIMEOUT_MS);
+    current_eink_power = EINK_POWER_OFF;
+    metrics_count(METRIC_PANEL_POWER_OFF);
+    LOG_DEBUG("💤 E-ink panel powered off (idle)");
+}
+
+/**
+ * Deep sleep for long idle windows; the controller forgets its mode and frame RAM
+ */
+void eink_deep_sleep(void) {
+    if (!eink_hardware_initialized || current_eink_power == EINK_POWER_DEEP_SLEEP) {
+        return;
+    }
+    
+    EPD_7IN5_V2_Sleep();
+    current_eink_power = EINK_POWER_DEEP_SLEEP;
+    current_eink_mode = EINK_MODE_NONE;
+    panel_ram_stale = 1;
+    metrics_count(METRIC_PANEL_DEEP_SLEEP);
+    LOG_DEBUG("💤 E-ink panel in deep sleep (long idle)");
+}
+
 // ====================== E-INK HARDWARE MANAGEMENT ======================
 
+static int push_frame_to_eink(UBYTE *frame, RefreshType refresh_type);
+
 /**
  * Initialize Waveshare e-ink hardware and set initial mode
  * Returns: 0 on success, -1 on failure
@@ -480,12 +617,22 @@ int init_eink_hardware(void) {
         DEV_Module_Exit();
         return -1;
     }
-    
-    // Clear display to ensure known state
-    EPD_7IN5_V2_Clear();
+    arm_busy_alert();
     
     eink_hardware_initialized = 1;
     current_eink_mode = EINK_MODE_FULL; // Track that we're in full mode after Init()
+    
+    // Clear display to ensure known state, unless a restored frame is (or goes back) on screen
+    if (frame_restore == RESTORE_SHOWN) {
+        panel_ram_stale = 1;    // The reset wiped the controller's copy of it
+        LOG_INFO("🖥️  Keeping the frame left on the panel (no clear)");
+    } else if (frame_restore == RESTORE_REDRAW) {
+        push_frame_to_eink(last_frame_buffer, REFRESH_FULL);
+    } else {
+        EPD_7IN5_V2_Clear();
+    }
+    frame_restore = RESTORE_NONE;
+    
     LOG_INFO("✅ E-ink hardware initialized successfully");
     return 0;
 }
@@ -498,19 +645,270 @@ void cleanup_eink_hardware(void) {
         LOG_INFO("🧹 Cleaning up e-ink hardware...");
 
         // Clear display before sleep to prevent burn-in during long shutdown periods
+        // (an idle power-off or deep sleep is woken first)
+        if (current_eink_power != EINK_POWER_ON) {
+            switch_eink_mode(REFRESH_FULL);
+        }
         EPD_7IN5_V2_Clear();
-        DEV_Delay_ms(1000);  // Allow clear operation to complete
+        eink_wait_idle(EINK_BUSY_TIMEOUT_MS);  // Allow clear operation to complete
 
         // Put display to sleep
         EPD_7IN5_V2_Sleep();
         
         // Exit device module
+        disarm_busy_alert();
         DEV_Module_Exit();
         
         eink_hardware_initialized = 0;
         current_eink_mode = EINK_MODE_NONE;  // Reset mode tracking
+        current_eink_power = EINK_POWER_ON;
         LOG_INFO("✅ E-ink hardware cleanup completed");
     }
+    
+    // Release long-lived frame buffers (also allocated in debug mode)
+    release_frame_buffers();
+}
+
+/**
+ * Send the packed frame buffer to the e-ink panel with specified refresh type
+ * Returns: 0 on success, -1 on failure
+ */
+static int push_frame_to_eink(UBYTE *frame, RefreshType refresh_type) {
+    const char *refresh_names[] = {"full", "fast", "partial"};
+    
+    // Switch to the appropriate e-ink mode
+    if (switch_eink_mode(refresh_type) != 0) {
+        return -1;
+    }
+    
+    LOG_INFO("🖥️  Sending image to e-ink display (%s refresh)...", refresh_names[refresh_type]);
+    
+    uint64_t started = metrics_start();
+    if (refresh_type == REFRESH_PARTIAL) {
+        // For partial refresh, update entire screen (could be optimized to update specific regions)
+        EPD_7IN5_V2_Display_Part(frame, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
+        metrics_observe(METRIC_PANEL_PARTIAL, started);
+    } else {
+        // For full and fast refresh, use standard display method
+        EPD_7IN5_V2_Display(frame);
+        metrics_observe(METRIC_PANEL_DISPLAY, started);
+    }
+    metrics_count(refresh_type == REFRESH_FULL ? METRIC_REFRESH_FULL :
+                  refresh_type == REFRESH_FAST ? METRIC_REFRESH_FAST : METRIC_REFRESH_PARTIAL);
+    
+    // Remember what the panel now shows for region diffing
+    if (frame != last_frame_buffer) {
+        memcpy(last_frame_buffer, frame, EPD_FRAME_SIZE);
+    }
+    last_frame_valid = 1;
+    panel_ram_stale = 0;
+    if (refresh_type != REFRESH_PARTIAL) {
+        ghosting_policy_record_full(&ghosting_policy, time(NULL));
+    }
+    
+    LOG_INFO("✅ Image displayed successfully on e-ink (%s refresh)", refresh_names[refresh_type]);
+    return 0;
+}
+
+/**
+ * Push only the changed part of one panel region through a partial update
+ * Returns: 1 if a window was sent, 0 if unchanged, -1 on failure
+ */
+static int push_region_to_eink(EinkRect region) {
+    EinkRect bbox;
+    if (!eink_frame_diff(last_frame_buffer, eink_frame_buffer, EPD_FRAME_ROW_BYTES, region, &bbox)) {
+        return 0;
+    }
+    
+    if (switch_eink_mode(REFRESH_PARTIAL) != 0) {
+        return -1;
+    }
+    
+    LOG_DEBUG("🖥️  Partial update window x=%d y=%d %dx%d", bbox.x, bbox.y, bbox.width, bbox.height);
+    
+    eink_copy_window(eink_frame_buffer, EPD_FRAME_ROW_BYTES, bbox, window_buffer);
+    uint64_t started = metrics_start();
+    EPD_7IN5_V2_Display_Part(window_buffer, bbox.x, bbox.y, bbox.x + bbox.width, bbox.y + bbox.height);
+    metrics_observe(METRIC_PANEL_PARTIAL, started);
+    
+    // Update the panel mirror for the window just sent
+    int first_byte = bbox.x / 8;
+    int span = bbox.width / 8;
+    for (int y = bbox.y; y < bbox.y + bbox.height; y++) {
+        memcpy(last_frame_buffer + y * EPD_FRAME_ROW_BYTES + first_byte,
+               eink_frame_buffer + y * EPD_FRAME_ROW_BYTES + first_byte, span);
+    }
+    
+    return 1;
+}
+
+/**
+ * Display Cairo surface on e-ink screen without intermediate file I/O
+ * Returns: 0 on success, -1 on failure
+ */
+int display_surface_on_eink(cairo_surface_t *surface, RefreshType refresh_type) {
+    if (!surface || cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS) {
+        LOG_ERROR("❌ Invalid surface for e-ink display");
+        return -1;
+    }
+    
+    // Ensure hardware and frame buffer are initialized
+    if (init_eink_hardware() != 0) {
+        LOG_ERROR("❌ Failed to initialize e-ink hardware");
+        return -1;
+    }
+    if (init_frame_buffer() != 0) {
+        return -1;
+    }
+    
+    // Rotate, dither and pack straight into the frame buffer
+    cairo_surface_flush(surface);
+    if (!convert_surface_to_frame(surface, eink_frame_buffer)) {
+        return -1;
+    }
+    
+    return push_frame_to_eink(eink_frame_buffer, refresh_type);
+}
+
+/**
+ * Configure when full refreshes are forced between partial region updates
+ */
+void configure_eink_ghosting_policy(int full_every, int nightly_hour) {
+    ghosting_policy_init(&ghosting_policy, full_every, nightly_hour);
+    LOG_DEBUG("🖥️  Ghosting policy: full refresh every %d partials, nightly at %dh",
+              ghosting_policy.full_every, ghosting_policy.nightly_hour);
+}
+
+/**
+ * Select the quantizer for one or more dashboard sections
+ */
+void configure_eink_dithering(unsigned int sections, DitherMode mode) {
+    for (int i = 0; i < DITHER_SECTION_COUNT; i++) {
+        if (sections & dither_sections[i]) {
+            section_dither[i] = mode;
+            LOG_DEBUG("🖥️  Section %d dithering: %s", dither_sections[i], dither_mode_name(mode));
+        }
+    }
+}
+
+// ====================== FRAME PERSISTENCE ======================
+
+/**
+ * Panel mirror and ghosting counters, saved by the state store
+ */
+const uint8_t* eink_shown_frame(size_t *size, int *partial_count, time_t *last_full_time) {
+    if (partial_count) *partial_count = ghosting_policy.partial_count;
+    if (last_full_time) *last_full_time = ghosting_policy.last_full_time;
+    if (!last_frame_buffer || !last_frame_valid) {
+        if (size) *size = 0;
+        return NULL;
+    }
+    if (size) *size = EPD_FRAME_SIZE;
+    return last_frame_buffer;
+}
+
+/**
+ * Adopt the frame shown before a restart as the panel mirror, so the first refresh only pushes deltas
+ */
+int eink_restore_frame(const uint8_t *frame, size_t size, time_t shown_since, int panel_cleared,
+                       int partial_count, time_t last_full_time) {
+    if (!frame || size != EPD_FRAME_SIZE || eink_hardware_initialized) {
+        return -1;
+    }
+    if (init_frame_buffer() != 0) {
+        return -1;
+    }
+    
+    memcpy(last_frame_buffer, frame, EPD_FRAME_SIZE);
+    last_frame_valid = 1;
+    
+    struct tm tm_shown;
+    if (localtime_r(&shown_since, &tm_shown)) {
+        last_frame_yday = tm_shown.tm_yday;
+    }
+    ghosting_policy.partial_count = partial_count;
+    ghosting_policy.last_full_time = last_full_time;
+    frame_restore = panel_cleared ? RESTORE_REDRAW : RESTORE_SHOWN;
+    return 0;
+}
+
+/**
+ * Re-render changed sections and push only the changed panel regions
+ * Returns: number of panel updates sent (0 if nothing changed), -1 on failure
+ */
+int update_dashboard_on_eink(unsigned int changed_sections, time_t display_date,
+                             const WeatherData *weather_data,
+                             const MenuData *menu_data,
+                             const CalendarData *calendar_data,
+                             RefreshType *refresh_used) {
+    if (init_eink_hardware() != 0) {
+        LOG_ERROR("❌ Failed to initialize e-ink hardware");
+        return -1;
+    }
+    if (init_frame_buffer() != 0) {
+        return -1;
+    }
+    
+    int full = !last_frame_valid || ghosting_policy_needs_full(&ghosting_policy, display_date);
+    
+    // The header carries the date: re-render it whenever the day rolls over
+    struct tm tm_now;
+    if (localtime_r(&display_date, &tm_now) && tm_now.tm_yday != last_frame_yday) {
+        changed_sections |= SECTION_HEADER;
+        last_frame_yday = tm_now.tm_yday;
+    }
+    
+    // A restored frame has no rendered surface behind it yet: render everything, push only the deltas
+    unsigned int sections = (full || !surface_complete) ? SECTION_ALL : (changed_sections & SECTION_ALL);
+    if (!sections) {
+        return 0;
+    }
+    
+    cairo_surface_t *surface = render_dashboard_surface(sections, display_date,
+                                                        weather_data, menu_data, calendar_data);
+    if (!surface || !convert_surface_to_frame(surface, eink_frame_buffer)) {
+        return -1;
+    }
+    
+    if (full) {
+        if (refresh_used) *refresh_used = REFRESH_FULL;
+        return push_frame_to_eink(eink_frame_buffer, REFRESH_FULL) == 0 ? 1 : -1;
+    }
+    
+    // After a deep sleep the controller has no previous frame to diff against: one whole-frame partial
+    if (panel_ram_stale) {
+        if (push_frame_to_eink(eink_frame_buffer, REFRESH_PARTIAL) != 0) {
+            return -1;
+        }
+        ghosting_policy_record_partial(&ghosting_policy);
+        if (refresh_used) *refresh_used = REFRESH_PARTIAL;
+        return 1;
+    }
+    
+    // Partial path: diff each re-rendered section against what the panel shows
+    static const DashboardSection order[] = {
+        SECTION_HEADER, SECTION_WEATHER, SECTION_MENU, SECTION_CALENDAR
+    };
+    int pushed = 0;
+    for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        if (!(sections & order[i])) {
+            continue;
+        }
+        
+        int result = push_region_to_eink(eink_section_rect(order[i], EPD_7IN5_V2_HEIGHT));
+        if (result < 0) {
+            return -1;
+        }
+        pushed += result;
+    }
+    
+    if (pushed > 0) {
+        metrics_count(METRIC_REFRESH_PARTIAL);
+        ghosting_policy_record_partial(&ghosting_policy);
+        if (refresh_used) *refresh_used = REFRESH_PARTIAL;
+    }
+    
+    return pushed;
 }
 
 /**
@@ -539,46 +937,19 @@ int display_image_on_eink_with_refresh_type(const char *image_path, RefreshType
         return -1;
     }
     
-    // Switch to the appropriate e-ink mode
-    if (switch_eink_mode(refresh_type) != 0) {
+    if (init_frame_buffer() != 0) {
         return -1;
     }
     
-    // Calculate buffer size for e-ink display
-    UDOUBLE imagesize = ((EPD_7IN5_V2_WIDTH % 8 == 0) ? 
-                         (EPD_7IN5_V2_WIDTH / 8) : 
-                         (EPD_7IN5_V2_WIDTH / 8 + 1)) * EPD_7IN5_V2_HEIGHT;
-    
-    UBYTE *BlackImage = (UBYTE *)malloc(imagesize);
-    if (!BlackImage) {
-        LOG_ERROR("❌ Failed to allocate e-ink buffer (%lu bytes)", imagesize);
-        return -1;
-    }
-    
-    // Initialize Paint library with the buffer
-    Paint_NewImage(BlackImage, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
-    Paint_SelectImage(BlackImage);
+    // Initialize Paint library with the shared frame buffer
+    Paint_NewImage(eink_frame_buffer, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT, 0, WHITE);
+    Paint_SelectImage(eink_frame_buffer);
     Paint_Clear(WHITE);
     
     // Load BMP file using Waveshare's GUI_ReadBmp function
     GUI_ReadBmp(image_path, 0, 0);
     
-    // Display on e-ink using appropriate method
-    LOG_INFO("🖥️  Sending image to e-ink display (%s refresh)...", refresh_names[refresh_type]);
-    
-    if (refresh_type == REFRESH_PARTIAL) {
-        // For partial refresh, update entire screen (could be optimized to update specific regions)
-        EPD_7IN5_V2_Display_Part(BlackImage, 0, 0, EPD_7IN5_V2_WIDTH, EPD_7IN5_V2_HEIGHT);
-    } else {
-        // For full and fast refresh, use standard display method
-        EPD_7IN5_V2_Display(BlackImage);
-    }
-    
-    // Cleanup
-    free(BlackImage);
-    
-    LOG_INFO("✅ Image displayed successfully on e-ink (%s refresh)", refresh_names[refresh_type]);
-    return 0;
+    return push_frame_to_eink(eink_frame_buffer, refresh_type);
 }
 
 /**
@@ -592,7 +963,7 @@ int display_image_on_eink(const char *image_path) {
 // ====================== PARTIAL DISPLAY FUNCTIONALITY ======================
 
 /**
- * Initialize partial display buffer for fast time updates - Based on working display_time_test.c
+ * Initialize partial display buffer and clock glyph atlas for fast time updates
  * Returns: 0 on success, -1 on failure
  */
 static int init_partial_buffer(void) {
@@ -602,21 +973,20 @@ static int init_partial_buffer(void) {
 
     LOG_INFO("🔧 Initializing partial display buffer for time updates...");
     
-    // Calculate buffer size exactly like working display_time_test.c - use full display buffer
-    UDOUBLE image_size = ((EPD_7IN5_V2_WIDTH % 8 == 0) ? 
-                          (EPD_7IN5_V2_WIDTH / 8) : 
-                          (EPD_7IN5_V2_WIDTH / 8 + 1)) * EPD_7IN5_V2_HEIGHT;
+    // Glyphs are rasterized once here; minute ticks only blit them
+    if (!init_dashboard_fonts() || clock_strip_init() != 0) {
+        LOG_ERROR("❌ Failed to build clock glyph atlas");
+        return -1;
+    }
     
-    time_image_buffer = (UBYTE *)malloc(image_size);
+    time_image_buffer = (UBYTE *)malloc(CLOCK_STRIP_BUFFER_SIZE);
     if (!time_image_buffer) {
-        LOG_ERROR("❌ Failed to allocate memory for time image buffer (%lu bytes)", image_size);
+        LOG_ERROR("❌ Failed to allocate memory for time image buffer (%d bytes)", CLOCK_STRIP_BUFFER_SIZE);
         return -1;
     }
     
-    LOG_INFO("⚡ Partial display buffer initialized (%lu bytes)", image_size);
-        
     partial_display_initialized = 1;
-    LOG_INFO("✅ Partial display buffer initialized successfully");
+    LOG_INFO("✅ Partial display buffer initialized (%d bytes)", CLOCK_STRIP_BUFFER_SIZE);
     return 0;
 }
 
@@ -637,7 +1007,8 @@ int refresh_time_partial(void) {
     
     // Get current time
     time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(now, &tm_info_buf);
     if (!tm_info) {
         LOG_ERROR("❌ Failed to get current time");
         return -1;
@@ -653,61 +1024,35 @@ int refresh_time_partial(void) {
         return -1;
     }
     
-    int area_width = 120;
-    int area_height = 30;
-    int height_start = 40;
-    int width_start = (EINK_WIDTH - area_width) / 2;
-
-    // Reinitialize buffer configuration every time to ensure consistent state
-    Paint_NewImage(time_image_buffer, area_height, area_width, ROTATE_270, WHITE);
-    Paint_SelectImage(time_image_buffer);
-    Paint_Clear(WHITE);
-    
-    // Create Cairo surface for time rendering (RGB24 format for consistent rendering)
-    cairo_surface_t *time_surface = cairo_image_surface_create(CAIRO_FORMAT_RGB24, area_width, area_height - 6);
-    if (cairo_surface_status(time_surface) != CAIRO_STATUS_SUCCESS) {
-        LOG_ERROR("❌ Failed to create Cairo surface for time");
-        return -1;
-    }
-    
-    // Create Cairo context
-    cairo_t *cr = cairo_create(time_surface);
-    if (cairo_status(cr) != CAIRO_STATUS_SUCCESS) {
-        LOG_ERROR("❌ Failed to create Cairo context for time");
-        cairo_surface_destroy(time_surface);
+    // Compose the strip from the glyph atlas (no Cairo, no file round-trip)
+    if (clock_strip_render(tm_info->tm_hour, tm_info->tm_min, time_image_buffer) != 0) {
+        LOG_ERROR("❌ Failed to compose clock strip");
         return -1;
     }
     
-    // Get current time and render clock (handles fonts, background and text)
-    time_t current_time = time(NULL);
-    if (render_clock_to_surface(cr, current_time, area_width, area_height) != 0) {
-        LOG_ERROR("❌ Failed to render clock to surface");
-        cairo_destroy(cr);
-        cairo_surface_destroy(time_surface);
-        return -1;
-    }
+    // Portrait strip (x, y) maps to panel (y, EINK_WIDTH - x - width)
+    EinkRect strip = { CLOCK_STRIP_Y, EINK_WIDTH - CLOCK_STRIP_X - CLOCK_STRIP_WIDTH,
+                       CLOCK_STRIP_HEIGHT, CLOCK_STRIP_WIDTH };
     
-    // Flush and save as BMP (use RGB24 writer)
-    cairo_surface_flush(time_surface);
-    const char *temp_time_bmp = "/tmp/partial_time.bmp";
-    if (!write_surface_as_bmp_no_rotate(time_surface, temp_time_bmp)) {
-        LOG_ERROR("❌ Failed to write time BMP");
-        cairo_destroy(cr);
-        cairo_surface_destroy(time_surface);
-        return -1;
+    // Keep the panel mirror truthful so region diffs and RAM resyncs see the current clock
+    if (init_frame_buffer() == 0 && last_frame_valid) {
+        eink_paste_window(last_frame_buffer, EPD_FRAME_ROW_BYTES, strip, time_image_buffer);
+        if (panel_ram_stale) {
+            // Woken from deep sleep: the controller needs the whole frame once
+            if (push_frame_to_eink(last_frame_buffer, REFRESH_PARTIAL) != 0) {
+                return -1;
+            }
+            metrics_count(METRIC_REFRESH_CLOCK);
+            LOG_INFO("⏰ Time display updated with the whole frame after wake: %s", time_str);
+            return 0;
+        }
     }
     
-    // Cleanup Cairo objects
-    cairo_destroy(cr);
-    cairo_surface_destroy(time_surface);
-    
-    // Clear the area and load Cairo-generated BMP (load at origin to cover full area)
-    Paint_ClearWindows(0, 0, area_width, area_height, WHITE);  // Clear inside border
-    GUI_ReadBmp(temp_time_bmp, 0, 6);  // Load BMP at origin
-    
-    // Perform partial update with coordinates (Font24 with padding)
-    EPD_7IN5_V2_Display_Part(time_image_buffer, height_start, width_start, 
-                             height_start + area_height, width_start + area_width);
+    uint64_t started = metrics_start();
+    EPD_7IN5_V2_Display_Part(time_image_buffer, strip.x, strip.y,
+                             strip.x + strip.width, strip.y + strip.height);
+    metrics_observe(METRIC_PANEL_PARTIAL, started);
+    metrics_count(METRIC_REFRESH_CLOCK);
     
     LOG_INFO("⏰ Time display updated: %s", time_str);
     
@@ -721,11 +1066,12 @@ void cleanup_partial_display(void) {
     if (partial_display_initialized) {
         LOG_INFO("🧹 Cleaning up partial display resources...");
         
-        // Free image buffer
+        // Free image buffer and glyph atlas
         if (time_image_buffer) {
             free(time_image_buffer);
             time_image_buffer = NULL;
         }
+        clock_strip_cleanup();
         
         partial_display_initialized = 0;
         LOG_INFO("✅ Partial display cleanup completed");
@@ -1,12 +1,16 @@
 #ifndef DISPLAY_DASHBOARD_H
 #define DISPLAY_DASHBOARD_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include <time.h>
+#include <cairo.h>
 #include "weather.h"
 #include "menu.h"
 #include "calendar.h"
+#include "dither.h"
 
-// Main dashboard generation functions
+// Debug dashboard generation (writes BMP file, --debug mode only)
 int generate_dashboard_bmp(const char *filename, time_t display_date, 
                           const WeatherData *weather_data, 
                           const MenuData *menu_data, 
@@ -16,6 +20,53 @@ int generate_dashboard_bmp(const char *filename, time_t display_date,
 int init_eink_hardware(void);
 void cleanup_eink_hardware(void);
 
+// Longest a refresh keeps the BUSY line low (a full refresh takes about 10 s)
+#define EINK_BUSY_TIMEOUT_MS 30000
+
+/**
+ * Wait for the panel to release its BUSY line (lgpio edge alert, polling fallback)
+ * Returns: 0 when idle, -1 on timeout
+ */
+int eink_wait_idle(int timeout_ms);
+
+// Re-run the controller Init (and its hardware reset) before the next refresh
+void eink_force_reinit(void);
+
+// Panel power between refreshes
+typedef enum {
+    EINK_POWER_ON,          // Booster on, ready to refresh
+    EINK_POWER_OFF,         // Booster off, mode and frame RAM kept (woken by one command)
+    EINK_POWER_DEEP_SLEEP   // Lowest power, mode and frame RAM lost (woken by a reset and Init)
+} EinkPower;
+
+// Idle windows after the last refresh before each power step
+#define EINK_POWER_OFF_IDLE_SEC 5
+#define EINK_DEEP_SLEEP_IDLE_SEC (10 * 60)
+
+/**
+ * Power steps for idle windows; the next refresh wakes the panel on its own
+ * (the first partial after a deep sleep resends the whole frame)
+ */
+void eink_power_off(void);
+void eink_deep_sleep(void);
+EinkPower eink_power_state(void);
+
+/**
+ * Frame currently shown on the panel and the ghosting policy counters (saved across restarts)
+ * Returns: frame (size bytes, valid until the next refresh), or NULL when nothing was shown yet
+ */
+const uint8_t* eink_shown_frame(size_t *size, int *partial_count, time_t *last_full_time);
+
+/**
+ * Adopt a frame persisted before a restart; call before init_eink_hardware
+ * Init skips the clear when the panel still shows it, or puts it back with one full refresh
+ * when it was cleared at shutdown. The first refresh then renders every section but only
+ * pushes what differs from the restored frame.
+ * Returns: 0 on success, -1 when the frame does not fit the panel or the hardware is already up
+ */
+int eink_restore_frame(const uint8_t *frame, size_t size, time_t shown_since, int panel_cleared,
+                       int partial_count, time_t last_full_time);
+
 // E-ink display refresh types
 typedef enum {
     REFRESH_FULL,    // Full refresh - best quality, ~10-15 seconds (for menu/calendar updates)
@@ -24,6 +75,29 @@ typedef enum {
 } RefreshType;
 
 // E-ink display functions
+int display_surface_on_eink(cairo_surface_t *surface, RefreshType refresh_type);
+
+/**
+ * Re-render the sections in changed_sections (DashboardSection bitmask) and
+ * push only the changed panel regions through partial updates. A full refresh
+ * is used instead when the ghosting policy requires it.
+ * 
+ * Returns:
+ *   number of panel updates sent (0 if nothing changed)
+ *   -1 on failure
+ */
+int update_dashboard_on_eink(unsigned int changed_sections, time_t display_date,
+                             const WeatherData *weather_data,
+                             const MenuData *menu_data,
+                             const CalendarData *calendar_data,
+                             RefreshType *refresh_used);
+
+// Full refresh every full_every partial updates (0 = never), nightly at nightly_hour (-1 = never)
+void configure_eink_ghosting_policy(int full_every, int nightly_hour);
+
+// Quantizer used for the given sections (DashboardSection bitmask); the rest of the frame is thresholded
+void configure_eink_dithering(unsigned int sections, DitherMode mode);
+
 int display_image_on_eink(const char *image_path);
 int display_image_on_eink_with_refresh_type(const char *image_path, RefreshType refresh_type);
 
@@ -0,0 +1,259 @@
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "display_service.h"
+#include "display_dashboard.h"
+#include "dashboard_render.h"
+#include "logging.h"
+#include "metrics.h"
+#include "state_store.h"
+
+// One pending slot per request kind: a newer request supersedes the one still waiting
+typedef struct {
+    unsigned int sections;                  // 0 = no dashboard refresh pending
+    const DashboardSnapshot *snapshot;      // Newest snapshot submitted (reference owned here)
+    time_t clock_due;                       // 0 = no clock refresh pending
+} DisplayQueue;
+
+static DisplayQueue g_queue;
+static pthread_mutex_t g_queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_queue_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t g_display_thread;
+static int g_running = 0;
+
+// Minute shown by the header of the last full refresh (owned by the display thread)
+static time_t g_full_minute = 0;
+
+// End of the last panel operation, start of the idle window (owned by the display thread)
+static time_t g_last_activity = 0;
+
+// ====================== PANEL OPERATIONS ======================
+
+// Gate every panel operation on BUSY; a stuck controller is reset by the next Init
+// (in deep sleep the line is not driven, and the wake-up reset runs anyway)
+static int wait_panel_idle(void) {
+    if (eink_power_state() == EINK_POWER_DEEP_SLEEP) {
+        return 0;
+    }
+    if (eink_wait_idle(EINK_BUSY_TIMEOUT_MS) != 0) {
+        eink_force_reinit();
+        return -1;
+    }
+    return 0;
+}
+
+static void run_clock(time_t due) {
+    if (due / 60 == g_full_minute) {
+        LOG_DEBUG("⏰ Clock tick already shown by the last full refresh");
+        return;
+    }
+
+    wait_panel_idle();
+    if (refresh_time_partial() != 0) {
+        LOG_ERROR("❌ Failed to update time display via partial refresh");
+    }
+}
+
+static void run_dashboard(unsigned int sections, const DashboardSnapshot *snapshot) {
+    wait_panel_idle();
+
+    // Render with the time of the refresh, not of the request, so the header clock is current
+    time_t now = time(NULL);
+    RefreshType refresh_type = REFRESH_PARTIAL;
+    int result = update_dashboard_on_eink(sections, now, snapshot->weather, snapshot->menu,
+                                          snapshot->calendar, &refresh_type);
+
+    if (result > 0) {
+        const char *refresh_names[] = {"full", "fast", "partial"};
+        LOG_INFO("✅ E-ink display refreshed successfully (%s refresh, sections 0x%x, %d region%s, snapshot %llu)",
+                 refresh_names[refresh_type], sections, result, result > 1 ? "s" : "",
+                 (unsigned long long)snapshot->generation);
+        if (refresh_type == REFRESH_FULL) {
+            g_full_minute = now / 60;
+        }
+        display_service_save_state(snapshot, 0);
+    } else if (result == 0) {
+        LOG_DEBUG("🖥️  No visible change for sections 0x%x, panel left untouched", sections);
+    } else {
+        LOG_ERROR("❌ Failed to refresh e-ink display (sections 0x%x)", sections);
+    }
+}
+
+// ====================== DISPLAY THREAD ======================
+
+/**
+ * Next idle power step: power-off shortly after the last refresh, deep sleep after a long idle window
+ * Returns: absolute time of the step, or 0 when the panel is already in deep sleep
+ */
+static time_t next_power_step(void) {
+    switch (eink_power_state()) {
+        case EINK_POWER_ON:
+            return g_last_activity + EINK_POWER_OFF_IDLE_SEC;
+        case EINK_POWER_OFF:
+            return g_last_activity + EINK_DEEP_SLEEP_IDLE_SEC;
+        default:
+            return 0;
+    }
+}
+
+static void run_power_step(void) {
+    if (eink_power_state() == EINK_POWER_ON) {
+        eink_power_off();
+    } else if (eink_power_state() == EINK_POWER_OFF) {
+        eink_deep_sleep();
+    }
+}
+
+/**
+ * Serve the queue in the order that needs the fewest controller mode switches:
+ * the dashboard refresh first, with a pending clock tick folded into its header,
+ * then a lone clock tick in partial mode. Requests arriving during a refresh wait
+ * in their slot and merge there; idle windows step the panel power down.
+ */
+static void* display_thread(void *arg __attribute__((unused))) {
+    g_last_activity = time(NULL);
+
+    pthread_mutex_lock(&g_queue_lock);
+    while (g_running) {
+        if (!g_queue.clock_due && !g_queue.sections) {
+            time_t step = next_power_step();
+            if (!step) {
+                pthread_cond_wait(&g_queue_cond, &g_queue_lock);
+            } else if (time(NULL) < step) {
+                struct timespec deadline = { step, 0 };
+                pthread_cond_timedwait(&g_queue_cond, &g_queue_lock, &deadline);
+            } else {
+                pthread_mutex_unlock(&g_queue_lock);
+                run_power_step();
+                pthread_mutex_lock(&g_queue_lock);
+            }
+            continue;
+        }
+
+        if (g_queue.sections) {
+            unsigned int sections = g_queue.sections;
+            const DashboardSnapshot *snapshot = g_queue.snapshot;
+            if (g_queue.clock_due) {
+                // The header carries the clock: one window (or the full frame) instead of two refreshes
+                sections |= SECTION_HEADER;
+                g_queue.clock_due = 0;
+                metrics_count(METRIC_CLOCK_FOLDED);
+            }
+            g_queue.sections = 0;
+            g_queue.snapshot = NULL;
+            pthread_mutex_unlock(&g_queue_lock);
+            run_dashboard(sections, snapshot);
+            snapshot_release(snapshot);
+        } else {
+            time_t due = g_queue.clock_due;
+            g_queue.clock_due = 0;
+            pthread_mutex_unlock(&g_queue_lock);
+            run_clock(due);
+        }
+        g_last_activity = time(NULL);
+        pthread_mutex_lock(&g_queue_lock);
+    }
+    pthread_mutex_unlock(&g_queue_lock);
+    return NULL;
+}
+
+// ====================== PUBLIC API ======================
+
+int display_service_save_state(const DashboardSnapshot *snapshot, int panel_cleared) {
+    PanelState panel = { 0, 0, panel_cleared };
+    size_t frame_size = 0;
+    const uint8_t *frame = eink_shown_frame(&frame_size, &panel.partial_count, &panel.last_full_time);
+    return state_store_save(snapshot, frame, frame_size, &panel);
+}
+
+int display_service_start(void) {
+    pthread_mutex_lock(&g_queue_lock);
+    if (g_running) {
+        pthread_mutex_unlock(&g_queue_lock);
+        return 0;
+    }
+    memset(&g_queue, 0, sizeof(g_queue));
+    g_running = 1;
+    pthread_mutex_unlock(&g_queue_lock);
+
+    if (pthread_create(&g_display_thread, NULL, display_thread, NULL) != 0) {
+        LOG_ERROR("❌ Failed to start display service thread");
+        pthread_mutex_lock(&g_queue_lock);
+        g_running = 0;
+        pthread_mutex_unlock(&g_queue_lock);
+        return -1;
+    }
+
+    LOG_DEBUG("🖥️  Display service started");
+    return 0;
+}
+
+void display_service_stop(void) {
+    pthread_mutex_lock(&g_queue_lock);
+    if (!g_running) {
+        pthread_mutex_unlock(&g_queue_lock);
+        return;
+    }
+    g_running = 0;
+    pthread_cond_signal(&g_queue_cond);
+    pthread_mutex_unlock(&g_queue_lock);
+
+    pthread_join(g_display_thread, NULL);
+
+    if (g_queue.snapshot) {
+        snapshot_release(g_queue.snapshot);
+    }
+    memset(&g_queue, 0, sizeof(g_queue));
+    LOG_DEBUG("🖥️  Display service stopped");
+}
+
+int display_service_submit_dashboard(unsigned int sections, const DashboardSnapshot *snapshot) {
+    if (!snapshot) {
+        return -1;
+    }
+    if (!sections) {
+        snapshot_release(snapshot);
+        return 0;
+    }
+
+    pthread_mutex_lock(&g_queue_lock);
+    if (!g_running) {
+        pthread_mutex_unlock(&g_queue_lock);
+        snapshot_release(snapshot);
+        return -1;
+    }
+
+    const DashboardSnapshot *superseded = g_queue.snapshot;
+    if (superseded) {
+        LOG_DEBUG("🖥️  Coalescing dashboard refresh (snapshot %llu superseded by %llu)",
+                  (unsigned long long)superseded->generation, (unsigned long long)snapshot->generation);
+    }
+    g_queue.sections |= sections;
+    g_queue.snapshot = snapshot;
+    pthread_cond_signal(&g_queue_cond);
+    pthread_mutex_unlock(&g_queue_lock);
+
+    // Released outside the lock: the last reference frees the superseded data
+    if (superseded) {
+        snapshot_release(superseded);
+    }
+    return 0;
+}
+
+int display_service_submit_clock(time_t due) {
+    pthread_mutex_lock(&g_queue_lock);
+    if (!g_running) {
+        pthread_mutex_unlock(&g_queue_lock);
+        return -1;
+    }
+
+    if (g_queue.clock_due) {
+        LOG_DEBUG("⏰ Clock tick superseded while the panel was busy");
+    }
+    g_queue.clock_due = due > 0 ? due : time(NULL);
+    pthread_cond_signal(&g_queue_cond);
+    pthread_mutex_unlock(&g_queue_lock);
+    return 0;
+}
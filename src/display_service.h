@@ -0,0 +1,44 @@
+#ifndef DISPLAY_SERVICE_H
+#define DISPLAY_SERVICE_H
+
+#include <time.h>
+#include "snapshot.h"
+
+/**
+ * Start the thread that owns the e-ink panel (call after init_eink_hardware)
+ * Every refresh then goes through the submit functions; callers never block on the panel.
+ * Returns: 0 on success, -1 on failure
+ */
+int display_service_start(void);
+
+/**
+ * Stop the thread once the refresh in progress (if any) completes; pending requests are dropped
+ */
+void display_service_stop(void);
+
+/**
+ * Queue a dashboard refresh of the given sections (DashboardSection bitmask)
+ * Takes over the snapshot reference. A request still waiting is superseded:
+ * sections are merged and only the newest snapshot is rendered.
+ * Returns: 0 if queued, -1 if the service is not running (snapshot released)
+ */
+int display_service_submit_dashboard(unsigned int sections, const DashboardSnapshot *snapshot);
+
+/**
+ * Queue a clock partial refresh for the minute starting at due
+ * Runs between dashboard refreshes, never during one. A tick pending with a dashboard
+ * refresh is folded into its header; a tick already shown by a full refresh, or
+ * superseded by a later tick, is dropped.
+ * Returns: 0 if queued, -1 if the service is not running
+ */
+int display_service_submit_clock(time_t due);
+
+/**
+ * Persist the frame on the panel with the data it was rendered from (state_store.h)
+ * Called after every dashboard refresh; call once more after display_service_stop,
+ * with panel_cleared set, when the panel is about to be cleared for shutdown.
+ * Returns: 0 on success, -1 on failure
+ */
+int display_service_save_state(const DashboardSnapshot *snapshot, int panel_cleared);
+
+#endif // DISPLAY_SERVICE_H
@@ -6,6 +6,7 @@
 #include "common.h"
 #include "display_stdout.h"
 #include "logging.h"
+#include "time_service.h"
 
 // Static arrays for French localization
 static const char* const french_days[DAYS_IN_WEEK] = {
@@ -25,8 +26,10 @@ void print_dashboard_header(time_t display_date) {
     }
     
     time_t now = time(NULL);
-    struct tm *date_info = localtime(&display_date);
-    struct tm *time_info = localtime(&now);
+    struct tm date_info_buf;
+    struct tm *date_info = time_service_local(display_date, &date_info_buf);
+    struct tm time_info_buf;
+    struct tm *time_info = time_service_local(now, &time_info_buf);
     
     if (!date_info || !time_info) {
         LOG_ERROR("\n⚠️  Date display error");
@@ -59,8 +62,10 @@ void print_dashboard_weather(const WeatherData *weather_data) {
     
     printf("\n🌤️  MÉTÉO - %s\n", WEATHER_CITY);
     printf("════════════════════════════════\n");
-    printf("🌡️  Température: %.0f°C\n", weather_data->current.temperature);
-    printf("☀️  Conditions: %s %s\n", weather_data->current.icon, weather_data->current.description);
+    printf("🌡️  Température: %d°C\n", weather_data->current.temperature);
+    printf("☀️  Conditions: %s %s\n",
+           get_weather_icon(weather_data->current.weather_code, weather_data->current.is_day),
+           get_weather_description(weather_data->current.weather_code));
     
     if (weather_data->forecast_count > 0) {
         printf("\n📊 Prévisions 12h:\n");
@@ -68,12 +73,13 @@ void print_dashboard_weather(const WeatherData *weather_data) {
                            weather_data->forecast_count : MAX_FORECAST_DISPLAY;
         
         for (int i = 0; i < max_forecasts; i++) {
-            struct tm *tm_forecast = localtime(&weather_data->forecasts[i].datetime);
+            struct tm tm_forecast_buf;
+            struct tm *tm_forecast = time_service_local(weather_data->forecasts[i].datetime, &tm_forecast_buf);
             if (tm_forecast) {
-                printf("  %02d:%02d %s %.0f°C\n",
+                printf("  %02d:%02d %s %d°C\n",
                        tm_forecast->tm_hour,
                        tm_forecast->tm_min,
-                       weather_data->forecasts[i].icon,
+                       get_weather_icon(weather_data->forecasts[i].weather_code, weather_data->forecasts[i].is_day),
                        weather_data->forecasts[i].temperature);
             }
         }
@@ -129,8 +135,11 @@ static void print_day_events(const char* day_name, const DayEvents *day_events)
             continue;  // Skip invalid events
         }
         
-        struct tm *start_tm = localtime(&event->start);
-        struct tm *end_tm = localtime(&event->end);
+        struct tm start_tm_buf;
+        
+        struct tm *start_tm = time_service_local(event->start, &start_tm_buf);
+        struct tm end_tm_buf;
+        struct tm *end_tm = time_service_local(event->end, &end_tm_buf);
         
         if (!start_tm || !end_tm) {
             continue;  // Skip if time conversion fails
@@ -0,0 +1,233 @@
+#include <string.h>
+#include <strings.h>
+#include "dither.h"
+#include "pixel_convert.h"
+
+// ====================== CONSTANTS ======================
+
+#define DITHER_MAX_ROW_BYTES (DITHER_MAX_WIDTH / 8 + 2)
+#define DITHER_ERROR_PAD 2  // Row padding so kernels can spill past both edges
+
+// 8x8 Bayer index matrix (0..63)
+static const uint8_t bayer_matrix[8][8] = {
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+// ====================== ROW HELPERS ======================
+
+/**
+ * Copy bits [x0, x1) of a packed row segment (starting at byte first_byte)
+ * into the frame row, leaving the other bits of the edge bytes untouched
+ */
+static void merge_row_bits(uint8_t *frame_row, const uint8_t *packed, int first_byte, int x0, int x1) {
+    int last_byte = (x1 - 1) / 8;
+
+    for (int b = first_byte; b <= last_byte; b++) {
+        uint8_t mask = 0xFF;
+        if (b == x0 / 8) {
+            mask &= (uint8_t)(0xFF >> (x0 & 7));
+        }
+        if (b == last_byte && (x1 & 7)) {
+            mask &= (uint8_t)(0xFF << (8 - (x1 & 7)));
+        }
+
+        uint8_t bits = packed[b - first_byte];
+        frame_row[b] = (uint8_t)((frame_row[b] & ~mask) | (bits & mask));
+    }
+}
+
+static inline int clamp_gray(int gray) {
+    if (gray < 0) return 0;
+    if (gray > 255) return 255;
+    return gray;
+}
+
+static inline void set_packed_bit(uint8_t *packed, int bit, int white) {
+    if (white) {
+        packed[bit >> 3] |= (uint8_t)(0x80 >> (bit & 7));
+    }
+}
+
+// ====================== QUANTIZERS ======================
+
+// Plain and ordered thresholding: each row is independent, packed with SIMD
+static void dither_ordered_rows(const uint8_t *luma, int width, DitherMode mode, EinkRect rect,
+                                uint8_t *frame, int row_bytes) {
+    uint8_t packed[DITHER_MAX_ROW_BYTES];
+    uint8_t thresholds[16];
+
+    int first_byte = rect.x / 8;
+    int aligned_x = first_byte * 8;
+    int span = rect.x + rect.width - aligned_x;
+
+    if (mode == DITHER_THRESHOLD) {
+        memset(thresholds, PIXEL_THRESHOLD, sizeof(thresholds));
+    }
+
+    for (int y = rect.y; y < rect.y + rect.height; y++) {
+        if (mode == DITHER_BAYER) {
+            // Matrix row repeated twice; aligned_x is a multiple of 8 so columns line up
+            for (int i = 0; i < 16; i++) {
+                thresholds[i] = (uint8_t)(bayer_matrix[y & 7][i & 7] * 4 + 2);
+            }
+        }
+
+        pixel_pack_row_ordered(luma + (size_t)y * width + aligned_x, span, thresholds, packed);
+        merge_row_bits(frame + (size_t)y * row_bytes, packed, first_byte, rect.x, rect.x + rect.width);
+    }
+}
+
+// Floyd–Steinberg, error kept in sixteenths over two rows
+static void dither_floyd_steinberg(const uint8_t *luma, int width, EinkRect rect,
+                                   uint8_t *frame, int row_bytes) {
+    int errors[2][DITHER_MAX_WIDTH + 2 * DITHER_ERROR_PAD];
+    uint8_t packed[DITHER_MAX_ROW_BYTES];
+    int *current = errors[0];
+    int *next = errors[1];
+
+    int first_byte = rect.x / 8;
+    int aligned_x = first_byte * 8;
+
+    memset(errors, 0, sizeof(errors));
+
+    for (int y = rect.y; y < rect.y + rect.height; y++) {
+        const uint8_t *row = luma + (size_t)y * width + rect.x;
+        memset(packed, 0, sizeof(packed));
+
+        for (int i = 0; i < rect.width; i++) {
+            int *e = current + i + DITHER_ERROR_PAD;
+            int *n = next + i + DITHER_ERROR_PAD;
+
+            int gray = clamp_gray(row[i] + e[0] / 16);
+            int white = gray > PIXEL_THRESHOLD;
+            int error = gray - (white ? 255 : 0);
+
+            e[1] += error * 7;
+            n[-1] += error * 3;
+            n[0] += error * 5;
+            n[1] += error;
+
+            set_packed_bit(packed, rect.x + i - aligned_x, white);
+        }
+
+        merge_row_bits(frame + (size_t)y * row_bytes, packed, first_byte, rect.x, rect.x + rect.width);
+
+        // Advance one row: next becomes current, old current is cleared for reuse
+        int *swap = current;
+        current = next;
+        next = swap;
+        memset(next, 0, sizeof(errors[0]));
+    }
+}
+
+// Atkinson, error kept in eighths over three rows (only 6/8 is propagated)
+static void dither_atkinson(const uint8_t *luma, int width, EinkRect rect,
+                            uint8_t *frame, int row_bytes) {
+    int errors[3][DITHER_MAX_WIDTH + 2 * DITHER_ERROR_PAD];
+    uint8_t packed[DITHER_MAX_ROW_BYTES];
+    int *rows[3] = { errors[0], errors[1], errors[2] };
+
+    int first_byte = rect.x / 8;
+    int aligned_x = first_byte * 8;
+
+    memset(errors, 0, sizeof(errors));
+
+    for (int y = rect.y; y < rect.y + rect.height; y++) {
+        const uint8_t *row = luma + (size_t)y * width + rect.x;
+        memset(packed, 0, sizeof(packed));
+
+        for (int i = 0; i < rect.width; i++) {
+            int *e0 = rows[0] + i + DITHER_ERROR_PAD;
+            int *e1 = rows[1] + i + DITHER_ERROR_PAD;
+            int *e2 = rows[2] + i + DITHER_ERROR_PAD;
+
+            int gray = clamp_gray(row[i] + e0[0] / 8);
+            int white = gray > PIXEL_THRESHOLD;
+            int error = gray - (white ? 255 : 0);
+
+            e0[1] += error;
+            e0[2] += error;
+            e1[-1] += error;
+            e1[0] += error;
+            e1[1] += error;
+            e2[0] += error;
+
+            set_packed_bit(packed, rect.x + i - aligned_x, white);
+        }
+
+        merge_row_bits(frame + (size_t)y * row_bytes, packed, first_byte, rect.x, rect.x + rect.width);
+
+        // Rotate the three error rows and clear the one that becomes y + 2
+        int *done = rows[0];
+        rows[0] = rows[1];
+        rows[1] = rows[2];
+        rows[2] = done;
+        memset(rows[2], 0, sizeof(errors[0]));
+    }
+}
+
+// ====================== PUBLIC API ======================
+
+void dither_region(const uint8_t *luma, int width, int height, DitherMode mode,
+                   EinkRect rect, uint8_t *frame, int row_bytes) {
+    if (!luma || !frame || width <= 0 || width > DITHER_MAX_WIDTH || width > row_bytes * 8) {
+        return;
+    }
+
+    // Clamp to the luma plane
+    if (rect.x < 0) { rect.width += rect.x; rect.x = 0; }
+    if (rect.y < 0) { rect.height += rect.y; rect.y = 0; }
+    if (rect.x + rect.width > width) rect.width = width - rect.x;
+    if (rect.y + rect.height > height) rect.height = height - rect.y;
+    if (rect.width <= 0 || rect.height <= 0) {
+        return;
+    }
+
+    switch (mode) {
+        case DITHER_FLOYD_STEINBERG:
+            dither_floyd_steinberg(luma, width, rect, frame, row_bytes);
+            break;
+        case DITHER_ATKINSON:
+            dither_atkinson(luma, width, rect, frame, row_bytes);
+            break;
+        case DITHER_BAYER:
+        case DITHER_THRESHOLD:
+        default:
+            dither_ordered_rows(luma, width, mode, rect, frame, row_bytes);
+            break;
+    }
+}
+
+const char* dither_mode_name(DitherMode mode) {
+    switch (mode) {
+        case DITHER_THRESHOLD: return "threshold";
+        case DITHER_BAYER: return "bayer";
+        case DITHER_FLOYD_STEINBERG: return "floyd-steinberg";
+        case DITHER_ATKINSON: return "atkinson";
+        default: return "unknown";
+    }
+}
+
+int dither_mode_from_name(const char *name, DitherMode *mode) {
+    if (!name || !mode) return 0;
+
+    if (strcasecmp(name, "threshold") == 0) {
+        *mode = DITHER_THRESHOLD;
+    } else if (strcasecmp(name, "bayer") == 0) {
+        *mode = DITHER_BAYER;
+    } else if (strcasecmp(name, "floyd-steinberg") == 0 || strcasecmp(name, "fs") == 0) {
+        *mode = DITHER_FLOYD_STEINBERG;
+    } else if (strcasecmp(name, "atkinson") == 0) {
+        *mode = DITHER_ATKINSON;
+    } else {
+        return 0;
+    }
+    return 1;
+}
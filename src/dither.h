@@ -0,0 +1,41 @@
+#ifndef DITHER_H
+#define DITHER_H
+
+#include <stdint.h>
+#include "eink_regions.h"
+
+// Widest luma row the diffusion kernels accept (panel is 800 px)
+#define DITHER_MAX_WIDTH 1024
+
+// Quantizer used to turn 8-bit luma into 1-bit panel pixels
+typedef enum {
+    DITHER_THRESHOLD = 0,     // Plain threshold (fastest, crisp text)
+    DITHER_BAYER,             // 8x8 ordered dither (branch-free, SIMD)
+    DITHER_FLOYD_STEINBERG,   // Two-row error diffusion (7/16, 3/16, 5/16, 1/16)
+    DITHER_ATKINSON           // Three-row error diffusion, 6/8 of the error kept
+} DitherMode;
+
+/**
+ * Quantize a rectangle of a rotated luma plane into a packed 1-bit frame
+ * Only the bits inside `rect` are written; neighbouring pixels are preserved.
+ * Diffusion error starts at zero on the rectangle border, so a region
+ * always produces the same bits regardless of what surrounds it.
+ *
+ * Parameters:
+ *   luma      - luma plane, `width` x `height`, one byte per pixel
+ *   frame     - packed frame (1 = white, MSB first), rows `row_bytes` apart
+ *   rect      - region in frame coordinates, clamped to the plane
+ */
+void dither_region(const uint8_t *luma, int width, int height, DitherMode mode,
+                   EinkRect rect, uint8_t *frame, int row_bytes);
+
+// Mode name for logs and configuration ("threshold", "bayer", "floyd-steinberg", "atkinson")
+const char* dither_mode_name(DitherMode mode);
+
+/**
+ * Parse a mode name (also accepts "fs")
+ * Returns: 1 on success, 0 if the name is unknown
+ */
+int dither_mode_from_name(const char *name, DitherMode *mode);
+
+#endif // DITHER_H
@@ -0,0 +1,180 @@
+#define _GNU_SOURCE
+#include <string.h>
+#include "eink_regions.h"
+#include "time_service.h"
+
+// ====================== REGION GEOMETRY ======================
+
+/**
+ * Map a dashboard section to panel coordinates
+ * The dashboard is rendered portrait and rotated 90° clockwise onto the panel:
+ * panel(x, y) = portrait(panel_height - 1 - y, x)
+ */
+EinkRect eink_section_rect(DashboardSection section, int panel_height) {
+    EinkRect rect = {0, 0, 0, 0};
+    int x, y, width, height;
+    
+    if (!get_section_bounds(section, &x, &y, &width, &height)) {
+        return rect;
+    }
+    
+    // Include 1px stroke overflow around section borders
+    x -= 1;
+    y -= 1;
+    width += 2;
+    height += 2;
+    
+    rect.x = y;
+    rect.y = panel_height - (x + width);
+    rect.width = height;
+    rect.height = width;
+    
+    // Clamp to panel
+    if (rect.x < 0) { rect.width += rect.x; rect.x = 0; }
+    if (rect.y < 0) { rect.height += rect.y; rect.y = 0; }
+    if (rect.y + rect.height > panel_height) {
+        rect.height = panel_height - rect.y;
+    }
+    
+    return rect;
+}
+
+// ====================== FRAME DIFFING ======================
+
+int eink_frame_diff(const uint8_t *previous, const uint8_t *current, int row_bytes,
+                    EinkRect region, EinkRect *bbox) {
+    if (!previous || !current || !bbox || region.width <= 0 || region.height <= 0) {
+        return 0;
+    }
+    
+    int first_byte = region.x / 8;
+    int last_byte = (region.x + region.width - 1) / 8;
+    if (last_byte >= row_bytes) {
+        last_byte = row_bytes - 1;
+    }
+    int span = last_byte - first_byte + 1;
+    
+    int min_byte = row_bytes, max_byte = -1;
+    int min_row = -1, max_row = -1;
+    
+    for (int y = region.y; y < region.y + region.height; y++) {
+        const uint8_t *prev_row = previous + y * row_bytes + first_byte;
+        const uint8_t *cur_row = current + y * row_bytes + first_byte;
+        
+        // Fast path: whole row span unchanged
+        if (memcmp(prev_row, cur_row, span) == 0) {
+            continue;
+        }
+        
+        int lo = 0;
+        while (lo < span && prev_row[lo] == cur_row[lo]) lo++;
+        int hi = span - 1;
+        while (hi > lo && prev_row[hi] == cur_row[hi]) hi--;
+        
+        if (first_byte + lo < min_byte) min_byte = first_byte + lo;
+        if (first_byte + hi > max_byte) max_byte = first_byte + hi;
+        if (min_row < 0) min_row = y;
+        max_row = y;
+    }
+    
+    if (min_row < 0) {
+        return 0;
+    }
+    
+    bbox->x = min_byte * 8;
+    bbox->width = (max_byte - min_byte + 1) * 8;
+    bbox->y = min_row;
+    bbox->height = max_row - min_row + 1;
+    return 1;
+}
+
+void eink_copy_window(const uint8_t *frame, int row_bytes, EinkRect window, uint8_t *out) {
+    if (!frame || !out) {
+        return;
+    }
+    
+    int first_byte = window.x / 8;
+    int span = (window.width + 7) / 8;
+    
+    for (int y = 0; y < window.height; y++) {
+        memcpy(out + y * span, frame + (window.y + y) * row_bytes + first_byte, span);
+    }
+}
+
+void eink_paste_window(uint8_t *frame, int row_bytes, EinkRect window, const uint8_t *in) {
+    if (!frame || !in || window.width <= 0) {
+        return;
+    }
+    
+    int first_byte = window.x / 8;
+    int span = (window.width + 7) / 8;
+    int tail_bits = window.width % 8;
+    uint8_t tail_mask = tail_bits ? (uint8_t)(0xFF << (8 - tail_bits)) : 0xFF;  // MSB first
+    
+    for (int y = 0; y < window.height; y++) {
+        uint8_t *row = frame + (window.y + y) * row_bytes + first_byte;
+        const uint8_t *src = in + y * span;
+        memcpy(row, src, span - 1);
+        row[span - 1] = (uint8_t)((row[span - 1] & ~tail_mask) | (src[span - 1] & tail_mask));
+    }
+}
+
+// ====================== GHOSTING POLICY ======================
+
+void ghosting_policy_init(GhostingPolicy *policy, int full_every, int nightly_hour) {
+    if (!policy) {
+        return;
+    }
+    
+    policy->full_every = full_every < 0 ? 0 : full_every;
+    policy->nightly_hour = (nightly_hour >= 0 && nightly_hour < 24) ? nightly_hour : -1;
+    policy->partial_count = 0;
+    policy->last_full_time = 0;
+}
+
+// Returns 1 if a full refresh is needed, 0 if a partial update is acceptable
+int ghosting_policy_needs_full(const GhostingPolicy *policy, time_t now) {
+    if (!policy || policy->last_full_time == 0) {
+        return 1;
+    }
+    
+    // Too many partial updates accumulated since last full refresh
+    if (policy->full_every > 0 && policy->partial_count >= policy->full_every) {
+        return 1;
+    }
+    
+    // Nightly full refresh: due once the configured hour has passed today
+    if (policy->nightly_hour >= 0) {
+        struct tm tm_now;
+        if (!time_service_local(now, &tm_now)) {
+            return 0;
+        }
+        
+        struct tm tm_nightly = tm_now;
+        tm_nightly.tm_hour = policy->nightly_hour;
+        tm_nightly.tm_min = 0;
+        tm_nightly.tm_sec = 0;
+        tm_nightly.tm_isdst = -1;
+        
+        time_t nightly = time_service_mktime(&tm_nightly);
+        if (nightly != -1 && now >= nightly && policy->last_full_time < nightly) {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+void ghosting_policy_record_full(GhostingPolicy *policy, time_t now) {
+    if (!policy) {
+        return;
+    }
+    policy->partial_count = 0;
+    policy->last_full_time = now;
+}
+
+void ghosting_policy_record_partial(GhostingPolicy *policy) {
+    if (policy) {
+        policy->partial_count++;
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef EINK_REGIONS_H
+#define EINK_REGIONS_H
+
+#include <stdint.h>
+#include <time.h>
+#include "dashboard_render.h"
+
+// Ghosting policy defaults (overridable via environment)
+#define GHOSTING_DEFAULT_FULL_EVERY 12    // Full refresh after 12 partial updates
+#define GHOSTING_DEFAULT_NIGHTLY_HOUR 3   // Nightly full refresh at 03:00 (-1 = disabled)
+
+// Rectangle in panel (landscape) coordinates
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} EinkRect;
+
+// Decides when a full refresh is still needed to clear partial-update ghosting
+typedef struct {
+    int full_every;         // Force full refresh after this many partial updates (0 = never)
+    int nightly_hour;       // Local hour of the daily full refresh (-1 = disabled)
+    int partial_count;      // Partial updates since last full refresh
+    time_t last_full_time;  // Time of last full refresh (0 = never)
+} GhostingPolicy;
+
+// Map a dashboard section (portrait layout) to its panel rectangle
+EinkRect eink_section_rect(DashboardSection section, int panel_height);
+
+/**
+ * Compute the bounding box of pixels that differ between two packed frames
+ * within the given panel rectangle. The box is aligned to whole bytes (8 px) in x.
+ * 
+ * Returns:
+ *   1 if pixels differ (bbox filled in)
+ *   0 if the region is identical
+ */
+int eink_frame_diff(const uint8_t *previous, const uint8_t *current, int row_bytes,
+                    EinkRect region, EinkRect *bbox);
+
+// Copy a byte-aligned window of a packed frame into a compact buffer
+void eink_copy_window(const uint8_t *frame, int row_bytes, EinkRect window, uint8_t *out);
+
+// Inverse of eink_copy_window; padding bits past window.width in the last byte are left untouched
+void eink_paste_window(uint8_t *frame, int row_bytes, EinkRect window, const uint8_t *in);
+
+// Ghosting policy
+void ghosting_policy_init(GhostingPolicy *policy, int full_every, int nightly_hour);
+int ghosting_policy_needs_full(const GhostingPolicy *policy, time_t now);
+void ghosting_policy_record_full(GhostingPolicy *policy, time_t now);
+void ghosting_policy_record_partial(GhostingPolicy *policy);
+
+#endif // EINK_REGIONS_H
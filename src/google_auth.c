@@ -0,0 +1,241 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <cjson/cJSON.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/bio.h>
+#include "google_auth.h"
+#include "http.h"
+#include "logging.h"
+
+// ====================== SERVICE ACCOUNT ======================
+
+// Read a whole file into a malloc'd NUL-terminated buffer
+static char* read_file(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+
+    char *content = NULL;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long size = ftell(file);
+        if (size >= 0 && fseek(file, 0, SEEK_SET) == 0) {
+            content = malloc((size_t)size + 1);
+            if (content && fread(content, 1, (size_t)size, file) == (size_t)size) {
+                content[size] = '\0';
+            } else {
+                free(content);
+                content = NULL;
+            }
+        }
+    }
+
+    fclose(file);
+    return content;
+}
+
+int google_service_account_load(const char *path, GoogleServiceAccount *account) {
+    if (!path || !account) {
+        return -1;
+    }
+    memset(account, 0, sizeof(GoogleServiceAccount));
+
+    char *content = read_file(path);
+    if (!content) {
+        LOG_ERROR("❌ Cannot read service account key %s", path);
+        return -1;
+    }
+
+    cJSON *json = cJSON_Parse(content);
+    free(content);
+    if (!json) {
+        LOG_ERROR("❌ Invalid JSON in service account key %s", path);
+        return -1;
+    }
+
+    cJSON *email = cJSON_GetObjectItem(json, "client_email");
+    cJSON *key = cJSON_GetObjectItem(json, "private_key");
+    cJSON *token_uri = cJSON_GetObjectItem(json, "token_uri");
+
+    int result = -1;
+    if (cJSON_IsString(email) && cJSON_IsString(key)) {
+        strncpy(account->client_email, email->valuestring, sizeof(account->client_email) - 1);
+        strncpy(account->token_uri,
+                cJSON_IsString(token_uri) ? token_uri->valuestring : GOOGLE_DEFAULT_TOKEN_URI,
+                sizeof(account->token_uri) - 1);
+        account->private_key = strdup(key->valuestring);
+        if (account->private_key) {
+            result = 0;
+        }
+    } else {
+        LOG_ERROR("❌ Service account key %s lacks client_email or private_key", path);
+    }
+
+    cJSON_Delete(json);
+    return result;
+}
+
+void google_service_account_free(GoogleServiceAccount *account) {
+    if (account) {
+        free(account->private_key);
+        account->private_key = NULL;
+    }
+}
+
+// ====================== JWT ======================
+
+// Base64url without padding (RFC 7515); out must hold 4 * ((length + 2) / 3) + 1 bytes
+static void base64url_encode(const unsigned char *data, size_t length, char *out) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    size_t o = 0;
+
+    for (size_t i = 0; i < length; i += 3) {
+        unsigned int block = (unsigned int)data[i] << 16;
+        if (i + 1 < length) block |= (unsigned int)data[i + 1] << 8;
+        if (i + 2 < length) block |= data[i + 2];
+
+        out[o++] = alphabet[(block >> 18) & 0x3F];
+        out[o++] = alphabet[(block >> 12) & 0x3F];
+        if (i + 1 < length) out[o++] = alphabet[(block >> 6) & 0x3F];
+        if (i + 2 < length) out[o++] = alphabet[block & 0x3F];
+    }
+    out[o] = '\0';
+}
+
+/**
+ * Sign data with the account's RSA key (RSASSA-PKCS1-v1_5 / SHA-256)
+ * Returns: malloc'd signature (length in signature_length), or NULL on failure
+ */
+static unsigned char* rs256_sign(const char *private_key, const char *data, size_t *signature_length) {
+    BIO *bio = BIO_new_mem_buf(private_key, -1);
+    if (!bio) {
+        return NULL;
+    }
+    EVP_PKEY *pkey = PEM_read_bio_PrivateKey(bio, NULL, NULL, NULL);
+    BIO_free(bio);
+    if (!pkey) {
+        LOG_ERROR("❌ Cannot parse service account private key");
+        return NULL;
+    }
+
+    unsigned char *signature = NULL;
+    EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+    if (ctx &&
+        EVP_DigestSignInit(ctx, NULL, EVP_sha256(), NULL, pkey) == 1 &&
+        EVP_DigestSignUpdate(ctx, data, strlen(data)) == 1 &&
+        EVP_DigestSignFinal(ctx, NULL, signature_length) == 1) {
+        signature = malloc(*signature_length);
+        if (signature && EVP_DigestSignFinal(ctx, signature, signature_length) != 1) {
+            free(signature);
+            signature = NULL;
+        }
+    }
+
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    return signature;
+}
+
+/**
+ * Build "header.claims.signature" for the OAuth JWT bearer grant
+ * Returns: malloc'd assertion, or NULL on failure
+ */
+static char* build_jwt_assertion(const GoogleServiceAccount *account, const char *scope, time_t now) {
+    static const char header[] = "{\"alg\":\"RS256\",\"typ\":\"JWT\"}";
+    char claims[1024];
+    int claims_length = snprintf(claims, sizeof(claims),
+                                 "{\"iss\":\"%s\",\"scope\":\"%s\",\"aud\":\"%s\",\"iat\":%ld,\"exp\":%ld}",
+                                 account->client_email, scope, account->token_uri,
+                                 (long)now, (long)(now + GOOGLE_TOKEN_LIFETIME_SECONDS));
+    if (claims_length < 0 || (size_t)claims_length >= sizeof(claims)) {
+        return NULL;
+    }
+
+    char signing_input[2048];
+    char encoded_header[64];
+    char encoded_claims[1400];
+    base64url_encode((const unsigned char *)header, strlen(header), encoded_header);
+    base64url_encode((const unsigned char *)claims, (size_t)claims_length, encoded_claims);
+    snprintf(signing_input, sizeof(signing_input), "%s.%s", encoded_header, encoded_claims);
+
+    size_t signature_length = 0;
+    unsigned char *signature = rs256_sign(account->private_key, signing_input, &signature_length);
+    if (!signature) {
+        return NULL;
+    }
+
+    size_t input_length = strlen(signing_input);
+    char *assertion = malloc(input_length + 1 + 4 * ((signature_length + 2) / 3) + 1);
+    if (assertion) {
+        memcpy(assertion, signing_input, input_length);
+        assertion[input_length] = '.';
+        base64url_encode(signature, signature_length, assertion + input_length + 1);
+    }
+
+    free(signature);
+    return assertion;
+}
+
+// ====================== TOKEN EXCHANGE ======================
+
+int google_fetch_access_token(const GoogleServiceAccount *account, const char *scope,
+                              char *token, size_t token_size, time_t *expires_at) {
+    if (!account || !account->private_key || !scope || !token || token_size == 0 || !expires_at) {
+        return -1;
+    }
+
+    time_t now = time(NULL);
+    char *assertion = build_jwt_assertion(account, scope, now);
+    if (!assertion) {
+        LOG_ERROR("❌ Failed to sign service account JWT");
+        return -1;
+    }
+
+    // JWT characters are all URL-safe, so the form body needs no further encoding
+    static const char grant[] = "grant_type=urn%3Aietf%3Aparams%3Aoauth%3Agrant-type%3Ajwt-bearer&assertion=";
+    char *body = malloc(sizeof(grant) + strlen(assertion));
+    if (!body) {
+        free(assertion);
+        return -1;
+    }
+    strcpy(body, grant);
+    strcat(body, assertion);
+    free(assertion);
+
+    const char *headers[] = { "Content-Type: application/x-www-form-urlencoded", NULL };
+    HttpResponse response;
+    int fetch = http_post(account->token_uri, headers, body, &response);
+    free(body);
+
+    if (fetch != HTTP_RESULT_OK) {
+        LOG_ERROR("❌ OAuth token request failed (HTTP %ld)", response.status);
+        http_response_free(&response);
+        return -1;
+    }
+
+    int result = -1;
+    cJSON *json = cJSON_Parse(response.body);
+    http_response_free(&response);
+    if (json) {
+        cJSON *access_token = cJSON_GetObjectItem(json, "access_token");
+        cJSON *expires_in = cJSON_GetObjectItem(json, "expires_in");
+        if (cJSON_IsString(access_token) && strlen(access_token->valuestring) < token_size) {
+            strcpy(token, access_token->valuestring);
+            *expires_at = now + (cJSON_IsNumber(expires_in) ? (time_t)expires_in->valuedouble
+                                                             : GOOGLE_TOKEN_LIFETIME_SECONDS);
+            result = 0;
+        }
+        cJSON_Delete(json);
+    }
+
+    if (result != 0) {
+        LOG_ERROR("❌ Unexpected OAuth token response");
+    } else {
+        LOG_DEBUG("🔑 OAuth access token obtained (valid %ld s)", (long)(*expires_at - now));
+    }
+    return result;
+}
@@ -0,0 +1,36 @@
+#ifndef GOOGLE_AUTH_H
+#define GOOGLE_AUTH_H
+
+#include <stddef.h>
+#include <time.h>
+
+// Constants
+#define GOOGLE_MAX_EMAIL_LENGTH 256
+#define GOOGLE_MAX_URI_LENGTH 256
+#define GOOGLE_DEFAULT_TOKEN_URI "https://oauth2.googleapis.com/token"
+#define GOOGLE_TOKEN_LIFETIME_SECONDS 3600
+#define GOOGLE_MAX_TOKEN_LENGTH 1024
+
+// Service account key (config/credentials.json)
+typedef struct {
+    char client_email[GOOGLE_MAX_EMAIL_LENGTH];
+    char token_uri[GOOGLE_MAX_URI_LENGTH];
+    char *private_key;          // malloc'd PEM
+} GoogleServiceAccount;
+
+/**
+ * Load client_email, private_key and token_uri from a service account JSON key
+ * Returns: 0 on success, -1 on failure
+ */
+int google_service_account_load(const char *path, GoogleServiceAccount *account);
+void google_service_account_free(GoogleServiceAccount *account);
+
+/**
+ * Exchange a freshly signed RS256 JWT assertion for an OAuth access token
+ * token receives the bearer token, expires_at its absolute expiry time.
+ * Returns: 0 on success, -1 on failure
+ */
+int google_fetch_access_token(const GoogleServiceAccount *account, const char *scope,
+                              char *token, size_t token_size, time_t *expires_at);
+
+#endif // GOOGLE_AUTH_H
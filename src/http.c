@@ -1,10 +1,34 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <stdint.h>
+#include <pthread.h>
+#include <time.h>
 #include <curl/curl.h>
 #include "http.h"
 #include "logging.h"
+#include "metrics.h"
+#include "buffer_pool.h"
+
+// Pooled easy handle, reused for requests to the same host
+typedef struct {
+    char host[HTTP_MAX_HOST_LENGTH];
+    CURL *handle;
+    int in_use;
+    time_t last_used;
+} HttpPoolSlot;
+
+// Process-lifetime client state
+static HttpPoolSlot http_pool[HTTP_POOL_SIZE];
+static pthread_mutex_t http_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static CURLSH *http_share = NULL;
+static pthread_mutex_t http_share_locks[CURL_LOCK_DATA_LAST];
+static int http_initialized = 0;
+
+// Body and header buffers, handed back by http_response_free and reused by the next request
+static BufferPool http_buffers = BUFFER_POOL_INITIALIZER("http");
 
 // HTTP response buffer structure
 typedef struct {
@@ -29,21 +53,14 @@ static size_t WriteMemoryCallback(void *contents, size_t size, size_t nmemb, voi
     
     size_t new_size = mem->size + realsize + 1;
     
-    // Expand buffer if needed
+    // Expand buffer if needed (rare once pooled buffers have grown to the usual response sizes)
     if (new_size > mem->capacity) {
-        size_t new_capacity = mem->capacity;
-        while (new_capacity < new_size) {
-            new_capacity *= 2;
-        }
-        
-        char *ptr = realloc(mem->memory, new_capacity);
+        char *ptr = buffer_pool_reserve(mem->memory, &mem->capacity, new_size);
         if (!ptr) {
             LOG_ERROR("HTTP: Memory allocation failed");
             return 0;
         }
-        
         mem->memory = ptr;
-        mem->capacity = new_capacity;
     }
     
     // Copy data and null-terminate
@@ -54,58 +71,272 @@ static size_t WriteMemoryCallback(void *contents, size_t size, size_t nmemb, voi
     return realsize;
 }
 
-// Initialize memory structure with optimized buffer
+// Initialize memory structure with a pooled buffer
 static int init_memory_struct(MemoryStruct *mem) {
     if (!mem) {
         return -1;
     }
     
-    mem->memory = malloc(HTTP_INITIAL_BUFFER_SIZE);
+    mem->memory = buffer_pool_acquire(&http_buffers, HTTP_INITIAL_BUFFER_SIZE, &mem->capacity);
     if (!mem->memory) {
         return -1;
     }
     
     mem->size = 0;
-    mem->capacity = HTTP_INITIAL_BUFFER_SIZE;
     mem->memory[0] = '\0';
     
     return 0;
 }
 
-// HTTP GET request with comprehensive error handling
-char* http_get(const char* url) {
-    if (!url || strlen(url) == 0) {
-        LOG_ERROR("HTTP: Invalid URL provided");
-        return NULL;
+static void release_memory_struct(MemoryStruct *mem) {
+    buffer_pool_release(&http_buffers, mem->memory, mem->capacity);
+    mem->memory = NULL;
+    mem->size = 0;
+    mem->capacity = 0;
+}
+
+// Per-request transfer state shared by the write and header callbacks
+typedef struct {
+    MemoryStruct body;
+    MemoryStruct headers;
+    long status;                // Status of the response currently being received
+    int has_status;             // A status line was seen (file:// transfers have none)
+    HttpStreamCallback sink;    // Streaming consumer (NULL = buffer the body)
+    void *sink_data;
+} RequestState;
+
+// Body callback: buffer, or forward to the streaming sink when the response is a success
+static size_t BodyCallback(void *contents, size_t size, size_t nmemb, void *userp) {
+    RequestState *state = (RequestState *)userp;
+    size_t realsize = size * nmemb;
+    
+    if (!state->sink) {
+        return WriteMemoryCallback(contents, size, nmemb, &state->body);
     }
     
-    CURL *curl_handle;
-    CURLcode res;
-    MemoryStruct chunk;
-    long response_code = 0;
+    // Error pages and redirect bodies never reach the consumer
+    if (state->has_status && (state->status < 200 || state->status >= 300)) {
+        return realsize;
+    }
+    return state->sink((const char *)contents, realsize, state->sink_data) == 0 ? realsize : 0;
+}
+
+// Header callback: keep the header block of the final response only (redirects restart it)
+static size_t HeaderCallback(char *buffer, size_t size, size_t nitems, void *userp) {
+    size_t realsize = size * nitems;
+    RequestState *state = (RequestState *)userp;
     
-    // Initialize memory structure
-    if (init_memory_struct(&chunk) != 0) {
-        LOG_ERROR("HTTP: Failed to initialize memory structure");
-        return NULL;
+    if (realsize >= 5 && strncmp(buffer, "HTTP/", 5) == 0) {
+        state->headers.size = 0;
+        state->headers.memory[0] = '\0';
+        
+        // Status line: "HTTP/1.1 200 OK"
+        const char *code = memchr(buffer, ' ', realsize);
+        state->status = code ? strtol(code + 1, NULL, 10) : 0;
+        state->has_status = 1;
+    } else if (!state->sink && realsize > 15 && strncasecmp(buffer, "Content-Length:", 15) == 0) {
+        // Reserve the whole body up front instead of doubling from HTTP_INITIAL_BUFFER_SIZE
+        long long length = strtoll(buffer + 15, NULL, 10);
+        if (length > 0 && length <= HTTP_MAX_RESERVE_SIZE) {
+            char *memory = buffer_pool_reserve(state->body.memory, &state->body.capacity, (size_t)length + 1);
+            if (memory) {
+                state->body.memory = memory;
+            }
+        }
     }
     
-    // Initialize curl
-    curl_global_init(CURL_GLOBAL_DEFAULT);
-    curl_handle = curl_easy_init();
+    return WriteMemoryCallback(buffer, size, nitems, &state->headers) == realsize ? realsize : 0;
+}
+
+// Find a header in a raw header block and copy its trimmed value
+static int find_header(const char *headers, const char *name, char *value, size_t value_size) {
+    size_t name_len = strlen(name);
+    const char *line = headers;
     
-    if (!curl_handle) {
-        LOG_ERROR("HTTP: Failed to initialize curl handle");
-        free(chunk.memory);
-        curl_global_cleanup();
-        return NULL;
+    while (line && *line) {
+        const char *end = strpbrk(line, "\r\n");
+        size_t line_len = end ? (size_t)(end - line) : strlen(line);
+        
+        if (line_len > name_len && line[name_len] == ':' && strncasecmp(line, name, name_len) == 0) {
+            const char *start = line + name_len + 1;
+            const char *stop = line + line_len;
+            while (start < stop && (*start == ' ' || *start == '\t')) start++;
+            while (stop > start && (stop[-1] == ' ' || stop[-1] == '\t')) stop--;
+            
+            size_t len = (size_t)(stop - start);
+            if (len >= value_size) len = value_size - 1;
+            memcpy(value, start, len);
+            value[len] = '\0';
+            return 1;
+        }
+        
+        if (!end) break;
+        line = end + strspn(end, "\r\n");
     }
     
-    // Configure curl with optimized settings
+    return 0;
+}
+
+// ====================== SHARED CACHES ======================
+
+static void share_lock(CURL *handle, curl_lock_data data, curl_lock_access access, void *userptr) {
+    (void)handle; (void)access; (void)userptr;
+    pthread_mutex_lock(&http_share_locks[data]);
+}
+
+static void share_unlock(CURL *handle, curl_lock_data data, void *userptr) {
+    (void)handle; (void)userptr;
+    pthread_mutex_unlock(&http_share_locks[data]);
+}
+
+/**
+ * Initialize the process-lifetime HTTP client (call once from main before threads start)
+ * Returns: 0 on success, -1 on failure
+ */
+int http_init(void) {
+    if (http_initialized) {
+        return 0; // Already initialized
+    }
+    
+    if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK) {
+        LOG_ERROR("HTTP: curl_global_init failed");
+        return -1;
+    }
+    
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        pthread_mutex_init(&http_share_locks[i], NULL);
+    }
+    
+    // DNS cache, TLS sessions and live connections shared by every pooled handle
+    http_share = curl_share_init();
+    if (http_share) {
+        curl_share_setopt(http_share, CURLSHOPT_LOCKFUNC, share_lock);
+        curl_share_setopt(http_share, CURLSHOPT_UNLOCKFUNC, share_unlock);
+        curl_share_setopt(http_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(http_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_share_setopt(http_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    } else {
+        LOG_ERROR("HTTP: curl_share_init failed, continuing without shared caches");
+    }
+    
+    memset(http_pool, 0, sizeof(http_pool));
+    http_initialized = 1;
+    LOG_DEBUG("🌐 HTTP client initialized (%d pooled handles, %s)", HTTP_POOL_SIZE, curl_version());
+    return 0;
+}
+
+/**
+ * Release pooled handles and global curl state (call once after all threads stopped)
+ */
+void http_cleanup(void) {
+    if (!http_initialized) {
+        return;
+    }
+    
+    pthread_mutex_lock(&http_pool_mutex);
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        if (http_pool[i].handle) {
+            curl_easy_cleanup(http_pool[i].handle);
+        }
+    }
+    memset(http_pool, 0, sizeof(http_pool));
+    pthread_mutex_unlock(&http_pool_mutex);
+    
+    if (http_share) {
+        curl_share_cleanup(http_share);
+        http_share = NULL;
+    }
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        pthread_mutex_destroy(&http_share_locks[i]);
+    }
+    
+    curl_global_cleanup();
+    buffer_pool_drain(&http_buffers);
+    http_initialized = 0;
+}
+
+// ====================== HANDLE POOL ======================
+
+// Extract "host[:port]" from a URL (pool key)
+static void extract_host(const char *url, char *host, size_t host_size) {
+    const char *start = strstr(url, "://");
+    start = start ? start + 3 : url;
+    
+    size_t len = strcspn(start, "/?#");
+    if (len >= host_size) {
+        len = host_size - 1;
+    }
+    memcpy(host, start, len);
+    host[len] = '\0';
+}
+
+/**
+ * Check out an easy handle for the URL's host
+ * Prefers an idle handle that last talked to the same host, then an empty slot,
+ * then the least recently used idle slot. Returns the slot index, or -1 when
+ * every slot is busy (caller then uses an unpooled handle).
+ */
+static int pool_checkout(const char *host) {
+    int empty = -1, lru = -1;
+    
+    pthread_mutex_lock(&http_pool_mutex);
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+        HttpPoolSlot *slot = &http_pool[i];
+        if (slot->in_use) {
+            continue;
+        }
+        if (slot->handle && strcmp(slot->host, host) == 0) {
+            slot->in_use = 1;
+            pthread_mutex_unlock(&http_pool_mutex);
+            return i;
+        }
+        if (!slot->handle) {
+            if (empty < 0) empty = i;
+        } else if (lru < 0 || slot->last_used < http_pool[lru].last_used) {
+            lru = i;
+        }
+    }
+    
+    int index = (empty >= 0) ? empty : lru;
+    if (index >= 0) {
+        HttpPoolSlot *slot = &http_pool[index];
+        if (!slot->handle) {
+            slot->handle = curl_easy_init();
+        }
+        if (slot->handle) {
+            snprintf(slot->host, sizeof(slot->host), "%s", host);
+            slot->in_use = 1;
+        } else {
+            index = -1;
+        }
+    }
+    pthread_mutex_unlock(&http_pool_mutex);
+    
+    return index;
+}
+
+static void pool_checkin(int index) {
+    pthread_mutex_lock(&http_pool_mutex);
+    http_pool[index].in_use = 0;
+    http_pool[index].last_used = time(NULL);
+    pthread_mutex_unlock(&http_pool_mutex);
+}
+
+// ====================== REQUESTS ======================
+
+// Apply per-request options (handles are reset between requests, caches survive)
+static void configure_request(CURL *curl_handle, const char *url, RequestState *state) {
+    curl_easy_reset(curl_handle);
+    
     curl_easy_setopt(curl_handle, CURLOPT_URL, url);
-    curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, WriteMemoryCallback);
-    curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, (void *)&chunk);
+    curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, BodyCallback);
+    curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, (void *)state);
+    curl_easy_setopt(curl_handle, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl_handle, CURLOPT_HEADERDATA, (void *)state);
     curl_easy_setopt(curl_handle, CURLOPT_USERAGENT, HTTP_USER_AGENT);
+    if (http_share) {
+        curl_easy_setopt(curl_handle, CURLOPT_SHARE, http_share);
+    }
     
     // Timeout settings
     curl_easy_setopt(curl_handle, CURLOPT_TIMEOUT, HTTP_TIMEOUT_SECONDS);
@@ -118,30 +349,245 @@ char* http_get(const char* url) {
     curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYPEER, 1L);
     curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYHOST, 2L);
     
-    // Performance settings
+    // Performance settings (keepalive now matters: connections outlive the request)
     curl_easy_setopt(curl_handle, CURLOPT_TCP_KEEPALIVE, 1L);
     curl_easy_setopt(curl_handle, CURLOPT_TCP_KEEPIDLE, 30L);
     curl_easy_setopt(curl_handle, CURLOPT_TCP_KEEPINTVL, 30L);
+    curl_easy_setopt(curl_handle, CURLOPT_DNS_CACHE_TIMEOUT, HTTP_DNS_CACHE_SECONDS);
+}
+
+// Log request latency breakdown (connect/TLS are 0 when the connection was reused)
+static void log_request_timing(CURL *curl_handle, const char *host, long response_code) {
+    curl_off_t total = 0, dns = 0, connect = 0, tls = 0;
+    long new_connections = 0;
+    
+    curl_easy_getinfo(curl_handle, CURLINFO_TOTAL_TIME_T, &total);
+    curl_easy_getinfo(curl_handle, CURLINFO_NAMELOOKUP_TIME_T, &dns);
+    curl_easy_getinfo(curl_handle, CURLINFO_CONNECT_TIME_T, &connect);
+    curl_easy_getinfo(curl_handle, CURLINFO_APPCONNECT_TIME_T, &tls);
+    curl_easy_getinfo(curl_handle, CURLINFO_NUM_CONNECTS, &new_connections);
+    
+    LOG_INFO("🌐 HTTP %ld %s in %ld ms (dns %ld, connect %ld, tls %ld ms, %s connection)",
+             response_code, host, (long)(total / 1000), (long)(dns / 1000),
+             (long)(connect / 1000), (long)(tls / 1000),
+             new_connections > 0 ? "new" : "reused");
+}
+
+/**
+ * Run a request (GET, or POST when post_body is set); the body is buffered into
+ * response or streamed to sink. extra_headers is a NULL-terminated list (may be NULL).
+ */
+static int perform_request(const char *url, const HttpValidators *validators,
+                           const char *const *extra_headers, const char *post_body,
+                           HttpResponse *response, HttpStreamCallback sink, void *sink_data) {
+    if (!response) {
+        return HTTP_RESULT_ERROR;
+    }
+    memset(response, 0, sizeof(HttpResponse));
+    
+    if (!url || strlen(url) == 0) {
+        LOG_ERROR("HTTP: Invalid URL provided");
+        return HTTP_RESULT_ERROR;
+    }
+    
+    // Normally already done by main(); kept so standalone callers still work
+    if (http_init() != 0) {
+        return HTTP_RESULT_ERROR;
+    }
+    
+    CURLcode res;
+    RequestState state;
+    long response_code = 0;
+    char host[HTTP_MAX_HOST_LENGTH];
+    int result = HTTP_RESULT_ERROR;
+    
+    // Initialize memory structures
+    memset(&state, 0, sizeof(state));
+    state.sink = sink;
+    state.sink_data = sink_data;
+    if (init_memory_struct(&state.body) != 0 || init_memory_struct(&state.headers) != 0) {
+        LOG_ERROR("HTTP: Failed to initialize memory structure");
+        release_memory_struct(&state.body);
+        return HTTP_RESULT_ERROR;
+    }
+    
+    // Check out a pooled handle (fall back to a one-off handle when the pool is busy)
+    extract_host(url, host, sizeof(host));
+    int slot = pool_checkout(host);
+    CURL *curl_handle = (slot >= 0) ? http_pool[slot].handle : curl_easy_init();
+    
+    if (!curl_handle) {
+        LOG_ERROR("HTTP: Failed to initialize curl handle");
+        release_memory_struct(&state.body);
+        release_memory_struct(&state.headers);
+        return HTTP_RESULT_ERROR;
+    }
+    
+    configure_request(curl_handle, url, &state);
+    
+    // Conditional request headers from the previous response
+    struct curl_slist *request_headers = NULL;
+    if (validators) {
+        char line[HTTP_MAX_VALIDATOR_LENGTH + 32];
+        if (validators->etag[0]) {
+            snprintf(line, sizeof(line), "If-None-Match: %s", validators->etag);
+            request_headers = curl_slist_append(request_headers, line);
+        }
+        if (validators->last_modified[0]) {
+            snprintf(line, sizeof(line), "If-Modified-Since: %s", validators->last_modified);
+            request_headers = curl_slist_append(request_headers, line);
+        }
+    }
+    for (int i = 0; extra_headers && extra_headers[i]; i++) {
+        request_headers = curl_slist_append(request_headers, extra_headers[i]);
+    }
+    if (request_headers) {
+        curl_easy_setopt(curl_handle, CURLOPT_HTTPHEADER, request_headers);
+    }
+    
+    if (post_body) {
+        curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDS, post_body);
+        curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDSIZE, (long)strlen(post_body));
+    }
     
     // Perform the request
     res = curl_easy_perform(curl_handle);
     
     if (res != CURLE_OK) {
-        LOG_ERROR("HTTP: Request failed: %s", curl_easy_strerror(res));
-        free(chunk.memory);
-        chunk.memory = NULL;
+        LOG_ERROR("HTTP: Request to %s failed: %s", host, curl_easy_strerror(res));
     } else {
         // Check HTTP response code
         curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &response_code);
-        if (response_code >= 400) {
+        log_request_timing(curl_handle, host, response_code);
+        response->status = response_code;
+        
+        if (response_code == 304) {
+            result = HTTP_RESULT_NOT_MODIFIED;
+            metrics_count(METRIC_CACHE_HIT_HTTP);
+        } else if (response_code >= 400) {
             LOG_ERROR("HTTP: Server returned error %ld", response_code);
-            free(chunk.memory);
-            chunk.memory = NULL;
+        } else {
+            result = HTTP_RESULT_OK;
         }
     }
     
-    curl_easy_cleanup(curl_handle);
-    curl_global_cleanup();
+    curl_slist_free_all(request_headers);
+    if (slot >= 0) {
+        pool_checkin(slot);
+    } else {
+        curl_easy_cleanup(curl_handle);
+    }
     
-    return chunk.memory;
-}
\ No newline at end of file
+    if (result == HTTP_RESULT_ERROR) {
+        release_memory_struct(&state.body);
+        release_memory_struct(&state.headers);
+        return result;
+    }
+    
+    // Hand buffers over to the response
+    response->headers = state.headers.memory;
+    response->headers_capacity = state.headers.capacity;
+    find_header(response->headers, "ETag", response->validators.etag, sizeof(response->validators.etag));
+    find_header(response->headers, "Last-Modified", response->validators.last_modified,
+                sizeof(response->validators.last_modified));
+    
+    if (result == HTTP_RESULT_OK && !sink) {
+        response->body = state.body.memory;
+        response->body_size = state.body.size;
+        response->body_capacity = state.body.capacity;
+    } else {
+        release_memory_struct(&state.body);
+    }
+    
+    return result;
+}
+
+int http_get_conditional(const char *url, const HttpValidators *validators, HttpResponse *response) {
+    return perform_request(url, validators, NULL, NULL, response, NULL, NULL);
+}
+
+int http_get_with_headers(const char *url, const char *const *headers, HttpResponse *response) {
+    return perform_request(url, NULL, headers, NULL, response, NULL, NULL);
+}
+
+int http_post(const char *url, const char *const *headers, const char *body, HttpResponse *response) {
+    if (!body) {
+        return HTTP_RESULT_ERROR;
+    }
+    return perform_request(url, NULL, headers, body, response, NULL, NULL);
+}
+
+int http_get_stream(const char *url, const HttpValidators *validators, HttpResponse *response,
+                    HttpStreamCallback sink, void *sink_data) {
+    if (!sink) {
+        return HTTP_RESULT_ERROR;
+    }
+    return perform_request(url, validators, NULL, NULL, response, sink, sink_data);
+}
+
+void http_response_free(HttpResponse *response) {
+    if (!response) return;
+    buffer_pool_release(&http_buffers, response->body, response->body_capacity);
+    buffer_pool_release(&http_buffers, response->headers, response->headers_capacity);
+    response->body = NULL;
+    response->headers = NULL;
+    response->body_size = 0;
+    response->body_capacity = 0;
+    response->headers_capacity = 0;
+}
+
+int http_response_header(const HttpResponse *response, const char *name, char *value, size_t value_size) {
+    if (!response || !response->headers || !name || !value || value_size == 0) {
+        return 0;
+    }
+    return find_header(response->headers, name, value, value_size);
+}
+
+long http_response_max_age(const HttpResponse *response) {
+    char value[HTTP_MAX_VALIDATOR_LENGTH];
+    
+    if (http_response_header(response, "Cache-Control", value, sizeof(value))) {
+        if (strcasestr(value, "no-store") || strcasestr(value, "no-cache")) {
+            return 0;
+        }
+        
+        // max-age only (s-maxage is for shared caches, and its suffix would match the search)
+        for (const char *directive = value; (directive = strcasestr(directive, "max-age=")); directive++) {
+            if (directive > value && directive[-1] != ' ' && directive[-1] != ',') {
+                continue;
+            }
+            long max_age = strtol(directive + strlen("max-age="), NULL, 10);
+            if (http_response_header(response, "Age", value, sizeof(value))) {
+                max_age -= strtol(value, NULL, 10);
+            }
+            return max_age > 0 ? max_age : 0;
+        }
+    }
+    
+    if (http_response_header(response, "Expires", value, sizeof(value))) {
+        time_t expires = curl_getdate(value, NULL);
+        time_t date = http_response_header(response, "Date", value, sizeof(value)) ? curl_getdate(value, NULL) : -1;
+        if (expires == -1) {
+            return 0;   // Invalid dates (such as "0") mean already expired
+        }
+        long lifetime = (long)(expires - (date != -1 ? date : time(NULL)));
+        return lifetime > 0 ? lifetime : 0;
+    }
+    
+    return -1;
+}
+
+// HTTP GET request with comprehensive error handling
+char* http_get(const char* url) {
+    HttpResponse response;
+    if (http_get_conditional(url, NULL, &response) != HTTP_RESULT_OK) {
+        http_response_free(&response);
+        return NULL;
+    }
+    
+    // Caller owns the body
+    char *body = response.body;
+    response.body = NULL;
+    http_response_free(&response);
+    return body;
+}
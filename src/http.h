@@ -1,14 +1,95 @@
 #ifndef HTTP_H
 #define HTTP_H
 
+#include <stddef.h>
+
 // Constants
 #define HTTP_TIMEOUT_SECONDS 10L
 #define HTTP_INITIAL_BUFFER_SIZE 1024
 #define HTTP_USER_AGENT "dashboard/1.0"
 #define HTTP_MAX_REDIRECTS 10L
 #define HTTP_CONNECT_TIMEOUT 5L
+#define HTTP_POOL_SIZE 4              // Pooled easy handles (one per host in practice)
+#define HTTP_MAX_HOST_LENGTH 256
+#define HTTP_DNS_CACHE_SECONDS 300L
+#define HTTP_MAX_VALIDATOR_LENGTH 256
+#define HTTP_MAX_RESERVE_SIZE (8 * 1024 * 1024)  // Largest Content-Length reserved up front
+
+// Conditional request results
+#define HTTP_RESULT_OK 0
+#define HTTP_RESULT_NOT_MODIFIED 1
+#define HTTP_RESULT_ERROR -1
+
+
+// Cache validators of a previously fetched resource (empty strings = none)
+typedef struct {
+    char etag[HTTP_MAX_VALIDATOR_LENGTH];
+    char last_modified[HTTP_MAX_VALIDATOR_LENGTH];
+} HttpValidators;
+
+// Streaming body consumer: return 0 to continue, non-zero to abort the transfer
+typedef int (*HttpStreamCallback)(const char *data, size_t length, void *user_data);
+
+// Response of a (conditional) GET
+typedef struct {
+    long status;                // HTTP status code (304 when not modified)
+    char *body;                 // Pooled, NUL-terminated body (NULL on 304 or when streamed)
+    size_t body_size;
+    size_t body_capacity;
+    char *headers;              // Pooled raw header block of the final response
+    size_t headers_capacity;
+    HttpValidators validators;  // ETag / Last-Modified returned by the server
+} HttpResponse;
+
+// Process-lifetime client: call http_init() once from main before threads, http_cleanup() at exit
+int http_init(void);
+void http_cleanup(void);
 
-// HTTP utility function
+// HTTP GET (thread-safe, reuses pooled connections); returns malloc'd body or NULL
 char* http_get(const char* url);
 
+/**
+ * Conditional HTTP GET: sends If-None-Match / If-Modified-Since from validators
+ * (may be NULL for a plain GET) and fills response (release with http_response_free).
+ * 
+ * Returns:
+ *   HTTP_RESULT_OK            body received (response->validators updated)
+ *   HTTP_RESULT_NOT_MODIFIED  server answered 304, no body
+ *   HTTP_RESULT_ERROR         transport failure or status >= 400
+ */
+int http_get_conditional(const char *url, const HttpValidators *validators, HttpResponse *response);
+
+/**
+ * Same as http_get_conditional, but the body of a 2xx response is passed to sink
+ * chunk by chunk as it arrives instead of being buffered (response->body stays NULL)
+ */
+int http_get_stream(const char *url, const HttpValidators *validators, HttpResponse *response,
+                    HttpStreamCallback sink, void *sink_data);
+
+/**
+ * GET with extra request headers ("Authorization: Bearer ...", NULL-terminated list)
+ * Returns: HTTP_RESULT_OK or HTTP_RESULT_ERROR (response->status is set whenever the server answered)
+ */
+int http_get_with_headers(const char *url, const char *const *headers, HttpResponse *response);
+
+/**
+ * POST body (Content-Type given in headers, NULL-terminated list, may be NULL)
+ * Returns: HTTP_RESULT_OK or HTTP_RESULT_ERROR (response->status is set whenever the server answered)
+ */
+int http_post(const char *url, const char *const *headers, const char *body, HttpResponse *response);
+void http_response_free(HttpResponse *response);
+
+/**
+ * Look up a response header (case-insensitive name) and copy its trimmed value
+ * Returns: 1 if found, 0 otherwise
+ */
+int http_response_header(const HttpResponse *response, const char *name, char *value, size_t value_size);
+
+/**
+ * Freshness lifetime left on a response, from Cache-Control max-age (minus Age)
+ * or else Expires relative to Date; no-cache and no-store count as already stale
+ * Returns: seconds the response stays fresh (0 = stale), -1 when no caching header is present
+ */
+long http_response_max_age(const HttpResponse *response);
+
 #endif // HTTP_H
\ No newline at end of file
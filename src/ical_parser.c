@@ -0,0 +1,266 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "ical_parser.h"
+
+// ====================== PARSER STATE ======================
+
+struct IcalParser {
+    IcalCallbacks callbacks;
+    void *user_data;
+
+    char *line;             // Current logical (unfolded) line, ICAL_MAX_LINE_LENGTH + 1 bytes
+    size_t line_length;
+    int line_ended;         // Saw the line break; waiting for one byte to detect folding
+    int line_truncated;     // Current line exceeded the buffer
+    int truncated_lines;
+
+    char components[ICAL_MAX_DEPTH][ICAL_MAX_NAME_LENGTH];
+    int depth;              // Open components (may exceed ICAL_MAX_DEPTH; extra levels are unnamed)
+};
+
+IcalParser* ical_parser_create(const IcalCallbacks *callbacks, void *user_data) {
+    IcalParser *parser = calloc(1, sizeof(IcalParser));
+    if (!parser) {
+        return NULL;
+    }
+
+    parser->line = malloc(ICAL_MAX_LINE_LENGTH + 1);
+    if (!parser->line) {
+        free(parser);
+        return NULL;
+    }
+
+    if (callbacks) {
+        parser->callbacks = *callbacks;
+    }
+    parser->user_data = user_data;
+    return parser;
+}
+
+void ical_parser_free(IcalParser *parser) {
+    if (parser) {
+        free(parser->line);
+        free(parser);
+    }
+}
+
+void ical_parser_reset(IcalParser *parser, void *user_data) {
+    if (!parser) {
+        return;
+    }
+
+    parser->user_data = user_data;
+    parser->line_length = 0;
+    parser->line_ended = 0;
+    parser->line_truncated = 0;
+    parser->truncated_lines = 0;
+    parser->depth = 0;
+}
+
+int ical_parser_truncated_lines(const IcalParser *parser) {
+    return parser ? parser->truncated_lines : 0;
+}
+
+// ====================== LINE DISPATCH ======================
+
+static const char* current_component(const IcalParser *parser) {
+    if (parser->depth <= 0) return "";
+    if (parser->depth > ICAL_MAX_DEPTH) return "";
+    return parser->components[parser->depth - 1];
+}
+
+/**
+ * Split one unfolded content line into name, parameters and value and dispatch it
+ * The value starts after the first ':' that is not inside a quoted parameter value.
+ */
+static void dispatch_line(IcalParser *parser) {
+    char *line = parser->line;
+    line[parser->line_length] = '\0';
+
+    if (parser->line_truncated) {
+        parser->truncated_lines++;
+    }
+
+    if (parser->line_length == 0) {
+        return;
+    }
+
+    char *params = NULL;
+    char *value = NULL;
+    int in_quotes = 0;
+    for (char *p = line; *p; p++) {
+        if (*p == '"') {
+            in_quotes = !in_quotes;
+        } else if (!in_quotes && *p == ';' && !params) {
+            *p = '\0';
+            params = p + 1;
+        } else if (!in_quotes && *p == ':') {
+            *p = '\0';
+            value = p + 1;
+            break;
+        }
+    }
+
+    if (!value) {
+        return; // Not a content line
+    }
+
+    if (strcasecmp(line, "BEGIN") == 0) {
+        if (parser->depth < ICAL_MAX_DEPTH) {
+            strncpy(parser->components[parser->depth], value, ICAL_MAX_NAME_LENGTH - 1);
+            parser->components[parser->depth][ICAL_MAX_NAME_LENGTH - 1] = '\0';
+        }
+        parser->depth++;
+        if (parser->callbacks.on_begin) {
+            parser->callbacks.on_begin(value, parser->user_data);
+        }
+        return;
+    }
+
+    if (strcasecmp(line, "END") == 0) {
+        if (parser->depth > 0) {
+            if (parser->callbacks.on_end) {
+                parser->callbacks.on_end(value, parser->user_data);
+            }
+            parser->depth--;
+        }
+        return;
+    }
+
+    if (parser->callbacks.on_property) {
+        IcalProperty property = {
+            current_component(parser), parser->depth, line, params ? params : "", value
+        };
+        parser->callbacks.on_property(&property, parser->user_data);
+    }
+}
+
+static inline void reset_line(IcalParser *parser) {
+    parser->line_length = 0;
+    parser->line_ended = 0;
+    parser->line_truncated = 0;
+}
+
+// ====================== STREAMING INPUT ======================
+
+int ical_parser_feed(IcalParser *parser, const char *data, size_t length) {
+    if (!parser || (!data && length > 0)) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        char c = data[i];
+
+        if (parser->line_ended) {
+            if (c == ' ' || c == '\t') {
+                // Folded continuation: drop the break and this single whitespace
+                parser->line_ended = 0;
+                continue;
+            }
+            dispatch_line(parser);
+            reset_line(parser);
+        }
+
+        if (c == '\n') {
+            // Strip the CR of a CRLF break
+            if (parser->line_length > 0 && parser->line[parser->line_length - 1] == '\r') {
+                parser->line_length--;
+            }
+            parser->line_ended = 1;
+            continue;
+        }
+
+        if (parser->line_length < ICAL_MAX_LINE_LENGTH) {
+            parser->line[parser->line_length++] = c;
+        } else {
+            parser->line_truncated = 1;
+        }
+    }
+
+    return 0;
+}
+
+void ical_parser_finish(IcalParser *parser) {
+    if (!parser) return;
+
+    if (parser->line_ended || parser->line_length > 0) {
+        if (parser->line_length > 0 && parser->line[parser->line_length - 1] == '\r') {
+            parser->line_length--;
+        }
+        dispatch_line(parser);
+    }
+    reset_line(parser);
+}
+
+// ====================== HELPERS ======================
+
+int ical_param_value(const char *params, const char *name, char *value, size_t value_size) {
+    if (!params || !name || !value || value_size == 0) {
+        return 0;
+    }
+
+    size_t name_len = strlen(name);
+    const char *p = params;
+
+    while (*p) {
+        // Parameter starts here: NAME=VALUE
+        const char *eq = strchr(p, '=');
+        if (!eq) break;
+
+        int match = ((size_t)(eq - p) == name_len && strncasecmp(p, name, name_len) == 0);
+
+        // Find end of the parameter value (';' outside quotes)
+        const char *v = eq + 1;
+        const char *end = v;
+        int in_quotes = 0;
+        while (*end && (in_quotes || *end != ';')) {
+            if (*end == '"') in_quotes = !in_quotes;
+            end++;
+        }
+
+        if (match) {
+            const char *start = v;
+            const char *stop = end;
+            if (stop - start >= 2 && *start == '"' && stop[-1] == '"') {
+                start++;
+                stop--;
+            }
+            size_t len = (size_t)(stop - start);
+            if (len >= value_size) len = value_size - 1;
+            memcpy(value, start, len);
+            value[len] = '\0';
+            return 1;
+        }
+
+        p = (*end == ';') ? end + 1 : end;
+    }
+
+    return 0;
+}
+
+void ical_unescape_text(char *text) {
+    if (!text) return;
+
+    char *src = text, *dst = text;
+    while (*src) {
+        if (*src == '\\' && src[1]) {
+            char next = src[1];
+            if (next == 'n' || next == 'N') {
+                *dst++ = ' ';
+            } else if (next == ',' || next == ';' || next == '\\') {
+                *dst++ = next;
+            } else {
+                *dst++ = *src;
+                *dst++ = next;
+            }
+            src += 2;
+        } else if (*src == '\r') {
+            src++;
+        } else {
+            *dst++ = *src++;
+        }
+    }
+    *dst = '\0';
+}
@@ -0,0 +1,66 @@
+#ifndef ICAL_PARSER_H
+#define ICAL_PARSER_H
+
+#include <stddef.h>
+
+// Limits (longer content lines are truncated, deeper nesting is ignored)
+#define ICAL_MAX_LINE_LENGTH 16384
+#define ICAL_MAX_DEPTH 8
+#define ICAL_MAX_NAME_LENGTH 64
+
+// One unfolded content line: NAME;PARAMS:VALUE
+typedef struct {
+    const char *component;  // Innermost open component ("VEVENT", "VALARM", ...; "" at top level)
+    int depth;              // Number of open components
+    const char *name;       // Property name (uppercase as sent)
+    const char *params;     // Raw parameter list without the leading ';' ("" if none)
+    const char *value;      // Raw value (escapes not decoded)
+} IcalProperty;
+
+// Parser callbacks (any may be NULL); strings are only valid during the call
+typedef struct {
+    void (*on_begin)(const char *component, void *user_data);
+    void (*on_end)(const char *component, void *user_data);
+    void (*on_property)(const IcalProperty *property, void *user_data);
+} IcalCallbacks;
+
+// Streaming parser (opaque)
+typedef struct IcalParser IcalParser;
+
+/**
+ * Create a streaming iCalendar tokenizer
+ * Memory use is fixed (one content line), independent of the document size.
+ */
+IcalParser* ical_parser_create(const IcalCallbacks *callbacks, void *user_data);
+void ical_parser_free(IcalParser *parser);
+
+/**
+ * Start a new document with the same callbacks and line buffer (no allocation)
+ */
+void ical_parser_reset(IcalParser *parser, void *user_data);
+
+/**
+ * Feed the next chunk of the document (any split, e.g. straight from a curl write callback)
+ * Handles RFC 5545 line unfolding (CRLF or LF followed by a space or tab) across chunks.
+ * Returns: 0 on success, -1 on invalid arguments
+ */
+int ical_parser_feed(IcalParser *parser, const char *data, size_t length);
+
+// Flush the last content line (call once at end of input)
+void ical_parser_finish(IcalParser *parser);
+
+// Number of content lines longer than ICAL_MAX_LINE_LENGTH that were truncated
+int ical_parser_truncated_lines(const IcalParser *parser);
+
+/**
+ * Look up a parameter in a raw parameter list ("TZID=Europe/Paris;VALUE=DATE")
+ * Returns: 1 if found (value copied, quotes removed), 0 otherwise
+ */
+int ical_param_value(const char *params, const char *name, char *value, size_t value_size);
+
+/**
+ * Decode TEXT escapes in place (\n and \N become a space, \, \; \\ are unescaped)
+ */
+void ical_unescape_text(char *text);
+
+#endif // ICAL_PARSER_H
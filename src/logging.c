@@ -1,20 +1,232 @@
+#define _GNU_SOURCE
 #include "logging.h"
 #include "common.h"
+#include "time_service.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <sys/stat.h>
+#include <sys/eventfd.h>
 #include <errno.h>
+#include <poll.h>
+#include <pthread.h>
 #include <unistd.h>
 
 // Global variables
 FILE *g_log_file = NULL;
 int g_debug_mode = 0;
 
+// ====================== RING BUFFER ======================
+
+// One queued line (bounded MPSC queue, sequence numbers as in Vyukov's bounded queue)
+typedef struct {
+    size_t sequence;            // == position: free, == position + 1: filled
+    time_t timestamp;
+    const char *level;
+    char message[LOG_MAX_MESSAGE_LENGTH];
+} LogSlot;
+
+static LogSlot g_ring[LOG_RING_SLOTS];
+static size_t g_enqueue_pos = 0;            // Claimed by producers (CAS)
+static size_t g_dequeue_pos = 0;            // Advanced by the writer only
+static size_t g_dropped = 0;                // Lines lost to a full ring
+
+// Writer thread state
+static pthread_t g_writer_thread;
+static int g_async_active = 0;
+static int g_wake_fd = -1;
+static int g_writer_idle = 0;               // Writer blocked without timeout: next line must wake it
+static int g_stopping = 0;
+static off_t g_file_bytes = 0;
+
+static void ring_init(void) {
+    for (size_t i = 0; i < LOG_RING_SLOTS; i++) {
+        g_ring[i].sequence = i;
+    }
+    g_enqueue_pos = 0;
+    g_dequeue_pos = 0;
+}
+
+static void wake_writer(void) {
+    uint64_t one = 1;
+    if (write(g_wake_fd, &one, sizeof(one)) < 0) {
+        // Counter saturated: the writer is already due to wake up
+    }
+}
+
+/**
+ * Queue one line without locks (any thread, never blocks)
+ * Returns: 0 on success, -1 if the ring is full (line dropped)
+ */
+static int ring_push(const char *level, int urgent, const char *format, va_list args) {
+    size_t position = __atomic_load_n(&g_enqueue_pos, __ATOMIC_RELAXED);
+    LogSlot *slot;
+
+    for (;;) {
+        slot = &g_ring[position % LOG_RING_SLOTS];
+        size_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0) {
+            if (__atomic_compare_exchange_n(&g_enqueue_pos, &position, position + 1, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (difference < 0) {
+            __atomic_fetch_add(&g_dropped, 1, __ATOMIC_RELAXED);
+            return -1;
+        } else {
+            position = __atomic_load_n(&g_enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->timestamp = time(NULL);
+    slot->level = level;
+    vsnprintf(slot->message, sizeof(slot->message), format, args);
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+
+    // Store then load, mirrored by the writer (idle flag then sequence): the full fence keeps
+    // the two sides from both missing each other, which release/acquire alone allows
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    // Wake the writer for errors, for a filling ring, or when it sleeps without a deadline
+    size_t backlog = position + 1 - __atomic_load_n(&g_dequeue_pos, __ATOMIC_RELAXED);
+    if (urgent || backlog >= LOG_RING_SLOTS / 2 || __atomic_exchange_n(&g_writer_idle, 0, __ATOMIC_ACQ_REL)) {
+        wake_writer();
+    }
+    return 0;
+}
+
+// ====================== WRITER THREAD ======================
+
+// Shift dashboard.log -> .1 -> .2 ... and reopen a fresh file
+static void rotate_log_file(void) {
+    char from[512];
+    char to[512];
+
+    fclose(g_log_file);
+    for (int i = LOG_ROTATE_KEEP - 1; i >= 1; i--) {
+        snprintf(from, sizeof(from), "%s.%d", LOG_FILE_PATH, i);
+        snprintf(to, sizeof(to), "%s.%d", LOG_FILE_PATH, i + 1);
+        rename(from, to);
+    }
+    snprintf(to, sizeof(to), "%s.1", LOG_FILE_PATH);
+    rename(LOG_FILE_PATH, to);
+
+    g_log_file = fopen(LOG_FILE_PATH, "a");
+    if (!g_log_file) {
+        fprintf(stderr, "Failed to reopen log file after rotation: %s\n", strerror(errno));
+    }
+    g_file_bytes = 0;
+}
+
+// Format every filled slot into the stdio buffer; returns lines written, urgent set on ERROR
+static int drain_ring(int *urgent) {
+    int lines = 0;
+
+    for (;;) {
+        LogSlot *slot = &g_ring[g_dequeue_pos % LOG_RING_SLOTS];
+        if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != g_dequeue_pos + 1) {
+            break;
+        }
+
+        if (g_log_file) {
+            struct tm tm_buf;
+            struct tm *tm_info = time_service_local(slot->timestamp, &tm_buf);
+            int written = fprintf(g_log_file, "[%04d-%02d-%02d %02d:%02d:%02d] [%s] %s\n",
+                                  tm_info ? tm_info->tm_year + 1900 : 0, tm_info ? tm_info->tm_mon + 1 : 0,
+                                  tm_info ? tm_info->tm_mday : 0, tm_info ? tm_info->tm_hour : 0,
+                                  tm_info ? tm_info->tm_min : 0, tm_info ? tm_info->tm_sec : 0,
+                                  slot->level, slot->message);
+            if (written > 0) g_file_bytes += written;
+        }
+        if (strcmp(slot->level, "ERROR") == 0) *urgent = 1;
+
+        __atomic_store_n(&slot->sequence, g_dequeue_pos + LOG_RING_SLOTS, __ATOMIC_RELEASE);
+        __atomic_store_n(&g_dequeue_pos, g_dequeue_pos + 1, __ATOMIC_RELAXED);
+        lines++;
+    }
+
+    size_t dropped = __atomic_exchange_n(&g_dropped, 0, __ATOMIC_RELAXED);
+    if (dropped > 0 && g_log_file) {
+        int written = fprintf(g_log_file, "[log] %zu lines dropped (ring buffer full)\n", dropped);
+        if (written > 0) g_file_bytes += written;
+    }
+
+    return lines;
+}
+
+static long elapsed_ms(const struct timespec *since) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - since->tv_sec) * 1000L + (now.tv_nsec - since->tv_nsec) / 1000000L;
+}
+
+// Batches lines and flushes on size, age, ERROR or shutdown
+static void* log_writer(void *arg __attribute__((unused))) {
+    size_t unflushed = 0;
+    struct timespec first_unflushed = {0, 0};
+
+    for (;;) {
+        int urgent = 0;
+        off_t before = g_file_bytes;
+        if (drain_ring(&urgent) > 0 && unflushed == 0) {
+            clock_gettime(CLOCK_MONOTONIC, &first_unflushed);
+        }
+        unflushed += (size_t)(g_file_bytes - before);
+
+        int stopping = __atomic_load_n(&g_stopping, __ATOMIC_ACQUIRE);
+        if (unflushed > 0 && (urgent || stopping || unflushed >= LOG_FLUSH_BYTES ||
+                              elapsed_ms(&first_unflushed) >= LOG_FLUSH_INTERVAL_MS)) {
+            if (g_log_file) fflush(g_log_file);
+            unflushed = 0;
+            if (g_log_file && g_file_bytes >= LOG_MAX_FILE_BYTES) {
+                rotate_log_file();
+            }
+        }
+
+        if (stopping) {
+            // Producers may still race in a last line; one final pass catches it
+            if (__atomic_load_n(&g_ring[g_dequeue_pos % LOG_RING_SLOTS].sequence, __ATOMIC_ACQUIRE) != g_dequeue_pos + 1) break;
+            continue;
+        }
+
+        // Sleep until the flush deadline, or indefinitely when everything is on disk
+        int timeout = -1;
+        if (unflushed > 0) {
+            long remaining = LOG_FLUSH_INTERVAL_MS - elapsed_ms(&first_unflushed);
+            timeout = remaining > 0 ? (int)remaining : 0;
+        } else {
+            __atomic_store_n(&g_writer_idle, 1, __ATOMIC_RELEASE);
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);    // Pairs with the fence in ring_push
+            // A line queued before the flag was visible would otherwise wait for the next one
+            if (__atomic_load_n(&g_ring[g_dequeue_pos % LOG_RING_SLOTS].sequence, __ATOMIC_ACQUIRE) ==
+                g_dequeue_pos + 1) {
+                __atomic_store_n(&g_writer_idle, 0, __ATOMIC_RELEASE);
+                continue;
+            }
+        }
+
+        struct pollfd pfd = { .fd = g_wake_fd, .events = POLLIN };
+        if (poll(&pfd, 1, timeout) > 0) {
+            uint64_t count;
+            if (read(g_wake_fd, &count, sizeof(count)) < 0) {
+                // Spurious wakeup: nothing to consume
+            }
+        }
+        __atomic_store_n(&g_writer_idle, 0, __ATOMIC_RELEASE);
+    }
+
+    return NULL;
+}
+
+// ====================== PUBLIC API ======================
+
 int init_logging(int debug_mode) {
     g_debug_mode = debug_mode;
-    
+
     if (debug_mode) {
-        // Debug mode: log to stdout
+        // Debug mode: log to stdout synchronously (keeps ordering with printf output)
         g_log_file = stdout;
         return 0;
     } else {
@@ -24,22 +236,47 @@ int init_logging(int debug_mode) {
             fprintf(stderr, "Failed to create log directory: %s\n", strerror(errno));
             return -1;
         }
-        
-        g_log_file = fopen(PROJECT_ROOT "/log/dashboard.log", "a");
+
+        g_log_file = fopen(LOG_FILE_PATH, "a");
         if (!g_log_file) {
             fprintf(stderr, "Failed to open log file: %s\n", strerror(errno));
             return -1;
         }
-        
+
+        struct stat st;
+        g_file_bytes = (fstat(fileno(g_log_file), &st) == 0) ? st.st_size : 0;
+
         // Write session start marker
         time_t now = time(NULL);
         fprintf(g_log_file, "\n=== Dashboard Session Started: %s", ctime(&now));
         fflush(g_log_file);
+
+        // Background writer: producers only format into the ring
+        ring_init();
+        g_stopping = 0;
+        g_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (g_wake_fd < 0 || pthread_create(&g_writer_thread, NULL, log_writer, NULL) != 0) {
+            fprintf(stderr, "Failed to start log writer, logging synchronously\n");
+            if (g_wake_fd >= 0) close(g_wake_fd);
+            g_wake_fd = -1;
+            return 0;
+        }
+        g_async_active = 1;
         return 0;
     }
 }
 
 void close_logging(void) {
+    if (g_async_active) {
+        // Writer drains and flushes everything queued before exiting
+        __atomic_store_n(&g_stopping, 1, __ATOMIC_RELEASE);
+        wake_writer();
+        pthread_join(g_writer_thread, NULL);
+        g_async_active = 0;
+        close(g_wake_fd);
+        g_wake_fd = -1;
+    }
+
     if (g_log_file && g_log_file != stdout && g_log_file != stderr) {
         time_t now = time(NULL);
         fprintf(g_log_file, "=== Dashboard Session Ended: %s\n", ctime(&now));
@@ -49,26 +286,32 @@ void close_logging(void) {
 }
 
 static void write_log(const char *level, const char *format, va_list args) {
+    if (g_async_active) {
+        ring_push(level, strcmp(level, "ERROR") == 0, format, args);
+        return;
+    }
+
     if (!g_log_file) return;
-    
+
     // Get timestamp
     time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
-    
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(now, &tm_info_buf);
+
     // Write timestamp and level
-    if (g_debug_mode) {
+    if (g_debug_mode || !tm_info) {
         // Debug mode: simplified format for stdout
         vfprintf(g_log_file, format, args);
         fprintf(g_log_file, "\n");
     } else {
-        // Production mode: full timestamp for log file
+        // Synchronous fallback: full timestamp for log file
         fprintf(g_log_file, "[%04d-%02d-%02d %02d:%02d:%02d] [%s] ",
                 tm_info->tm_year + 1900, tm_info->tm_mon + 1, tm_info->tm_mday,
                 tm_info->tm_hour, tm_info->tm_min, tm_info->tm_sec, level);
         vfprintf(g_log_file, format, args);
         fprintf(g_log_file, "\n");
     }
-    
+
     fflush(g_log_file);
 }
 
@@ -84,7 +327,7 @@ void log_error(const char *format, ...) {
     va_start(args, format);
     write_log("ERROR", format, args);
     va_end(args);
-    
+
     // Also write errors to stderr in production mode
     if (!g_debug_mode) {
         va_start(args, format);
@@ -104,4 +347,4 @@ void log_debug(const char *format, ...) {
         va_end(args);
     }
     // If not in debug mode, do nothing (write nothing)
-}
\ No newline at end of file
+}
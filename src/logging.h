@@ -5,6 +5,17 @@
 #include <time.h>
 #include <stdarg.h>
 
+// Production log file (rotated by size: dashboard.log.1 .. dashboard.log.LOG_ROTATE_KEEP)
+#define LOG_FILE_PATH PROJECT_ROOT "/log/dashboard.log"
+#define LOG_MAX_FILE_BYTES (2 * 1024 * 1024)
+#define LOG_ROTATE_KEEP 3
+
+// Asynchronous writer: lines are queued in a ring and flushed in batches
+#define LOG_RING_SLOTS 256                  // Power of two; lines are dropped (and counted) when full
+#define LOG_MAX_MESSAGE_LENGTH 512          // Longer messages are truncated
+#define LOG_FLUSH_BYTES (16 * 1024)         // Flush once this much is buffered...
+#define LOG_FLUSH_INTERVAL_MS 2000          // ...or the oldest buffered line is this old (ERROR flushes at once)
+
 // Global log file pointer
 extern FILE *g_log_file;
 extern int g_debug_mode;
@@ -12,7 +23,7 @@ extern int g_debug_mode;
 // Initialize logging system
 int init_logging(int debug_mode);
 
-// Close logging system
+// Close logging system (drains and flushes queued lines first)
 void close_logging(void);
 
 // Log functions
@@ -23,6 +34,11 @@ void log_debug(const char *format, ...);
 // Macros for easier logging
 #define LOG_INFO(fmt, ...) log_info(fmt, ##__VA_ARGS__)
 #define LOG_ERROR(fmt, ...) log_error(fmt, ##__VA_ARGS__)
+#ifdef LOG_NO_DEBUG
+// Release builds: debug lines are compiled out (arguments still type-checked, never evaluated)
+#define LOG_DEBUG(fmt, ...) do { if (0) log_debug(fmt, ##__VA_ARGS__); } while (0)
+#else
 #define LOG_DEBUG(fmt, ...) log_debug(fmt, ##__VA_ARGS__)
+#endif
 
 #endif // LOGGING_H
\ No newline at end of file
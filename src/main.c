@@ -12,17 +12,27 @@
 #include "calendar.h"
 #include "display_stdout.h"
 #include "display_dashboard.h"
+#include "dashboard_render.h"
+#include "eink_regions.h"
+#include "http.h"
 #include "logging.h"
+#include "time_service.h"
+#include "scheduler.h"
+#include "snapshot.h"
+#include "metrics.h"
+#include "poll_policy.h"
+#include "display_service.h"
+#include "state_store.h"
+#include "snapshot_feed.h"
 
 // Constants
-#define WEATHER_UPDATE_INTERVAL_MIN 10
 #define MENU_UPDATE_HOUR 0
 #define MENU_UPDATE_MIN 0
 #define MENU_UPDATE_SEC 0
+#define MENU_PREFETCH_HOUR 3    // Off-peak network refresh of the menu cache
+#define MENU_PREFETCH_MIN 30
 #define CALENDAR_UPDATE_MIN 0
 #define CALENDAR_UPDATE_SEC 0
-#define MAIN_LOOP_SLEEP_MS 100000  // 100ms
-#define THREAD_SLEEP_SEC 1
 #define DEFAULT_NOON_HOUR 12
 #define MIN_YEAR 1900
 #define MAX_YEAR 2100
@@ -30,7 +40,6 @@
 #define MAX_DAYS_PER_MONTH 31
 #define SECONDS_PER_MINUTE 60
 #define MINUTES_PER_HOUR 60
-#define RETRY_INTERVAL_MINUTES 5  // Retry failed retrievals every 5 minutes
 
 // ====================== DASHBOARD ORCHESTRATOR ======================
 
@@ -51,6 +60,7 @@ typedef struct {
     time_t weather_retry_time;  // Next retry time for weather (0 = no retry needed)
     time_t menu_retry_time;     // Next retry time for menu (0 = no retry needed)
     time_t calendar_retry_time; // Next retry time for calendar (0 = no retry needed)
+    time_t weather_next_poll;   // Next adaptive weather poll (0 = parked while a retry is pending), atomic
 } ComponentStatus;
 
 // Main orchestrator structure
@@ -59,21 +69,41 @@ typedef struct {
     MenuClient *menu_client;
     CalendarClient *calendar_client;
     
-    WeatherData weather_data;
+    // Published data lives in snapshots (snapshot.h); these are weather_lock private
     WeatherData previous_weather_data;  // For comparison to detect changes
     WeatherData cached_weather_data;    // Last successful weather data for fallback
-    MenuData menu_data;
-    CalendarData calendar_data;
     ComponentStatus status;
     
-    pthread_t clock_thread;
-    pthread_t weather_thread;
-    pthread_t menu_thread;
-    pthread_t calendar_thread;
+    // Adaptive weather polling and per-source retry backoff (guarded by data_mutex)
+    PollPolicy weather_poll;
+    RetryBackoff menu_backoff;
+    RetryBackoff calendar_backoff;
+    RetryBackoff prefetch_backoff;
+    
+    // Every periodic task runs as a job of one scheduler (NULL in debug mode)
+    Scheduler *scheduler;
+    int retry_job;
+    int weather_job;
+    int display_job;
+    int menu_prefetch_job;
+    int metrics_job;
+    volatile sig_atomic_t metrics_dump_requested;   // SIGUSR1: also log a summary
+    
+    // One lock per source serializes its fetches (retry vs scheduled run) without
+    // blocking the others; data_mutex only guards status and snapshot publication
+    pthread_mutex_t weather_lock;
+    pthread_mutex_t menu_lock;
+    pthread_mutex_t calendar_lock;
     pthread_mutex_t data_mutex;
     
     volatile int running;
     int debug;
+    int panel;                  // Drives an e-ink panel (production mode, not headless)
+    
+    // Producer/consumer split (snapshot_feed.h): one fetch pipeline, any number of panels
+    const char *feed_source;    // DASHBOARD_FEED_SOURCE: consumer, data comes from that producer
+    const char *feed_listen;    // DASHBOARD_FEED_LISTEN: producer, snapshots pushed to subscribers
+    int feed_serving;
 } DataOrchestrator;
 
 static DataOrchestrator *g_orchestrator = NULL;
@@ -86,8 +116,10 @@ static void update_eink_display_batched(DataOrchestrator *orch);
 
 // Utility function to check if two timestamps are in the same hour
 static int same_hour(time_t time1, time_t time2) {
-    struct tm *tm1 = localtime(&time1);
-    struct tm *tm2 = localtime(&time2);
+    struct tm tm1_buf;
+    struct tm *tm1 = time_service_local(time1, &tm1_buf);
+    struct tm tm2_buf;
+    struct tm *tm2 = time_service_local(time2, &tm2_buf);
     
     if (!tm1 || !tm2) return 0;
     
@@ -99,79 +131,83 @@ static int same_hour(time_t time1, time_t time2) {
 
 // Centralized function to update e-ink display based on batched changes
 static void update_eink_display_batched(DataOrchestrator *orch) {
-    if (orch->debug) return;  // Only in production mode
+    if (!orch->panel && !orch->feed_serving) return;  // Nothing consumes the batch (debug mode)
+    
+    // Take the change flags and a consistent snapshot together, then render without any lock
+    // (one reference for the local panel, one for the feed)
+    pthread_mutex_lock(&orch->data_mutex);
+    int weather_changed = orch->status.weather_changed;
+    int menu_changed = orch->status.menu_changed;
+    int calendar_changed = orch->status.calendar_changed;
+    orch->status.weather_changed = 0;
+    orch->status.menu_changed = 0;
+    orch->status.calendar_changed = 0;
+    const DashboardSnapshot *snapshot = snapshot_acquire();
+    const DashboardSnapshot *feed_snapshot = orch->feed_serving ? snapshot_acquire() : NULL;
+    pthread_mutex_unlock(&orch->data_mutex);
     
     // Check if any data has changed
-    int has_changes = orch->status.weather_changed || orch->status.menu_changed || orch->status.calendar_changed;
-    if (!has_changes) {
+    if (!weather_changed && !menu_changed && !calendar_changed) {
+        snapshot_release(snapshot);
+        if (feed_snapshot) snapshot_release(feed_snapshot);
         return;  // No changes, no need to refresh
     }
     
-    // Always use full refresh to prevent ghosting and maintain display quality
-    RefreshType refresh_type = REFRESH_FULL;
-    LOG_DEBUG("Using full refresh (prevents ghosting and maintains display quality)");
+    // Remote panels get the same batch: only the sources that changed go over the feed
+    if (feed_snapshot) {
+        snapshot_feed_broadcast((weather_changed ? FEED_WEATHER : 0) | (menu_changed ? FEED_MENU : 0) |
+                                (calendar_changed ? FEED_CALENDAR : 0), feed_snapshot);
+    }
+    if (!orch->panel) {
+        snapshot_release(snapshot);
+        return;
+    }
     
-    // Build update type description
+    // Build update type description and the set of sections to re-render
     char update_type[64] = "";
+    unsigned int sections = 0;
     int first = 1;
-    if (orch->status.weather_changed) {
+    if (weather_changed) {
         strcat(update_type, "weather");
+        sections |= SECTION_WEATHER;
         first = 0;
     }
-    if (orch->status.menu_changed) {
+    if (menu_changed) {
         if (!first) strcat(update_type, "+");
         strcat(update_type, "menu");
+        sections |= SECTION_MENU;
         first = 0;
     }
-    if (orch->status.calendar_changed) {
+    if (calendar_changed) {
         if (!first) strcat(update_type, "+");
         strcat(update_type, "calendar");
+        sections |= SECTION_CALENDAR;
     }
     
-    // Generate BMP for e-ink display (works with GUI_ReadBmp)
-    const char *temp_image = "dashboard_temp.bmp";
-    
-    const WeatherData *weather_ptr = orch->status.weather_available ? &orch->weather_data : NULL;
-    const MenuData *menu_ptr = orch->status.menu_available ? &orch->menu_data : NULL;
-    const CalendarData *calendar_ptr = orch->status.calendar_available ? &orch->calendar_data : NULL;
-    
-    // Use current time for display (not the startup date) to ensure time is always current
-    time_t current_time = time(NULL);
-    
-    if (generate_dashboard_bmp(temp_image, current_time, weather_ptr, menu_ptr, calendar_ptr)) {
-        // Display image using appropriate refresh type
-        int result = display_image_on_eink_with_refresh_type(temp_image, refresh_type);
-        
-        if (result == 0) {
-            const char *refresh_names[] = {"full", "fast", "partial"};
-            LOG_INFO("✅ E-ink display refreshed successfully (%s refresh - %s)", 
-                     refresh_names[refresh_type], update_type);
-        } else {
-            LOG_ERROR("❌ Failed to refresh e-ink display");
-        }
+    // The display service re-renders the changed sections and pushes only changed regions
+    // (ghosting policy may force full); this job never waits for the panel
+    uint64_t generation = snapshot->generation;
+    if (display_service_submit_dashboard(sections, snapshot) == 0) {
+        LOG_DEBUG("🖥️  Display refresh queued (%s, snapshot %llu)", update_type, (unsigned long long)generation);
     } else {
-        LOG_ERROR("❌ Failed to generate image for %s display", update_type);
+        LOG_ERROR("❌ Failed to queue e-ink display refresh (%s)", update_type);
     }
-    
-    // Reset all change flags after successful update
-    orch->status.weather_changed = 0;
-    orch->status.menu_changed = 0;
-    orch->status.calendar_changed = 0;
 }
 
 // Schedule a batched display update with delay to collect multiple changes
 static void schedule_batched_display_update(DataOrchestrator *orch) {
-    if (orch->debug) return;  // Only in production mode
+    if (!orch->panel && !orch->feed_serving) return;  // Nothing consumes the batch (debug mode)
     
     time_t now = time(NULL);
     orch->status.last_change_time = now;
     
-    // The actual update will be handled by checking pending updates periodically
+    // The display job fires once the batching window has passed without further changes
+    scheduler_wake_at(orch->scheduler, orch->display_job, now + BATCH_DELAY_SECONDS);
 }
 
 // Check if enough time has passed since last change to perform batched update
-static void check_and_perform_batched_update(DataOrchestrator *orch, time_t date) {
-    if (orch->debug) return;  // Only in production mode
+static void check_and_perform_batched_update(DataOrchestrator *orch, time_t now) {
+    if (!orch->panel && !orch->feed_serving) return;  // Nothing consumes the batch (debug mode)
     
     // Check if there are any pending changes
     int has_changes = orch->status.weather_changed || orch->status.menu_changed || orch->status.calendar_changed;
@@ -179,7 +215,6 @@ static void check_and_perform_batched_update(DataOrchestrator *orch, time_t date
         return;  // No changes pending
     }
     
-    time_t now = time(NULL);
     // Check if enough time has passed since the last change
     if (now - orch->status.last_change_time >= BATCH_DELAY_SECONDS) {
         update_eink_display_batched(orch);
@@ -191,6 +226,7 @@ static void check_and_perform_batched_update(DataOrchestrator *orch, time_t date
 void signal_handler(int sig __attribute__((unused))) {
     if (g_orchestrator) {
         g_orchestrator->running = 0;
+        scheduler_stop(g_orchestrator->scheduler);
         LOG_INFO("\n🛑 Interrupt detected");
         
         // Clean shutdown - let the main loop handle cleanup
@@ -198,31 +234,48 @@ void signal_handler(int sig __attribute__((unused))) {
     }
 }
 
-// Initialize orchestrator with comprehensive error checking
-DataOrchestrator* orchestrator_init(int debug) {
-    DataOrchestrator *orch = malloc(sizeof(DataOrchestrator));
-    if (!orch) {
-        fprintf(stderr, "Error: Failed to allocate memory for orchestrator\n");
-        return NULL;
+// SIGUSR1: dump metrics now (the handler only flags it and wakes the scheduler)
+void metrics_signal_handler(int sig __attribute__((unused))) {
+    if (g_orchestrator) {
+        g_orchestrator->metrics_dump_requested = 1;
+        scheduler_trigger(g_orchestrator->scheduler, g_orchestrator->metrics_job);
     }
-    
-    memset(orch, 0, sizeof(DataOrchestrator));
-    orch->debug = debug;
-    orch->running = 0;
-    
-    // Initialize logging system
-    if (init_logging(debug) != 0) {
-        fprintf(stderr, "Error: Failed to initialize logging\n");
-        free(orch);
-        return NULL;
+}
+
+// Fast cold start: republish the data saved with the last refresh and adopt the frame left on the
+// panel, so something is shown before the first fetch completes (menu and calendar only if saved today)
+static void restore_persisted_state(DataOrchestrator *orch) {
+    PersistedState state;
+    if (state_store_open(&state) != 0) {
+        return;
     }
     
-    if (pthread_mutex_init(&orch->data_mutex, NULL) != 0) {
-        fprintf(stderr, "Error: Failed to initialize mutex\n");
-        free(orch);
-        return NULL;
+    int same_day = time_service_date_int(state.saved_at) == time_service_date_int(time(NULL));
+    if (state.weather) {
+        orch->cached_weather_data = *state.weather;
+        orch->previous_weather_data = *state.weather;
+        snapshot_publish_weather(state.weather);
+    }
+    if (state.menu && same_day) {
+        snapshot_publish_menu(state.menu);
+    }
+    CalendarData calendar;
+    if (same_day && state_store_calendar(&state, &calendar) == 0) {
+        snapshot_publish_calendar(&calendar);  // Snapshot now owns the events and titles
+    }
+    if (state.frame) {
+        eink_restore_frame(state.frame, state.frame_size, state.saved_at, state.panel.panel_cleared,
+                           state.panel.partial_count, state.panel.last_full_time);
     }
     
+    LOG_INFO("💾 Restored last dashboard state (weather %s, menu %s, calendar %s, frame %s)",
+             state.weather ? "yes" : "no", state.menu && same_day ? "yes" : "no",
+             state.has_calendar && same_day ? "yes" : "no", state.frame ? "yes" : "no");
+    state_store_close(&state);
+}
+
+// Fetch clients of the producer (the process that talks to Open-Meteo, Sheets and iCal)
+static void init_source_clients(DataOrchestrator *orch, int debug) {
     // Initialize clients with error checking
     orch->weather_client = weather_client_init("https://api.open-meteo.com", 
                                               WEATHER_LATITUDE, WEATHER_LONGITUDE, debug);
@@ -254,13 +307,63 @@ DataOrchestrator* orchestrator_init(int debug) {
         LOG_ERROR("Warning: DASHBOARD_ICAL_URL environment variable not set, calendar client not initialized");
         orch->calendar_client = NULL;
     }
+}
+
+// Initialize orchestrator with comprehensive error checking
+DataOrchestrator* orchestrator_init(int debug, int headless) {
+    DataOrchestrator *orch = malloc(sizeof(DataOrchestrator));
+    if (!orch) {
+        fprintf(stderr, "Error: Failed to allocate memory for orchestrator\n");
+        return NULL;
+    }
+    
+    memset(orch, 0, sizeof(DataOrchestrator));
+    orch->debug = debug;
+    orch->panel = !debug && !headless;
+    orch->running = 0;
+    orch->retry_job = -1;
+    orch->weather_job = -1;
+    orch->display_job = -1;
+    orch->menu_prefetch_job = -1;
+    orch->metrics_job = -1;
+    
+    // Initialize logging system
+    if (init_logging(debug) != 0) {
+        fprintf(stderr, "Error: Failed to initialize logging\n");
+        free(orch);
+        return NULL;
+    }
+    
+    if (pthread_mutex_init(&orch->data_mutex, NULL) != 0 ||
+        pthread_mutex_init(&orch->weather_lock, NULL) != 0 ||
+        pthread_mutex_init(&orch->menu_lock, NULL) != 0 ||
+        pthread_mutex_init(&orch->calendar_lock, NULL) != 0) {
+        fprintf(stderr, "Error: Failed to initialize mutex\n");
+        free(orch);
+        return NULL;
+    }
+    
+    if (snapshot_init() != 0) {
+        fprintf(stderr, "Error: Failed to initialize data snapshots\n");
+        free(orch);
+        return NULL;
+    }
+    
+    // A consumer takes weather, menu and calendar from its producer instead of fetching them
+    orch->feed_source = getenv("DASHBOARD_FEED_SOURCE");
+    orch->feed_listen = getenv("DASHBOARD_FEED_LISTEN");
+    if (orch->feed_source) {
+        LOG_INFO("📡 Consumer mode: dashboard data comes from %s", orch->feed_source);
+    } else {
+        init_source_clients(orch, debug);
+    }
+    if (headless && !orch->feed_listen) {
+        LOG_ERROR("⚠️  Headless without DASHBOARD_FEED_LISTEN: nothing will show the data");
+    }
     
     // Initialize data structures
-    memset(&orch->calendar_data, 0, sizeof(CalendarData));
-    memset(&orch->weather_data, 0, sizeof(WeatherData));
     memset(&orch->previous_weather_data, 0, sizeof(WeatherData));
     memset(&orch->cached_weather_data, 0, sizeof(WeatherData));
-    memset(&orch->menu_data, 0, sizeof(MenuData));
     
     // Initialize component status
     memset(&orch->status, 0, sizeof(ComponentStatus));
@@ -271,14 +374,58 @@ DataOrchestrator* orchestrator_init(int debug) {
     orch->status.weather_retry_time = 0;
     orch->status.menu_retry_time = 0;
     orch->status.calendar_retry_time = 0;
+    orch->status.weather_next_poll = 0;
+    
+    poll_policy_init(&orch->weather_poll, POLL_DEFAULT_BASE_INTERVAL, POLL_DEFAULT_MAX_INTERVAL);
+    retry_backoff_init(&orch->menu_backoff, RETRY_BACKOFF_BASE, RETRY_BACKOFF_MAX);
+    retry_backoff_init(&orch->calendar_backoff, RETRY_BACKOFF_BASE, RETRY_BACKOFF_MAX);
+    retry_backoff_init(&orch->prefetch_backoff, RETRY_BACKOFF_BASE, RETRY_BACKOFF_MAX);
     
     LOG_DEBUG("🚀 Orchestrator initialized");
     
-    // Initialize e-ink hardware for time updates (only in non-debug mode)
-    if (!debug) {
+    // Per-section quantizer overrides (threshold, bayer, floyd-steinberg, atkinson)
+    const struct { const char *env; DashboardSection section; } dither_env[] = {
+        {"DASHBOARD_DITHER_HEADER", SECTION_HEADER},
+        {"DASHBOARD_DITHER_WEATHER", SECTION_WEATHER},
+        {"DASHBOARD_DITHER_MENU", SECTION_MENU},
+        {"DASHBOARD_DITHER_CALENDAR", SECTION_CALENDAR}
+    };
+    for (size_t i = 0; i < sizeof(dither_env) / sizeof(dither_env[0]); i++) {
+        const char *value = getenv(dither_env[i].env);
+        DitherMode mode;
+        if (!value) continue;
+        if (dither_mode_from_name(value, &mode)) {
+            configure_eink_dithering(dither_env[i].section, mode);
+        } else {
+            LOG_ERROR("⚠️  Unknown dither mode '%s' for %s", value, dither_env[i].env);
+        }
+    }
+    
+    // Render profile: sections shown below the header and their order (default layout if invalid)
+    const char *layout = getenv("DASHBOARD_LAYOUT");
+    if (layout) {
+        configure_dashboard_layout(layout);
+    }
+    
+    // Initialize e-ink hardware for time updates (only when driving a panel)
+    if (orch->panel) {
+        // Ghosting policy for partial region updates (overridable from environment)
+        const char *full_every = getenv("DASHBOARD_FULL_REFRESH_EVERY");
+        const char *full_hour = getenv("DASHBOARD_FULL_REFRESH_HOUR");
+        configure_eink_ghosting_policy(full_every ? atoi(full_every) : GHOSTING_DEFAULT_FULL_EVERY,
+                                       full_hour ? atoi(full_hour) : GHOSTING_DEFAULT_NIGHTLY_HOUR);
+        
+        // Before the hardware init, which then skips the clear for a restored frame
+        restore_persisted_state(orch);
+        
         if (init_eink_hardware() != 0) {
             LOG_ERROR("⚠️  Failed to initialize e-ink hardware");
         }
+        
+        // From here on only the display service thread touches the panel
+        if (display_service_start() != 0) {
+            LOG_ERROR("⚠️  Failed to start display service");
+        }
     }
     
     return orch;
@@ -290,18 +437,17 @@ void orchestrator_free(DataOrchestrator *orch) {
     
     orch->running = 0;
 
-    // Wait for all threads to complete
-    if (orch->clock_thread) {
-        pthread_join(orch->clock_thread, NULL);
-    }
-    if (orch->weather_thread) {
-        pthread_join(orch->weather_thread, NULL);
-    }
-    if (orch->menu_thread) {
-        pthread_join(orch->menu_thread, NULL);
-    }
-    if (orch->calendar_thread) {
-        pthread_join(orch->calendar_thread, NULL);
+    // Wait for running jobs to complete, then for the refresh in progress
+    scheduler_free(orch->scheduler);
+    orch->scheduler = NULL;
+    snapshot_feed_stop();
+    display_service_stop();
+    
+    // Save the last frame and data for the next cold start (the panel is cleared right after)
+    if (orch->panel) {
+        const DashboardSnapshot *snapshot = snapshot_acquire();
+        display_service_save_state(snapshot, 1);
+        snapshot_release(snapshot);
     }
 
     // Clean up clients
@@ -316,87 +462,106 @@ void orchestrator_free(DataOrchestrator *orch) {
     // Clean up logging system
     close_logging();
     
-    // Clean up data structures
-    calendar_data_free(&orch->calendar_data);
+    // Clean up published data and pooled calendar buffers
+    snapshot_cleanup();
+    calendar_cleanup();
     
     // Clean up synchronization
     pthread_mutex_destroy(&orch->data_mutex);
+    pthread_mutex_destroy(&orch->weather_lock);
+    pthread_mutex_destroy(&orch->menu_lock);
+    pthread_mutex_destroy(&orch->calendar_lock);
     
     free(orch);
 }
 
-// Update weather data with status tracking
+// Update weather data with status tracking (network fetch outside data_mutex)
 void update_weather(DataOrchestrator *orch) {
     if (!orch) return;
     
+    pthread_mutex_lock(&orch->weather_lock);
+    
+    WeatherData new_weather_data;
+    memset(&new_weather_data, 0, sizeof(WeatherData));
+    int result = orch->weather_client ? get_weather_data(orch->weather_client, &new_weather_data) : -1;
+    
     pthread_mutex_lock(&orch->data_mutex);
     
-    if (orch->weather_client) {
-        WeatherData new_weather_data;
-        memset(&new_weather_data, 0, sizeof(WeatherData));
+    if (!orch->weather_client) {
+        orch->status.weather_available = 0;
+        snprintf(orch->status.weather_error, sizeof(orch->status.weather_error), 
+                "Weather client not initialized");
+        snapshot_publish_weather(NULL);
+    } else if (result == 0) {
+        // Weather retrieval successful
+        orch->status.weather_available = 1;
+        orch->status.weather_error[0] = '\0';
         
-        int result = get_weather_data(orch->weather_client, &new_weather_data);
-        if (result == 0) {
-            // Weather retrieval successful
+        // Check if weather data actually changed
+        int data_changed = weather_data_changed(&new_weather_data, &orch->previous_weather_data);
+        orch->status.weather_changed = data_changed;
+        
+        if (data_changed) {
+            LOG_INFO("✅ Weather data updated successfully (data changed)");
+        } else {
+            LOG_DEBUG("🌤️  Weather data refreshed (no significant changes)");
+        }
+        
+        // Store previous data and update cached data for fallback (always store successful data)
+        orch->previous_weather_data = orch->cached_weather_data;
+        orch->cached_weather_data = new_weather_data;
+        snapshot_publish_weather(&new_weather_data);
+        
+        // Clear retry timer on success and plan the next poll from the change rate and cache headers
+        time_t now = time(NULL);
+        orch->status.weather_retry_time = 0;
+        poll_policy_record_success(&orch->weather_poll, now, data_changed,
+                                   weather_client_max_age(orch->weather_client));
+        // Rescheduled here, not at dispatch: the plan needs this poll's outcome (and may be later)
+        time_t next_poll = poll_policy_next(&orch->weather_poll, now);
+        __atomic_store_n(&orch->status.weather_next_poll, next_poll, __ATOMIC_RELEASE);
+        scheduler_reschedule(orch->scheduler, orch->weather_job, next_poll);
+        LOG_DEBUG("🌤️  Next weather poll in %ld seconds (%d unchanged in a row)",
+                  (long)(next_poll - now), orch->weather_poll.unchanged_streak);
+    } else {
+        // Weather retrieval failed - implement hourly boundary fallback
+        time_t now = time(NULL);
+        
+        // Check if we have cached weather data and if it's from the same hour
+        if (orch->cached_weather_data.last_updated > 0 && same_hour(now, orch->cached_weather_data.last_updated)) {
+            // Within same hour - use cached data
             orch->status.weather_available = 1;
             orch->status.weather_error[0] = '\0';
             
-            // Check if weather data actually changed
-            int data_changed = weather_data_changed(&new_weather_data, &orch->previous_weather_data);
-            orch->status.weather_changed = data_changed;
-            
-            if (data_changed) {
-                LOG_INFO("✅ Weather data updated successfully (data changed)");
-            } else {
-                LOG_DEBUG("🌤️  Weather data refreshed (no significant changes)");
-            }
-            
-            // Store previous data and update current data
-            orch->previous_weather_data = orch->weather_data;
-            orch->weather_data = new_weather_data;
+            // Use cached data but don't mark as changed (prevents unnecessary updates)
+            snapshot_publish_weather(&orch->cached_weather_data);
+            orch->status.weather_changed = 0;
             
-            // Update cached data for fallback (always store successful data)
-            orch->cached_weather_data = new_weather_data;
-            
-            // Clear retry timer on success
-            orch->status.weather_retry_time = 0;
+            LOG_INFO("🌤️  Using cached weather data (retrieval failed but within same hour)");
         } else {
-            // Weather retrieval failed - implement hourly boundary fallback
-            time_t now = time(NULL);
-            
-            // Check if we have cached weather data and if it's from the same hour
-            if (orch->cached_weather_data.last_updated > 0 && same_hour(now, orch->cached_weather_data.last_updated)) {
-                // Within same hour - use cached data
-                orch->status.weather_available = 1;
-                orch->status.weather_error[0] = '\0';
-                
-                // Use cached data but don't mark as changed (prevents unnecessary updates)
-                orch->weather_data = orch->cached_weather_data;
-                orch->status.weather_changed = 0;
-                
-                LOG_INFO("🌤️  Using cached weather data (retrieval failed but within same hour)");
-            } else {
-                // Outside same hour or no cached data - show error
-                orch->status.weather_available = 0;
-                snprintf(orch->status.weather_error, sizeof(orch->status.weather_error), 
-                        "Failed to retrieve weather data");
-                LOG_ERROR("❌ Weather data retrieval failed and outside cached hour - showing error");
-            }
-            
-            // Schedule retry in 5 minutes (regardless of fallback behavior)
-            orch->status.weather_retry_time = now + (RETRY_INTERVAL_MINUTES * 60);
-            LOG_DEBUG("🔄 Weather retry scheduled for %ld seconds from now", RETRY_INTERVAL_MINUTES * 60);
+            // Outside same hour or no cached data - show error
+            orch->status.weather_available = 0;
+            snprintf(orch->status.weather_error, sizeof(orch->status.weather_error), 
+                    "Failed to retrieve weather data");
+            snapshot_publish_weather(NULL);
+            LOG_ERROR("❌ Weather data retrieval failed and outside cached hour - showing error");
         }
-    } else {
-        orch->status.weather_available = 0;
-        snprintf(orch->status.weather_error, sizeof(orch->status.weather_error), 
-                "Weather client not initialized");
+        
+        // Back off exponentially (regardless of fallback behavior); the regular poll waits for the retry
+        orch->status.weather_retry_time = poll_policy_record_failure(&orch->weather_poll, now);
+        __atomic_store_n(&orch->status.weather_next_poll, SCHEDULER_NEVER, __ATOMIC_RELEASE);
+        scheduler_reschedule(orch->scheduler, orch->weather_job, SCHEDULER_NEVER);
+        scheduler_wake_at(orch->scheduler, orch->retry_job, orch->status.weather_retry_time);
+        LOG_DEBUG("🔄 Weather retry scheduled for %ld seconds from now", (long)(orch->status.weather_retry_time - now));
     }
     
+    int weather_changed = orch->status.weather_changed;
     pthread_mutex_unlock(&orch->data_mutex);
+    pthread_mutex_unlock(&orch->weather_lock);
     
     time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(now, &tm_info_buf);
     if (tm_info) {
         LOG_DEBUG("🌤️  Weather updated: %02d:%02d:%02d (status: %s)", 
                tm_info->tm_hour, tm_info->tm_min, tm_info->tm_sec,
@@ -404,45 +569,56 @@ void update_weather(DataOrchestrator *orch) {
     }
     
     // Schedule batched display update if weather changed
-    if (orch->status.weather_changed) {
+    if (weather_changed) {
         schedule_batched_display_update(orch);
     }
 }
 
-// Update menu data with status tracking
+// Update menu data with status tracking (network fetch outside data_mutex)
 void update_menu(DataOrchestrator *orch, time_t date) {
     if (!orch) return;
     
+    pthread_mutex_lock(&orch->menu_lock);
+    
+    MenuData new_menu_data;
+    memset(&new_menu_data, 0, sizeof(MenuData));
+    int result = orch->menu_client ? get_menus_data(orch->menu_client, &new_menu_data, date) : -1;
+    
     pthread_mutex_lock(&orch->data_mutex);
     
-    if (orch->menu_client) {
-        int result = get_menus_data(orch->menu_client, &orch->menu_data, date);
-        if (result == 0) {
-            orch->status.menu_available = 1;
-            orch->status.menu_error[0] = '\0';
-            orch->status.menu_changed = 1;  // Mark menu as changed
-            orch->status.menu_retry_time = 0;  // Clear retry timer on success
-            LOG_INFO("✅ Menu data updated successfully");
-        } else {
-            orch->status.menu_available = 0;
-            snprintf(orch->status.menu_error, sizeof(orch->status.menu_error), 
-                    "Failed to retrieve menu data");
-            
-            // Schedule retry in 5 minutes
-            time_t now = time(NULL);
-            orch->status.menu_retry_time = now + (RETRY_INTERVAL_MINUTES * 60);
-            LOG_ERROR("❌ Menu data retrieval failed - retry scheduled in %d minutes", RETRY_INTERVAL_MINUTES);
-        }
-    } else {
+    if (!orch->menu_client) {
         orch->status.menu_available = 0;
         snprintf(orch->status.menu_error, sizeof(orch->status.menu_error), 
                 "Menu client not initialized");
+        snapshot_publish_menu(NULL);
+    } else if (result == 0) {
+        orch->status.menu_available = 1;
+        orch->status.menu_error[0] = '\0';
+        orch->status.menu_changed = 1;  // Mark menu as changed
+        orch->status.menu_retry_time = 0;  // Clear retry timer on success
+        retry_backoff_reset(&orch->menu_backoff);
+        snapshot_publish_menu(&new_menu_data);
+        LOG_INFO("✅ Menu data updated successfully");
+    } else {
+        orch->status.menu_available = 0;
+        snprintf(orch->status.menu_error, sizeof(orch->status.menu_error), 
+                "Failed to retrieve menu data");
+        snapshot_publish_menu(NULL);
+        
+        // Schedule retry with jittered exponential backoff
+        int delay = retry_backoff_next_delay(&orch->menu_backoff);
+        orch->status.menu_retry_time = time(NULL) + delay;
+        scheduler_wake_at(orch->scheduler, orch->retry_job, orch->status.menu_retry_time);
+        LOG_ERROR("❌ Menu data retrieval failed - retry scheduled in %d seconds", delay);
     }
     
+    int menu_changed = orch->status.menu_changed;
     pthread_mutex_unlock(&orch->data_mutex);
+    pthread_mutex_unlock(&orch->menu_lock);
     
     time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(now, &tm_info_buf);
     if (tm_info) {
         LOG_DEBUG("📋 Menu updated: %02d:%02d:%02d (status: %s)", 
                tm_info->tm_hour, tm_info->tm_min, tm_info->tm_sec,
@@ -450,50 +626,75 @@ void update_menu(DataOrchestrator *orch, time_t date) {
     }
     
     // Schedule batched display update if menu changed
-    if (orch->status.menu_changed) {
+    if (menu_changed) {
         schedule_batched_display_update(orch);
     }
 }
 
-// Update calendar data with status tracking
-void update_calendar(DataOrchestrator *orch, time_t date) {
+/**
+ * Publish the calendar window for date (network fetch outside data_mutex)
+ * refresh: download the feed first (conditional GET); otherwise, or when the download
+ * fails, the window comes from the event index of the last good feed.
+ */
+static void update_calendar_window(DataOrchestrator *orch, time_t date, int refresh) {
     if (!orch) return;
     
-    pthread_mutex_lock(&orch->data_mutex);
+    pthread_mutex_lock(&orch->calendar_lock);
     
+    // Refresh the index, then an index lookup (previous data kept when nothing changed)
+    CalendarData new_calendar_data;
+    memset(&new_calendar_data, 0, sizeof(CalendarData));
+    int fetch = 0;
+    int result = -1;
     if (orch->calendar_client) {
-        // Free previous calendar data
-        calendar_data_free(&orch->calendar_data);
-        
-        // Fetch and process calendar data
-        // Fetch and process calendar data (restored)
-        int result = get_calendar_events_data(orch->calendar_client, &orch->calendar_data, date);
-        if (result == 0) {
-            orch->status.calendar_available = 1;
-            orch->status.calendar_error[0] = '\0';
-            orch->status.calendar_changed = 1;  // Mark calendar as changed
-            orch->status.calendar_retry_time = 0;  // Clear retry timer on success
-            LOG_INFO("✅ Calendar data updated successfully");
-        } else {
-            orch->status.calendar_available = 0;
-            snprintf(orch->status.calendar_error, sizeof(orch->status.calendar_error), 
-                    "Failed to retrieve calendar data");
-            
-            // Schedule retry in 5 minutes
-            time_t now = time(NULL);
-            orch->status.calendar_retry_time = now + (RETRY_INTERVAL_MINUTES * 60);
-            LOG_ERROR("❌ Calendar data retrieval failed - retry scheduled in %d minutes", RETRY_INTERVAL_MINUTES);
-        }
-    } else {
+        fetch = refresh ? refresh_calendar_index(orch->calendar_client) : CALENDAR_NOT_MODIFIED;
+        result = query_calendar_events(orch->calendar_client, &new_calendar_data, date);
+    }
+    
+    pthread_mutex_lock(&orch->data_mutex);
+    
+    if (!orch->calendar_client) {
         orch->status.calendar_available = 0;
         snprintf(orch->status.calendar_error, sizeof(orch->status.calendar_error), 
                 "Calendar client not initialized");
+        snapshot_publish_calendar(NULL);
+    } else if (result == 0) {
+        orch->status.calendar_available = 1;
+        orch->status.calendar_error[0] = '\0';
+        orch->status.calendar_changed = 1;  // Mark calendar as changed
+        snapshot_publish_calendar(&new_calendar_data);  // Snapshot now owns the events and titles
+        LOG_INFO(fetch == 0 ? "✅ Calendar data updated successfully" : "✅ Calendar window rebuilt from the event index");
+    } else if (result == CALENDAR_NOT_MODIFIED) {
+        orch->status.calendar_available = 1;
+        orch->status.calendar_error[0] = '\0';
+        LOG_DEBUG("📅 Calendar unchanged (not modified)");
+    } else {
+        calendar_data_free(&new_calendar_data);
+        orch->status.calendar_available = 0;
+        snprintf(orch->status.calendar_error, sizeof(orch->status.calendar_error), 
+                "Failed to retrieve calendar data");
+        snapshot_publish_calendar(NULL);
     }
     
+    // A failed download is retried even while the last feed still fills the section
+    if (orch->calendar_client && (fetch < 0 || result < 0)) {
+        int delay = retry_backoff_next_delay(&orch->calendar_backoff);
+        orch->status.calendar_retry_time = time(NULL) + delay;
+        scheduler_wake_at(orch->scheduler, orch->retry_job, orch->status.calendar_retry_time);
+        LOG_ERROR("❌ Calendar data retrieval failed - retry scheduled in %d seconds%s", delay,
+                  result >= 0 ? " (showing the last downloaded feed)" : "");
+    } else if (refresh && orch->calendar_client) {
+        orch->status.calendar_retry_time = 0;  // Clear retry timer on success
+        retry_backoff_reset(&orch->calendar_backoff);
+    }
+    
+    int calendar_changed = orch->status.calendar_changed;
     pthread_mutex_unlock(&orch->data_mutex);
+    pthread_mutex_unlock(&orch->calendar_lock);
     
     time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(now, &tm_info_buf);
     if (tm_info) {
         LOG_DEBUG("📅 Calendar updated: %02d:%02d:%02d (status: %s)", 
                tm_info->tm_hour, tm_info->tm_min, tm_info->tm_sec,
@@ -501,210 +702,308 @@ void update_calendar(DataOrchestrator *orch, time_t date) {
     }
     
     // Schedule batched display update if calendar changed
-    if (orch->status.calendar_changed) {
+    if (calendar_changed) {
         schedule_batched_display_update(orch);
     }
 }
 
+// Fetch (conditionally) and publish the calendar for date
+void update_calendar(DataOrchestrator *orch, time_t date) {
+    update_calendar_window(orch, date, 1);
+}
+
 // Check for and handle pending retries
-void check_and_handle_retries(DataOrchestrator *orch, time_t date) {
+void check_and_handle_retries(DataOrchestrator *orch, time_t now) {
     if (!orch) return;
     
-    time_t now = time(NULL);
-    
     // Check weather retry
     if (orch->status.weather_retry_time > 0 && now >= orch->status.weather_retry_time) {
         LOG_DEBUG("🔄 Attempting weather data retry...");
+        metrics_count(METRIC_RETRY_WEATHER);
         update_weather(orch);
     }
     
     // Check menu retry
     if (orch->status.menu_retry_time > 0 && now >= orch->status.menu_retry_time) {
         LOG_DEBUG("🔄 Attempting menu data retry...");
+        metrics_count(METRIC_RETRY_MENU);
         update_menu(orch, now);
     }
     
     // Check calendar retry
     if (orch->status.calendar_retry_time > 0 && now >= orch->status.calendar_retry_time) {
         LOG_DEBUG("🔄 Attempting calendar data retry...");
+        metrics_count(METRIC_RETRY_CALENDAR);
         update_calendar(orch, now);
     }
 }
 
-// Clock update thread with input validation
-void* clock_updater(void *arg) {
-    DataOrchestrator *orch = (DataOrchestrator*)arg;
-    
-    if (!orch) {
-        return NULL;
+// ====================== SCHEDULE ======================
+
+// Next local occurrence of hour:min:sec strictly after now
+static time_t next_daily_time(time_t now, int hour, int min, int sec) {
+    struct tm tm_now_buf;
+    struct tm *tm_now = time_service_local(now, &tm_now_buf);
+    if (!tm_now) {
+        return SCHEDULER_NEVER;
     }
     
-    while (orch->running) {
-        time_t now = time(NULL);
-        struct tm *tm_now = localtime(&now);
-        
-        if (!tm_now) {
-            break;
-        }
-        
-        int seconds_until_next_minute = SECONDS_PER_MINUTE - tm_now->tm_sec;
-        
-        // Break the sleep into smaller chunks to check running flag
-        for (int i = 0; i < seconds_until_next_minute && orch->running; i++) {
-            sleep(THREAD_SLEEP_SEC);
-        }
-        
-        if (orch->running) {
-            // Use partial refresh for time updates - based on working display_time_test.c
-            if (!orch->debug) {
-                if (refresh_time_partial() == 0) {
-                    LOG_DEBUG("⏰ Time display updated via partial refresh: %02d:%02d", tm_now->tm_hour, tm_now->tm_min);
-                } else {
-                    LOG_ERROR("❌ Failed to update time display via partial refresh");
-                }
-            } else {
-                LOG_DEBUG("⏰ Clock updated: %02d:%02d", tm_now->tm_hour, tm_now->tm_min);
-            }
-        }
+    struct tm tm_next = *tm_now;
+    tm_next.tm_hour = hour;
+    tm_next.tm_min = min;
+    tm_next.tm_sec = sec;
+    tm_next.tm_isdst = -1;
+    
+    time_t next = time_service_mktime(&tm_next);
+    if (next != -1 && next <= now) {
+        tm_next.tm_mday += 1;
+        tm_next.tm_hour = hour;
+        tm_next.tm_min = min;
+        tm_next.tm_sec = sec;
+        tm_next.tm_isdst = -1;
+        next = time_service_mktime(&tm_next);
     }
-    
-    return NULL;
+    return next == -1 ? SCHEDULER_NEVER : next;
+}
+
+static time_t next_minute(time_t now, void *arg __attribute__((unused))) {
+    return (now / SECONDS_PER_MINUTE + 1) * SECONDS_PER_MINUTE;
 }
 
-// Weather update thread with improved scheduling
-void* weather_updater(void *arg) {
+// Planned by update_weather from the poll policy, which reschedules the job after each poll
+// (parked while a weather retry is pending). At dispatch the planned time is the one being run,
+// so the base interval only stands in until the poll completes.
+// Called under the scheduler lock: reads the planned time atomically, never takes data_mutex
+static time_t next_weather_time(time_t now, void *arg) {
     DataOrchestrator *orch = (DataOrchestrator*)arg;
+    time_t next = __atomic_load_n(&orch->status.weather_next_poll, __ATOMIC_ACQUIRE);
+    if (next == SCHEDULER_NEVER) {
+        return SCHEDULER_NEVER;
+    }
     
-    if (!orch) {
-        return NULL;
+    return next > now ? next : now + POLL_DEFAULT_BASE_INTERVAL;
+}
+
+static time_t next_calendar_time(time_t now, void *arg __attribute__((unused))) {
+    struct tm tm_now_buf;
+    struct tm *tm_now = time_service_local(now, &tm_now_buf);
+    if (!tm_now) {
+        return SCHEDULER_NEVER;
     }
     
-    while (orch->running) {
-        time_t now = time(NULL);
-        struct tm *tm_now = localtime(&now);
-        
-        if (!tm_now) {
-            break;
+    struct tm tm_next = *tm_now;
+    tm_next.tm_hour += 1;
+    tm_next.tm_min = CALENDAR_UPDATE_MIN;
+    tm_next.tm_sec = CALENDAR_UPDATE_SEC;
+    tm_next.tm_isdst = -1;
+    
+    time_t next = time_service_mktime(&tm_next);
+    return next == -1 ? SCHEDULER_NEVER : next;
+}
+
+static time_t next_menu_rollover(time_t now, void *arg __attribute__((unused))) {
+    return next_daily_time(now, MENU_UPDATE_HOUR, MENU_UPDATE_MIN, MENU_UPDATE_SEC);
+}
+
+static time_t next_menu_prefetch(time_t now, void *arg __attribute__((unused))) {
+    return next_daily_time(now, MENU_PREFETCH_HOUR, MENU_PREFETCH_MIN, 0);
+}
+
+static time_t next_metrics_write(time_t now, void *arg __attribute__((unused))) {
+    return now - now % METRICS_WRITE_INTERVAL_SEC + METRICS_WRITE_INTERVAL_SEC;
+}
+
+// Earliest pending retry (parked when nothing failed; update_* wake the job)
+static time_t next_retry(time_t now, void *arg) {
+    DataOrchestrator *orch = (DataOrchestrator*)arg;
+    const time_t retries[3] = {
+        orch->status.weather_retry_time,
+        orch->status.menu_retry_time,
+        orch->status.calendar_retry_time
+    };
+    
+    time_t next = SCHEDULER_NEVER;
+    for (int i = 0; i < 3; i++) {
+        if (retries[i] > now && (next == SCHEDULER_NEVER || retries[i] < next)) {
+            next = retries[i];
         }
-        
-        int current_minute = tm_now->tm_min;
-        int next_minute = ((current_minute / WEATHER_UPDATE_INTERVAL_MIN) + 1) * WEATHER_UPDATE_INTERVAL_MIN;
-        
-        struct tm tm_next = *tm_now;
-        if (next_minute >= MINUTES_PER_HOUR) {
-            tm_next.tm_hour += 1;
-            tm_next.tm_min = 0;
+    }
+    return next;
+}
+
+// End of the batching window (parked when no change is pending)
+static time_t next_batched_display(time_t now, void *arg) {
+    DataOrchestrator *orch = (DataOrchestrator*)arg;
+    int has_changes = orch->status.weather_changed || orch->status.menu_changed || orch->status.calendar_changed;
+    time_t due = orch->status.last_change_time + BATCH_DELAY_SECONDS;
+    return (has_changes && due > now) ? due : SCHEDULER_NEVER;
+}
+
+// ====================== SCHEDULED JOBS ======================
+
+// Minute tick: clock partial refresh and menu worker supervision
+static void clock_job(time_t due, void *arg) {
+    DataOrchestrator *orch = (DataOrchestrator*)arg;
+    struct tm tm_due_buf;
+    struct tm *tm_due = time_service_local(due, &tm_due_buf);
+    int hour = tm_due ? tm_due->tm_hour : 0;
+    int minute = tm_due ? tm_due->tm_min : 0;
+    
+    // Partial refresh for time updates, queued behind any full refresh in progress
+    if (orch->panel) {
+        if (display_service_submit_clock(due) == 0) {
+            LOG_DEBUG("⏰ Time display partial refresh queued: %02d:%02d", hour, minute);
         } else {
-            tm_next.tm_min = next_minute;
-        }
-        tm_next.tm_sec = 0;
-        tm_next.tm_isdst = -1;
-        
-        time_t next_update = mktime(&tm_next);
-        if (next_update == -1) {
-            break;
-        }
-        
-        int seconds_until_next = (int)(next_update - now);
-        
-        // Break the sleep into smaller chunks to check running flag
-        for (int i = 0; i < seconds_until_next && orch->running; i++) {
-            sleep(THREAD_SLEEP_SEC);
-        }
-        
-        if (orch->running) {
-            update_weather(orch);
+            LOG_ERROR("❌ Failed to queue time display partial refresh");
         }
+    } else {
+        LOG_DEBUG("⏰ Clock updated: %02d:%02d", hour, minute);
     }
     
-    return NULL;
+    // Keep the resident menu worker alive
+    menu_client_supervise(orch->menu_client);
+}
+
+static void weather_job(time_t due __attribute__((unused)), void *arg) {
+    update_weather((DataOrchestrator*)arg);
+}
+
+static void calendar_job(time_t due __attribute__((unused)), void *arg) {
+    update_calendar((DataOrchestrator*)arg, time(NULL));
 }
 
-// Menu update thread with improved scheduling
-void* menu_updater(void *arg) {
+// Midnight rollover: the new day is already in the menu cache and the calendar index,
+// no network on the display path
+static void menu_rollover_job(time_t due __attribute__((unused)), void *arg) {
     DataOrchestrator *orch = (DataOrchestrator*)arg;
+    time_t now = time(NULL);
+    update_menu(orch, now);
+    update_calendar_window(orch, now, 0);
+}
+
+// Off-peak network refresh of the menu cache; only a changed window is republished
+static void menu_prefetch_job(time_t due __attribute__((unused)), void *arg) {
+    DataOrchestrator *orch = (DataOrchestrator*)arg;
+    time_t now = time(NULL);
     
-    if (!orch) {
-        return NULL;
+    int result = orch->menu_client ? menu_client_prefetch(orch->menu_client, now) : -1;
+    if (result < 0) {
+        int delay = retry_backoff_next_delay(&orch->prefetch_backoff);
+        LOG_ERROR("❌ Menu prefetch failed, retrying in %d seconds", delay);
+        scheduler_wake_at(orch->scheduler, orch->menu_prefetch_job, now + delay);
+        return;
     }
     
-    while (orch->running) {
-        time_t now = time(NULL);
-        struct tm *tm_now = localtime(&now);
-        
-        if (!tm_now) {
-            break;
-        }
-        
-        struct tm tm_tomorrow = *tm_now;
-        tm_tomorrow.tm_mday += 1;
-        tm_tomorrow.tm_hour = MENU_UPDATE_HOUR;
-        tm_tomorrow.tm_min = MENU_UPDATE_MIN;
-        tm_tomorrow.tm_sec = MENU_UPDATE_SEC;
-        tm_tomorrow.tm_isdst = -1;
-        
-        time_t tomorrow = mktime(&tm_tomorrow);
-        if (tomorrow == -1) {
-            break;
-        }
-        
-        int seconds_until_tomorrow = (int)(tomorrow - now);
-        
-        // Break the sleep into smaller chunks to check running flag
-        for (int i = 0; i < seconds_until_tomorrow && orch->running; i++) {
-            sleep(THREAD_SLEEP_SEC);
-        }
-        
-        if (orch->running) {
-            time_t current_date = time(NULL);
-            update_menu(orch, current_date);
-        }
+    retry_backoff_reset(&orch->prefetch_backoff);
+    if (result > 0) {
+        update_menu(orch, now);
     }
-    
-    return NULL;
 }
 
-// Calendar update thread with improved scheduling
-void* calendar_updater(void *arg) {
+static void retry_job(time_t due __attribute__((unused)), void *arg) {
+    check_and_handle_retries((DataOrchestrator*)arg, time(NULL));
+}
+
+static void display_job(time_t due __attribute__((unused)), void *arg) {
+    check_and_perform_batched_update((DataOrchestrator*)arg, time(NULL));
+}
+
+// Refresh the Prometheus text file; SIGUSR1 also dumps a summary to the log
+static void metrics_job(time_t due __attribute__((unused)), void *arg) {
     DataOrchestrator *orch = (DataOrchestrator*)arg;
     
-    if (!orch) {
-        return NULL;
+    metrics_write_prometheus(METRICS_FILE_PATH);
+    if (orch->metrics_dump_requested) {
+        orch->metrics_dump_requested = 0;
+        LOG_INFO("📊 Metrics written to %s", METRICS_FILE_PATH);
+        metrics_log_summary();
     }
-    
-    while (orch->running) {
-        time_t now = time(NULL);
-        struct tm *tm_now = localtime(&now);
-        
-        if (!tm_now) {
-            break;
-        }
-        
-        struct tm tm_next = *tm_now;
-        tm_next.tm_hour += 1;
-        tm_next.tm_min = CALENDAR_UPDATE_MIN;
-        tm_next.tm_sec = CALENDAR_UPDATE_SEC;
-        tm_next.tm_isdst = -1;
-        
-        time_t next_update = mktime(&tm_next);
-        if (next_update == -1) {
-            break;
-        }
-        
-        int seconds_until_next = (int)(next_update - now);
-        
-        // Break the sleep into smaller chunks to check running flag
-        for (int i = 0; i < seconds_until_next && orch->running; i++) {
-            sleep(THREAD_SLEEP_SEC);
+}
+
+// ====================== INITIAL FETCH ======================
+
+typedef struct {
+    DataOrchestrator *orch;
+    time_t date;
+    void (*update)(DataOrchestrator *orch, time_t date);
+} InitialFetch;
+
+static void update_weather_for_date(DataOrchestrator *orch, time_t date __attribute__((unused))) {
+    update_weather(orch);
+}
+
+static void* initial_fetch_thread(void *arg) {
+    InitialFetch *fetch = (InitialFetch*)arg;
+    fetch->update(fetch->orch, fetch->date);
+    return NULL;
+}
+
+// Fetch the three sources concurrently (each has its own lock) and wait for all of them
+// The cold start then costs the slowest source instead of the sum of the three
+static void fetch_all_sources(DataOrchestrator *orch, time_t date) {
+    InitialFetch fetches[3] = {
+        { orch, date, update_weather_for_date },
+        { orch, date, update_menu },
+        { orch, date, update_calendar }
+    };
+    pthread_t threads[3];
+    int started[3];
+    
+    for (int i = 0; i < 3; i++) {
+        started[i] = pthread_create(&threads[i], NULL, initial_fetch_thread, &fetches[i]) == 0;
+        if (!started[i]) {
+            fetches[i].update(orch, date);  // No thread available: fetch inline
         }
-        
-        if (orch->running) {
-            time_t current_date = time(NULL);
-            update_calendar(orch, current_date);
+    }
+    for (int i = 0; i < 3; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
         }
     }
+}
+
+// ====================== SNAPSHOT FEED ======================
+
+// A consumer only knows what its producer has (fetch errors are logged on the producer)
+static void set_feed_status(DataOrchestrator *orch, unsigned int available) {
+    const struct { unsigned int source; int *available; char *error; size_t error_size; } sources[] = {
+        { FEED_WEATHER, &orch->status.weather_available, orch->status.weather_error, sizeof(orch->status.weather_error) },
+        { FEED_MENU, &orch->status.menu_available, orch->status.menu_error, sizeof(orch->status.menu_error) },
+        { FEED_CALENDAR, &orch->status.calendar_available, orch->status.calendar_error, sizeof(orch->status.calendar_error) }
+    };
+    for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+        *sources[i].available = (available & sources[i].source) != 0;
+        snprintf(sources[i].error, sources[i].error_size, "%s",
+                 *sources[i].available ? "" : "Not available from the producer");
+    }
+}
+
+// Feed message published (consumer mode): the producer already batched it, so refresh right away
+static void feed_update_handler(unsigned int changed, unsigned int available, void *arg) {
+    DataOrchestrator *orch = (DataOrchestrator*)arg;
     
-    return NULL;
+    pthread_mutex_lock(&orch->data_mutex);
+    set_feed_status(orch, available);
+    if (changed & FEED_WEATHER) orch->status.weather_changed = 1;
+    if (changed & FEED_MENU) orch->status.menu_changed = 1;
+    if (changed & FEED_CALENDAR) orch->status.calendar_changed = 1;
+    orch->status.last_change_time = time(NULL);
+    pthread_mutex_unlock(&orch->data_mutex);
+    
+    update_eink_display_batched(orch);
+}
+
+// Jobs of the fetch pipeline (producer only)
+static int register_fetch_jobs(DataOrchestrator *orch) {
+    orch->retry_job = scheduler_add(orch->scheduler, "retries", retry_job, next_retry, orch);
+    orch->menu_prefetch_job = scheduler_add(orch->scheduler, "menu-prefetch", menu_prefetch_job, next_menu_prefetch, orch);
+    orch->weather_job = scheduler_add(orch->scheduler, "weather", weather_job, next_weather_time, orch);
+    if (orch->retry_job < 0 || orch->menu_prefetch_job < 0 || orch->weather_job < 0 ||
+        scheduler_add(orch->scheduler, "menu-rollover", menu_rollover_job, next_menu_rollover, orch) < 0 ||
+        scheduler_add(orch->scheduler, "calendar", calendar_job, next_calendar_time, orch) < 0) {
+        return -1;
+    }
+    return 0;
 }
 
 // Start orchestrator with comprehensive error handling
@@ -715,39 +1014,57 @@ int orchestrator_start(DataOrchestrator *orch, time_t date) {
     
     orch->running = 1;
     
+    // Timer-driven jobs replace the per-task polling threads (about one wakeup per minute when idle)
+    orch->scheduler = scheduler_create(SCHEDULER_DEFAULT_WORKERS);
+    if (!orch->scheduler) {
+        fprintf(stderr, "Error: Failed to create scheduler\n");
+        return -1;
+    }
+    
+    orch->display_job = scheduler_add(orch->scheduler, "display", display_job, next_batched_display, orch);
+    orch->metrics_job = scheduler_add(orch->scheduler, "metrics", metrics_job, next_metrics_write, orch);
+    if (orch->display_job < 0 || orch->metrics_job < 0 ||
+        scheduler_add(orch->scheduler, "clock", clock_job, next_minute, orch) < 0 ||
+        (!orch->feed_source && register_fetch_jobs(orch) != 0)) {
+        fprintf(stderr, "Error: Failed to register scheduler jobs\n");
+        return -1;
+    }
+    
     LOG_DEBUG("🚀 Orchestrator started");
     LOG_DEBUG("⏰ Clock: updates every minute");
-    LOG_DEBUG("🌤️  Weather: updates every %d minutes at XX:X0:00", WEATHER_UPDATE_INTERVAL_MIN);
-    LOG_DEBUG("📋 Menu: updates daily at %02d:%02d:%02d", MENU_UPDATE_HOUR, MENU_UPDATE_MIN, MENU_UPDATE_SEC);
-    LOG_DEBUG("📅 Calendar: updates hourly at XX:%02d:%02d", CALENDAR_UPDATE_MIN, CALENDAR_UPDATE_SEC);
+    if (orch->feed_source) {
+        LOG_DEBUG("📡 Data: pushed by the producer at %s", orch->feed_source);
+    } else {
+        LOG_DEBUG("🌤️  Weather: adaptive polling every %d-%d minutes, at XX:%02d after each hour, cache headers honored",
+                  POLL_DEFAULT_BASE_INTERVAL / 60, POLL_DEFAULT_MAX_INTERVAL / 60, POLL_BOUNDARY_LEAD / 60);
+        LOG_DEBUG("📋 Menu: rollover from cache at %02d:%02d:%02d, %d-day prefetch at %02d:%02d",
+                  MENU_UPDATE_HOUR, MENU_UPDATE_MIN, MENU_UPDATE_SEC, MENU_CACHE_DAYS, MENU_PREFETCH_HOUR, MENU_PREFETCH_MIN);
+        LOG_DEBUG("📅 Calendar: updates hourly at XX:%02d:%02d", CALENDAR_UPDATE_MIN, CALENDAR_UPDATE_SEC);
+    }
+    LOG_DEBUG("📊 Metrics: %s every %d seconds (SIGUSR1 dumps now)", METRICS_FILE_PATH, METRICS_WRITE_INTERVAL_SEC);
     LOG_DEBUG("=====================================");
     
-    // Initial data update
-    update_weather(orch);
-    update_menu(orch, date);
-    update_calendar(orch, date);
+    // Producer: other dashboards can subscribe to the snapshots published here
+    if (orch->feed_listen) {
+        orch->feed_serving = snapshot_feed_serve(orch->feed_listen) == 0;
+    }
+    
+    // Consumer: the producer owns the fetch pipeline and its messages drive the refreshes
+    if (orch->feed_source) {
+        if (snapshot_feed_subscribe(orch->feed_source, feed_update_handler, orch) != 0) {
+            fprintf(stderr, "Error: Failed to subscribe to %s\n", orch->feed_source);
+            return -1;
+        }
+        return 0;
+    }
+    
+    // Initial data update, all sources at once
+    fetch_all_sources(orch, date);
     
     // Perform batched display update after all initial updates
+    // (a restored frame is diffed against, so only what changed while down is repainted)
     update_eink_display_batched(orch);
     
-    // Start threads with error checking
-    if (pthread_create(&orch->clock_thread, NULL, clock_updater, orch) != 0) {
-        fprintf(stderr, "Error: Failed to create clock thread\n");
-        return -1;
-    }
-    if (pthread_create(&orch->weather_thread, NULL, weather_updater, orch) != 0) {
-        fprintf(stderr, "Error: Failed to create weather thread\n");
-        return -1;
-    }
-    if (pthread_create(&orch->menu_thread, NULL, menu_updater, orch) != 0) {
-        fprintf(stderr, "Error: Failed to create menu thread\n");
-        return -1;
-    }
-    if (pthread_create(&orch->calendar_thread, NULL, calendar_updater, orch) != 0) {
-        fprintf(stderr, "Error: Failed to create calendar thread\n");
-        return -1;
-    }
-    
     return 0;
 }
 
@@ -771,26 +1088,30 @@ int orchestrator_run_once(DataOrchestrator *orch, time_t date) {
     // Show header first
     print_dashboard_header(date);
     
-    // Fetch and display weather (continue regardless of result)
-    update_weather(orch);
-    if (orch->status.weather_available) {
-        print_dashboard_weather(&orch->weather_data);
+    // Fetch all sources (continue regardless of result), then print from one snapshot
+    if (orch->feed_source) {
+        unsigned int available = 0;
+        snapshot_feed_fetch(orch->feed_source, FEED_FETCH_TIMEOUT_SEC, &available);
+        set_feed_status(orch, available);
+    } else {
+        fetch_all_sources(orch, date);
+    }
+    const DashboardSnapshot *snapshot = snapshot_acquire();
+    
+    if (snapshot->weather) {
+        print_dashboard_weather(snapshot->weather);
     } else {
         print_component_error("WEATHER", orch->status.weather_error);
     }
     
-    // Fetch and display menu (continue regardless of result)
-    update_menu(orch, date);
-    if (orch->status.menu_available) {
-        print_dashboard_menu(&orch->menu_data);
+    if (snapshot->menu) {
+        print_dashboard_menu(snapshot->menu);
     } else {
         print_component_error("MENU", orch->status.menu_error);
     }
     
-    // Fetch and display calendar (continue regardless of result)
-    update_calendar(orch, date);
-    if (orch->status.calendar_available) {
-        print_dashboard_calendar(&orch->calendar_data);
+    if (snapshot->calendar) {
+        print_dashboard_calendar(snapshot->calendar);
     } else {
         print_component_error("CALENDAR", orch->status.calendar_error);
     }
@@ -802,20 +1123,18 @@ int orchestrator_run_once(DataOrchestrator *orch, time_t date) {
     LOG_INFO("🍽️  Menu: %s", orch->status.menu_available ? "✅ OK" : "❌ FAILED");
     LOG_INFO("📅 Calendar: %s", orch->status.calendar_available ? "✅ OK" : "❌ FAILED");
     
-    const WeatherData *weather_ptr = orch->status.weather_available ? &orch->weather_data : NULL;
-    const MenuData *menu_ptr = orch->status.menu_available ? &orch->menu_data : NULL;
-    const CalendarData *calendar_ptr = orch->status.calendar_available ? &orch->calendar_data : NULL;
-    
     // Debug mode: generate BMP dashboard file for testing
     LOG_INFO("🖼️  Generating dashboard BMP...");
     
     const char *bmp_filename = "dashboard_debug.bmp";
-    if (generate_dashboard_bmp(bmp_filename, date, weather_ptr, menu_ptr, calendar_ptr)) {
+    if (generate_dashboard_bmp(bmp_filename, date, snapshot->weather, snapshot->menu, snapshot->calendar)) {
         LOG_INFO("✅ BMP generated: %s", bmp_filename);
     } else {
         LOG_ERROR("❌ Failed to generate BMP");
     }
     
+    snapshot_release(snapshot);
+    
     return 0;
 }
 
@@ -853,9 +1172,9 @@ time_t parse_date_string(const char* date_str) {
     tm.tm_hour = DEFAULT_NOON_HOUR; // Set to noon to avoid DST issues
     tm.tm_min = 0;
     tm.tm_sec = 0;
-    tm.tm_isdst = -1; // Let mktime determine DST
+    tm.tm_isdst = -1; // Let the time service determine DST
     
-    time_t result = mktime(&tm);
+    time_t result = time_service_mktime(&tm);
     if (result == -1) {
         fprintf(stderr, "Error: Invalid date\n");
         return 0;
@@ -918,6 +1237,7 @@ static void load_env_file(void) {
 
 int main(int argc, char *argv[]) {
     int debug = 0;
+    int headless = 0;
     char *date_str = NULL;
     
     // Load environment variables from .env file first
@@ -927,6 +1247,8 @@ int main(int argc, char *argv[]) {
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--debug") == 0) {
             debug = 1;
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            headless = 1;
         } else if (strcmp(argv[i], "--date") == 0) {
             if (i + 1 < argc) {
                 date_str = argv[i + 1];
@@ -940,6 +1262,7 @@ int main(int argc, char *argv[]) {
             printf("Options:\n");
             printf("  --debug          Run once in debug mode and exit\n");
             printf("  --date DD/MM/YYYY Override today's date for menu and calendar\n");
+            printf("  --headless       Fetch and serve snapshots (DASHBOARD_FEED_LISTEN) without a panel\n");
             printf("  --help           Show this help message\n");
             return 0;
         } else {
@@ -957,16 +1280,25 @@ int main(int argc, char *argv[]) {
             return 1; // Error already printed by parse_date_string
         }
         
-        struct tm *tm_test = localtime(&date);
+        struct tm tm_test_buf;
+        
+        struct tm *tm_test = time_service_local(date, &tm_test_buf);
         LOG_DEBUG("📅 Using test date: %02d/%02d/%d", 
                tm_test->tm_mday, tm_test->tm_mon + 1, tm_test->tm_year + 1900);
     } else {
         date = time(NULL);
     }
     
-    DataOrchestrator *orch = orchestrator_init(debug);
+    // Process-lifetime HTTP client (connection reuse across weather/calendar polls)
+    if (http_init() != 0) {
+        fprintf(stderr, "❌ Failed to initialize HTTP client\n");
+        return 1;
+    }
+    
+    DataOrchestrator *orch = orchestrator_init(debug, headless);
     if (!orch) {
         fprintf(stderr, "❌ Failed to initialize orchestrator\n");
+        http_cleanup();
         return 1;
     }
     
@@ -974,6 +1306,7 @@ int main(int argc, char *argv[]) {
     
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
+    signal(SIGUSR1, metrics_signal_handler);
     
     if (debug) {
         // Debug mode - run once and exit
@@ -983,6 +1316,7 @@ int main(int argc, char *argv[]) {
             return 1;
         }
         
+        metrics_log_summary();
         LOG_DEBUG("✅ Single execution completed");
     } else {
         // Production mode - start threads and run continuously
@@ -992,19 +1326,15 @@ int main(int argc, char *argv[]) {
             return 1;
         }
         
-        while (orch->running) {
-            usleep(MAIN_LOOP_SLEEP_MS); // 100ms for responsive signal handling
-            
-            // Check for pending batched display updates
-            check_and_perform_batched_update(orch, date);
-            
-            // Check for and handle pending retries
-            check_and_handle_retries(orch, date);
+        // Dispatch scheduled jobs until a signal stops the scheduler
+        if (scheduler_run(orch->scheduler) != 0) {
+            LOG_ERROR("❌ Scheduler stopped unexpectedly");
         }
         
         LOG_DEBUG("🛑 Orchestrator stopped");
     }
     
     orchestrator_free(orch);
+    http_cleanup();
     return 0;
 }
\ No newline at end of file
@@ -2,15 +2,34 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
+#include <stdint.h>
 #include <time.h>
 #include <curl/curl.h>
 #include <cjson/cJSON.h>
 #include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
 #include <unistd.h>
 #include <signal.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
 #include "common.h"
 #include "menu.h"
 #include "logging.h"
+#include "time_service.h"
+#include "metrics.h"
+#ifdef MENU_BACKEND_NATIVE
+#include "google_auth.h"
+#include "http.h"
+#endif
+
+// One prefetched day
+typedef struct {
+    int date_key;               // YYYYMMDD
+    DayMenuData menu;
+} MenuCacheEntry;
 
 // Menu client structure (implementation)
 struct MenuClient {
@@ -18,144 +37,859 @@ struct MenuClient {
     char spreadsheet_id[256];
     char access_token[1024];
     int debug;
+    pthread_mutex_t lock;       // Serializes requests, cache access and the worker supervisor
+    
+    // Rolling window of prefetched days (see MENU CACHE below)
+    MenuCacheEntry cache[MENU_CACHE_DAYS];
+    int cache_count;
+    time_t cache_fetched_at;
+    
+#ifdef MENU_BACKEND_NATIVE
+    // Native Sheets client (see NATIVE SHEETS BACKEND below)
+    GoogleServiceAccount account;
+    int account_loaded;
+    time_t token_expires_at;    // access_token is valid until then
+    uint16_t month_tabs;        // Bit m set when the tab for month m + 1 exists
+    time_t tabs_checked_at;
+#else
+    // Resident worker process (see MENU WORKER below)
+    pid_t worker_pid;           // 0 = not running
+    int worker_fd;              // Our end of the socket pair (-1 = none)
+    time_t worker_started;
+    time_t next_restart;        // Earliest automatic restart after a crash
+    int restart_delay;          // Current restart backoff in seconds
+    unsigned request_id;
+#endif
 };
 
+#ifdef MENU_BACKEND_NATIVE
+
+// Sheets API
+#define SHEETS_API_URL "https://sheets.googleapis.com/v4/spreadsheets/"
+#define SHEETS_SCOPE "https://www.googleapis.com/auth/spreadsheets.readonly"
+#define SHEETS_TOKEN_MARGIN_SECONDS 60          // Renew the token this long before it expires
+#define SHEETS_TABS_REFRESH_SECONDS (6 * 3600)  // Re-list tabs at most this often
+#define SHEETS_MAX_URL_LENGTH 2048
+
+// Cells read per month tab (A1:H100): label column plus seven day columns, a month of weeks
+#define MENU_SHEET_RANGE_START "A1"
+#define MENU_SHEET_RANGE_END "H100"
+
+// A month's tab is also checked for dates this close to the month boundary (as menu.py)
+#define MENU_ADJACENT_MONTH_DAYS 7
+
+#else
+
 // Constants for menu fetching
 #define MENU_SCRIPT_PATH PROJECT_ROOT "/scripts/menu_fetcher.py"
-#define MENU_INITIAL_BUFFER_SIZE 1024
 #define MENU_TIMEOUT_SECONDS 30
 
-// Call dedicated Python script to get menu data
-static char* call_python_menu(MenuClient *client, const char* test_date_str) {
-    char command[1024];
+// Worker protocol: 4-byte big-endian length followed by a UTF-8 JSON object
+#define MENU_MAX_FRAME_SIZE (64 * 1024)
+
+// Worker supervision
+#define MENU_WORKER_STOP_WAIT_MS 2000
+#define MENU_RESTART_MIN_SECONDS 1
+#define MENU_RESTART_MAX_SECONDS 300
+#define MENU_WORKER_STABLE_SECONDS 60
+
+#endif // MENU_BACKEND_NATIVE
+
+#ifdef MENU_BACKEND_NATIVE
+
+// ====================== NATIVE SHEETS BACKEND ======================
+
+// Tab names as used in the spreadsheet (no accents)
+static const char *month_tab_names[12] = {
+    "Janvier", "Fevrier", "Mars", "Avril", "Mai", "Juin",
+    "Juillet", "Aout", "Septembre", "Octobre", "Novembre", "Decembre"
+};
+
+// Load the key once and keep the bearer token until shortly before it expires
+static int ensure_access_token(MenuClient *client) {
+    time_t now = time(NULL);
+    if (client->access_token[0] && now < client->token_expires_at - SHEETS_TOKEN_MARGIN_SECONDS) {
+        return 0;
+    }
     
-    // Build command using dedicated script
-    if (test_date_str) {
-        snprintf(command, sizeof(command), 
-                "%s --spreadsheet-id \"%s\" --credentials \"" PROJECT_ROOT "/config/credentials.json\" --date \"%s\"",
-                MENU_SCRIPT_PATH, client->spreadsheet_id, test_date_str);
-    } else {
-        snprintf(command, sizeof(command), 
-                "%s --spreadsheet-id \"%s\" --credentials \"" PROJECT_ROOT "/config/credentials.json\"",
-                MENU_SCRIPT_PATH, client->spreadsheet_id);
+    if (!client->account_loaded) {
+        if (google_service_account_load(client->credentials_file, &client->account) != 0) {
+            return -1;
+        }
+        client->account_loaded = 1;
     }
     
-    // Add debug flag if enabled
-    LOG_DEBUG("🐍 Calling Python menu script...");
-    LOG_DEBUG("📋 Command: %s", command);
+    client->access_token[0] = '\0';
+    return google_fetch_access_token(&client->account, SHEETS_SCOPE, client->access_token,
+                                     sizeof(client->access_token), &client->token_expires_at);
+}
+
+/**
+ * Authorized GET on the Sheets API, parsed as JSON
+ * A 401 (token revoked or clock skew) drops the cached token and retries once.
+ * Returns: JSON document (caller deletes), or NULL on failure
+ */
+static cJSON* sheets_get_json(MenuClient *client, const char *url) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (ensure_access_token(client) != 0) {
+            return NULL;
+        }
+        
+        char authorization[GOOGLE_MAX_TOKEN_LENGTH + 32];
+        snprintf(authorization, sizeof(authorization), "Authorization: Bearer %s", client->access_token);
+        const char *headers[] = { authorization, NULL };
+        
+        HttpResponse response;
+        int fetch = http_get_with_headers(url, headers, &response);
+        if (fetch == HTTP_RESULT_OK) {
+            cJSON *json = cJSON_Parse(response.body);
+            http_response_free(&response);
+            if (!json) {
+                LOG_ERROR("❌ Invalid JSON from Sheets API");
+            }
+            return json;
+        }
+        
+        long status = response.status;
+        http_response_free(&response);
+        if (status != 401) {
+            return NULL;
+        }
+        LOG_DEBUG("🔑 Sheets API rejected the cached token, renewing it");
+        client->access_token[0] = '\0';
+    }
+    return NULL;
+}
+
+// List the spreadsheet's tabs (cached: normally one request per process)
+static int refresh_month_tabs(MenuClient *client) {
+    time_t now = time(NULL);
+    if (client->tabs_checked_at && now - client->tabs_checked_at < SHEETS_TABS_REFRESH_SECONDS) {
+        return 0;
+    }
     
-    // Set timeout alarm
-    alarm(MENU_TIMEOUT_SECONDS);
+    char url[SHEETS_MAX_URL_LENGTH];
+    snprintf(url, sizeof(url), SHEETS_API_URL "%s?fields=sheets.properties.title", client->spreadsheet_id);
+    cJSON *json = sheets_get_json(client, url);
+    if (!json) {
+        return -1;
+    }
     
-    // Execute the command and capture output
-    FILE *pipe = popen(command, "r");
-    if (!pipe) {
-        alarm(0);  // Cancel alarm
-        LOG_ERROR("❌ Failed to execute Python script");
-        return NULL;
+    uint16_t tabs = 0;
+    cJSON *sheet;
+    cJSON_ArrayForEach(sheet, cJSON_GetObjectItem(json, "sheets")) {
+        cJSON *title = cJSON_GetObjectItem(cJSON_GetObjectItem(sheet, "properties"), "title");
+        if (!cJSON_IsString(title)) continue;
+        for (int m = 0; m < 12; m++) {
+            if (strcmp(title->valuestring, month_tab_names[m]) == 0) {
+                tabs |= (uint16_t)(1u << m);
+            }
+        }
     }
+    cJSON_Delete(json);
     
-    // Dynamic buffer allocation starting with smaller size
-    size_t capacity = MENU_INITIAL_BUFFER_SIZE;
-    char *result = malloc(capacity);
-    if (!result) {
-        alarm(0);
-        pclose(pipe);
-        return NULL;
+    client->month_tabs = tabs;
+    client->tabs_checked_at = now;
+    LOG_DEBUG("📋 Menu spreadsheet has %d month tabs", __builtin_popcount(tabs));
+    return 0;
+}
+
+// Tabs that may hold a date, in menu.py's search order (previous, current, next month)
+static int candidate_months(const struct tm *day, int months[3]) {
+    static const int lengths[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    int month = day->tm_mon;
+    int year = day->tm_year + 1900;
+    int days_in_month = lengths[month];
+    if (month == 1 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)) days_in_month = 29;
+    
+    int count = 0;
+    if (day->tm_mday <= MENU_ADJACENT_MONTH_DAYS) months[count++] = (month + 11) % 12;
+    months[count++] = month;
+    if (day->tm_mday >= days_in_month - MENU_ADJACENT_MONTH_DAYS) months[count++] = (month + 1) % 12;
+    return count;
+}
+
+// Cell text trimmed of surrounding whitespace, as Python's str.strip()
+static void trimmed_cell(const cJSON *cell, char *out, size_t out_size) {
+    out[0] = '\0';
+    if (!cJSON_IsString(cell)) return;
+    
+    const char *start = cell->valuestring;
+    while (*start == ' ' || *start == '\t' || *start == '\n' || *start == '\r') start++;
+    size_t length = strlen(start);
+    while (length > 0 && (start[length - 1] == ' ' || start[length - 1] == '\t' ||
+                          start[length - 1] == '\n' || start[length - 1] == '\r')) {
+        length--;
     }
+    if (length >= out_size) length = out_size - 1;
+    memcpy(out, start, length);
+    out[length] = '\0';
+}
+
+// "lundi 30/06" matches "30/06": the cell has a space and its last word is the date
+static int cell_has_date(const cJSON *cell, const char *day_month) {
+    char text[128];
+    trimmed_cell(cell, text, sizeof(text));
+    const char *space = strrchr(text, ' ');
+    return space && strcmp(space + 1, day_month) == 0;
+}
+
+/**
+ * Find a date header in a tab grid and read the Midi / Soir rows below it
+ * Layout (as parsed by menu.py): a row with an empty first cell holds "jour DD/MM"
+ * headers; the next rows are labelled "Midi" and "Soir" in column A.
+ * Returns: 1 if the date was found, 0 otherwise
+ */
+static int extract_day_menu(const cJSON *rows, const char *day_month, DayMenuData *menu) {
+    int row_count = cJSON_GetArraySize(rows);
     
-    // Read output with dynamic buffer growth
-    size_t total_read = 0;
-    size_t bytes_read;
-    while ((bytes_read = fread(result + total_read, 1, capacity - total_read - 1, pipe)) > 0) {
-        total_read += bytes_read;
+    for (int i = 0; i < row_count; i++) {
+        const cJSON *row = cJSON_GetArrayItem(rows, i);
+        char label[64];
+        trimmed_cell(cJSON_GetArrayItem(row, 0), label, sizeof(label));
+        if (cJSON_GetArraySize(row) <= 1 || label[0]) {
+            continue;
+        }
         
-        // If buffer is getting full, expand it
-        if (total_read >= capacity - 256) {
-            capacity *= 2;
-            char *new_result = realloc(result, capacity);
-            if (!new_result) {
-                free(result);
-                alarm(0);
-                pclose(pipe);
-                return NULL;
+        int column_count = cJSON_GetArraySize(row);
+        for (int col = 1; col < column_count; col++) {
+            if (!cell_has_date(cJSON_GetArrayItem(row, col), day_month)) {
+                continue;
+            }
+            
+            menu->midi[0] = '\0';
+            menu->soir[0] = '\0';
+            static const char *meal_labels[2] = { "midi", "soir" };
+            char *meal_values[2] = { menu->midi, menu->soir };
+            for (int meal = 0; meal < 2; meal++) {
+                const cJSON *meal_row = cJSON_GetArrayItem(rows, i + 1 + meal);
+                if (!meal_row || cJSON_GetArraySize(meal_row) <= col) continue;
+                trimmed_cell(cJSON_GetArrayItem(meal_row, 0), label, sizeof(label));
+                if (strcasecmp(label, meal_labels[meal]) == 0) {
+                    trimmed_cell(cJSON_GetArrayItem(meal_row, col), meal_values[meal], sizeof(menu->midi));
+                }
             }
-            result = new_result;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Does any cell of the grid carry this date (menu.py's tab selection rule)?
+static int grid_has_date(const cJSON *rows, const char *day_month) {
+    const cJSON *row;
+    cJSON_ArrayForEach(row, rows) {
+        const cJSON *cell;
+        cJSON_ArrayForEach(cell, row) {
+            if (cell_has_date(cell, day_month)) return 1;
         }
     }
-    result[total_read] = '\0';
+    return 0;
+}
+
+/**
+ * Fetch the menus of count consecutive days from start with one values:batchGet request
+ * Only the candidate month tabs that exist are requested, each limited to A1:H100.
+ * Days absent from the sheet get their date label and empty meals.
+ * Returns: number of days filled (count), or -1 on failure
+ */
+static int fetch_menu_window(MenuClient *client, time_t start, DayMenuData *out, int count) {
+    if (refresh_month_tabs(client) != 0) {
+        return -1;
+    }
     
-    int exit_code = pclose(pipe);
-    alarm(0);  // Cancel alarm
+    struct tm days[MENU_CACHE_DAYS];
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(start, &tm_info_buf);
+    if (!tm_info || count > MENU_CACHE_DAYS) return -1;
+    for (int d = 0; d < count; d++) {
+        days[d] = *tm_info;
+        days[d].tm_mday += d;
+        days[d].tm_isdst = -1;
+        time_t day_time = time_service_mktime(&days[d]);   // Normalize month and year rollover
+        if (day_time == -1 || !time_service_local(day_time, &days[d])) return -1;
+    }
     
-    if (exit_code != 0) {
-        LOG_ERROR("❌ Python script failed with exit code: %d", exit_code);
-        LOG_ERROR("   Output: %s", result);
-        free(result);
-        return NULL;
+    // Union of candidate tabs, in request order
+    int requested[12];
+    int requested_count = 0;
+    for (int d = 0; d < count; d++) {
+        int months[3];
+        int month_count = candidate_months(&days[d], months);
+        for (int i = 0; i < month_count; i++) {
+            int seen = 0;
+            for (int j = 0; j < requested_count; j++) seen |= (requested[j] == months[i]);
+            if (!seen && (client->month_tabs & (1u << months[i]))) requested[requested_count++] = months[i];
+        }
     }
     
-    LOG_DEBUG("✅ Python menu data retrieved successfully (%zu bytes)", total_read);
+    for (int d = 0; d < count; d++) {
+        strftime(out[d].date, sizeof(out[d].date), "%A %d/%m/%Y", &days[d]);
+        out[d].midi[0] = '\0';
+        out[d].soir[0] = '\0';
+    }
     
-    return result;
+    if (requested_count == 0) {
+        LOG_ERROR("❌ No menu tab for %s", month_tab_names[days[0].tm_mon]);
+        return count;
+    }
+    
+    char url[SHEETS_MAX_URL_LENGTH];
+    int length = snprintf(url, sizeof(url), SHEETS_API_URL "%s/values:batchGet?majorDimension=ROWS",
+                          client->spreadsheet_id);
+    for (int i = 0; i < requested_count && length < (int)sizeof(url); i++) {
+        // "Octobre!A1:H100" with "!" and ":" percent-encoded (tab names are plain ASCII)
+        length += snprintf(url + length, sizeof(url) - length,
+                           "&ranges=%s%%21" MENU_SHEET_RANGE_START "%%3A" MENU_SHEET_RANGE_END,
+                           month_tab_names[requested[i]]);
+    }
+    
+    cJSON *json = sheets_get_json(client, url);
+    if (!json) {
+        return -1;
+    }
+    
+    // valueRanges come back in request order
+    const cJSON *grids[12] = { NULL };
+    for (int i = 0; i < requested_count; i++) {
+        grids[i] = cJSON_GetObjectItem(cJSON_GetArrayItem(cJSON_GetObjectItem(json, "valueRanges"), i), "values");
+    }
+    
+    for (int d = 0; d < count; d++) {
+        char day_month[8];
+        snprintf(day_month, sizeof(day_month), "%02d/%02d", days[d].tm_mday, days[d].tm_mon + 1);
+        
+        int months[3];
+        int month_count = candidate_months(&days[d], months);
+        for (int i = 0; i < month_count; i++) {
+            const cJSON *grid = NULL;
+            for (int j = 0; j < requested_count; j++) {
+                if (requested[j] == months[i]) grid = grids[j];
+            }
+            if (grid && grid_has_date(grid, day_month)) {
+                extract_day_menu(grid, day_month, &out[d]);
+                break;
+            }
+        }
+    }
+    
+    cJSON_Delete(json);
+    LOG_DEBUG("✅ Native menu data retrieved (%d days, %d tabs in one request)", count, requested_count);
+    return count;
 }
 
-// Parse Python JSON response to extract menu data
-static int parse_python_response(const char* json_response, MenuData *result) {
-    cJSON *json = cJSON_Parse(json_response);
-    if (!json) {
+#else
+
+// ====================== MENU WORKER ======================
+
+static long elapsed_ms(const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1000 + (now.tv_nsec - start->tv_nsec) / 1000000;
+}
+
+/**
+ * Start scripts/menu_fetcher.py --serve on one end of a socket pair
+ * The worker keeps its Python imports and authenticated Sheets session across requests.
+ * Returns: 0 on success, -1 on failure
+ */
+static int start_menu_worker(MenuClient *client) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+        LOG_ERROR("❌ Failed to create menu worker socket: %s", strerror(errno));
+        return -1;
+    }
+    
+    // Build argv before fork: only async-signal-safe calls are allowed in the child
+    char *argv[] = {
+        MENU_SCRIPT_PATH, "--serve",
+        "--spreadsheet-id", client->spreadsheet_id,
+        "--credentials", client->credentials_file,
+        NULL
+    };
+    
+    pid_t pid = fork();
+    if (pid < 0) {
+        LOG_ERROR("❌ Failed to fork menu worker: %s", strerror(errno));
+        close(fds[0]);
+        close(fds[1]);
         return -1;
     }
     
-    // Parse today's menu
-    cJSON *today = cJSON_GetObjectItem(json, "today");
-    if (today) {
-        cJSON *date = cJSON_GetObjectItem(today, "date");
-        cJSON *midi = cJSON_GetObjectItem(today, "midi");
-        cJSON *soir = cJSON_GetObjectItem(today, "soir");
+    if (pid == 0) {
+        // Child: the socket becomes stdin/stdout, stderr stays on our log output
+        if (dup2(fds[1], STDIN_FILENO) < 0 || dup2(fds[1], STDOUT_FILENO) < 0) {
+            _exit(127);
+        }
+        execv(MENU_SCRIPT_PATH, argv);
+        _exit(127);
+    }
+    
+    close(fds[1]);
+    client->worker_pid = pid;
+    client->worker_fd = fds[0];
+    client->worker_started = time(NULL);
+    LOG_DEBUG("🐍 Menu worker started (pid %d)", (int)pid);
+    return 0;
+}
+
+// Close the socket, give the worker a moment to exit on EOF, then kill it
+static void stop_menu_worker(MenuClient *client) {
+    if (client->worker_fd >= 0) {
+        close(client->worker_fd);
+        client->worker_fd = -1;
+    }
+    if (client->worker_pid <= 0) {
+        return;
+    }
+    
+    for (int waited = 0; waited < MENU_WORKER_STOP_WAIT_MS; waited += 100) {
+        if (waitpid(client->worker_pid, NULL, WNOHANG) == client->worker_pid) {
+            client->worker_pid = 0;
+            return;
+        }
+        usleep(100 * 1000);
+    }
+    
+    kill(client->worker_pid, SIGKILL);
+    waitpid(client->worker_pid, NULL, 0);
+    client->worker_pid = 0;
+}
+
+// Reap the worker if it exited on its own
+// Returns: 1 if a worker is running, 0 otherwise
+static int menu_worker_alive(MenuClient *client) {
+    if (client->worker_pid <= 0) {
+        return 0;
+    }
+    
+    int status;
+    if (waitpid(client->worker_pid, &status, WNOHANG) == client->worker_pid) {
+        if (WIFEXITED(status)) {
+            LOG_ERROR("❌ Menu worker exited with code %d", WEXITSTATUS(status));
+        } else if (WIFSIGNALED(status)) {
+            LOG_ERROR("❌ Menu worker killed by signal %d", WTERMSIG(status));
+        }
+        client->worker_pid = 0;
+        if (client->worker_fd >= 0) {
+            close(client->worker_fd);
+            client->worker_fd = -1;
+        }
+        return 0;
+    }
+    return 1;
+}
+
+// Crash bookkeeping: back off exponentially while the worker keeps dying young
+static void note_worker_failure(MenuClient *client) {
+    time_t now = time(NULL);
+    if (now - client->worker_started >= MENU_WORKER_STABLE_SECONDS) {
+        client->restart_delay = MENU_RESTART_MIN_SECONDS;
+    } else if (client->restart_delay < MENU_RESTART_MAX_SECONDS) {
+        client->restart_delay *= 2;
+        if (client->restart_delay > MENU_RESTART_MAX_SECONDS) client->restart_delay = MENU_RESTART_MAX_SECONDS;
+    }
+    client->next_restart = now + client->restart_delay;
+}
+
+// Write all bytes (MSG_NOSIGNAL: a dead worker must not SIGPIPE the dashboard)
+static int send_all(int fd, const void *data, size_t length) {
+    const char *p = (const char *)data;
+    while (length > 0) {
+        ssize_t sent = send(fd, p, length, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += sent;
+        length -= (size_t)sent;
+    }
+    return 0;
+}
+
+// Read exactly length bytes before deadline_ms (relative to start)
+static int recv_all(int fd, void *data, size_t length, const struct timespec *start, long deadline_ms) {
+    char *p = (char *)data;
+    while (length > 0) {
+        long remaining = deadline_ms - elapsed_ms(start);
+        if (remaining <= 0) {
+            errno = ETIMEDOUT;
+            return -1;
+        }
         
-        if (date && cJSON_IsString(date)) {
-            strncpy(result->today.date, date->valuestring, sizeof(result->today.date) - 1);
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        int ready = poll(&pfd, 1, (int)remaining);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (ready == 0) {
+            errno = ETIMEDOUT;
+            return -1;
         }
-        if (midi && cJSON_IsString(midi)) {
-            strncpy(result->today.midi, midi->valuestring, sizeof(result->today.midi) - 1);
+        
+        ssize_t received = recv(fd, p, length, 0);
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            return -1;
         }
-        if (soir && cJSON_IsString(soir)) {
-            strncpy(result->today.soir, soir->valuestring, sizeof(result->today.soir) - 1);
+        if (received == 0) {
+            errno = EPIPE; // Worker closed the connection
+            return -1;
         }
+        p += received;
+        length -= (size_t)received;
+    }
+    return 0;
+}
+
+static int send_frame(int fd, const char *payload) {
+    size_t length = strlen(payload);
+    unsigned char header[4] = {
+        (unsigned char)(length >> 24), (unsigned char)(length >> 16),
+        (unsigned char)(length >> 8), (unsigned char)length
+    };
+    if (send_all(fd, header, sizeof(header)) != 0) return -1;
+    return send_all(fd, payload, length);
+}
+
+/**
+ * Receive one frame (caller frees the returned NUL-terminated payload)
+ * Returns: payload, or NULL on timeout, EOF or protocol error
+ */
+static char* recv_frame(int fd, const struct timespec *start, long deadline_ms) {
+    unsigned char header[4];
+    if (recv_all(fd, header, sizeof(header), start, deadline_ms) != 0) {
+        return NULL;
     }
     
-    // Parse tomorrow's menu
-    cJSON *tomorrow = cJSON_GetObjectItem(json, "tomorrow");
-    if (tomorrow) {
-        cJSON *date = cJSON_GetObjectItem(tomorrow, "date");
-        cJSON *midi = cJSON_GetObjectItem(tomorrow, "midi");
-        cJSON *soir = cJSON_GetObjectItem(tomorrow, "soir");
+    size_t length = ((size_t)header[0] << 24) | ((size_t)header[1] << 16) |
+                    ((size_t)header[2] << 8) | (size_t)header[3];
+    if (length > MENU_MAX_FRAME_SIZE) {
+        LOG_ERROR("❌ Menu worker frame too large (%zu bytes)", length);
+        errno = EPROTO;
+        return NULL;
+    }
+    
+    char *payload = malloc(length + 1);
+    if (!payload) {
+        return NULL;
+    }
+    if (recv_all(fd, payload, length, start, deadline_ms) != 0) {
+        free(payload);
+        return NULL;
+    }
+    payload[length] = '\0';
+    return payload;
+}
+
+/**
+ * Send one request to the worker and wait for its answer (client->lock held)
+ * Starts the worker if needed; any transport failure or timeout kills it so the
+ * next request (or the supervisor) starts a fresh one.
+ * Returns: parsed response object (caller deletes), or NULL on failure
+ */
+static cJSON* menu_worker_request(MenuClient *client, const char *command, const char *date_str, int days) {
+    if (!menu_worker_alive(client) && start_menu_worker(client) != 0) {
+        return NULL;
+    }
+    
+    unsigned id = ++client->request_id;
+    char request[256];
+    if (date_str) {
+        snprintf(request, sizeof(request), "{\"id\":%u,\"cmd\":\"%s\",\"date\":\"%s\",\"days\":%d}",
+                 id, command, date_str, days);
+    } else {
+        snprintf(request, sizeof(request), "{\"id\":%u,\"cmd\":\"%s\"}", id, command);
+    }
+    
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    
+    if (send_frame(client->worker_fd, request) != 0) {
+        LOG_ERROR("❌ Failed to send request to menu worker: %s", strerror(errno));
+        note_worker_failure(client);
+        stop_menu_worker(client);
+        return NULL;
+    }
+    
+    // Skip answers to earlier requests (cannot normally happen: timeouts kill the worker)
+    while (1) {
+        char *payload = recv_frame(client->worker_fd, &start, MENU_TIMEOUT_SECONDS * 1000L);
+        if (!payload) {
+            LOG_ERROR("❌ No answer from menu worker (%s), restarting it", strerror(errno));
+            note_worker_failure(client);
+            stop_menu_worker(client);
+            return NULL;
+        }
         
-        if (date && cJSON_IsString(date)) {
-            strncpy(result->tomorrow.date, date->valuestring, sizeof(result->tomorrow.date) - 1);
+        cJSON *response = cJSON_Parse(payload);
+        free(payload);
+        if (!response) {
+            LOG_ERROR("❌ Invalid JSON from menu worker");
+            note_worker_failure(client);
+            stop_menu_worker(client);
+            return NULL;
         }
-        if (midi && cJSON_IsString(midi)) {
-            strncpy(result->tomorrow.midi, midi->valuestring, sizeof(result->tomorrow.midi) - 1);
+        
+        cJSON *response_id = cJSON_GetObjectItem(response, "id");
+        if (cJSON_IsNumber(response_id) && (unsigned)response_id->valuedouble == id) {
+            LOG_DEBUG("🐍 Menu worker answered '%s' in %ld ms", command, elapsed_ms(&start));
+            return response;
         }
-        if (soir && cJSON_IsString(soir)) {
-            strncpy(result->tomorrow.soir, soir->valuestring, sizeof(result->tomorrow.soir) - 1);
+        cJSON_Delete(response);
+    }
+}
+
+// ====================== RESPONSE PARSING ======================
+
+// Copy one {"date", "midi", "soir"} object
+static void parse_day_menu(const cJSON *json, DayMenuData *menu) {
+    cJSON *date = cJSON_GetObjectItem(json, "date");
+    cJSON *midi = cJSON_GetObjectItem(json, "midi");
+    cJSON *soir = cJSON_GetObjectItem(json, "soir");
+    
+    if (date && cJSON_IsString(date)) {
+        strncpy(menu->date, date->valuestring, sizeof(menu->date) - 1);
+    }
+    if (midi && cJSON_IsString(midi)) {
+        strncpy(menu->midi, midi->valuestring, sizeof(menu->midi) - 1);
+    }
+    if (soir && cJSON_IsString(soir)) {
+        strncpy(menu->soir, soir->valuestring, sizeof(menu->soir) - 1);
+    }
+}
+
+/**
+ * Extract per-day menus from the worker's "menus" object
+ * Returns: number of days filled (at most count), or -1 on a malformed response
+ */
+static int parse_python_response(const cJSON *json, DayMenuData *days, int count) {
+    if (!cJSON_IsObject(json)) {
+        return -1;
+    }
+    
+    int filled = 0;
+    const cJSON *day;
+    cJSON_ArrayForEach(day, cJSON_GetObjectItem(json, "days")) {
+        if (filled == count) break;
+        memset(&days[filled], 0, sizeof(DayMenuData));
+        parse_day_menu(day, &days[filled++]);
+    }
+    
+    // Older fetchers only answer today / tomorrow
+    if (filled == 0 && count >= 2) {
+        memset(days, 0, 2 * sizeof(DayMenuData));
+        parse_day_menu(cJSON_GetObjectItem(json, "today"), &days[0]);
+        parse_day_menu(cJSON_GetObjectItem(json, "tomorrow"), &days[1]);
+        filled = 2;
+    }
+    
+    return filled;
+}
+
+/**
+ * Fetch the menus of count consecutive days from start through the resident worker
+ * Returns: number of days filled, or -1 on failure
+ */
+static int fetch_menu_window(MenuClient *client, time_t start, DayMenuData *out, int count) {
+    // Format date as DD/MM/YYYY
+    struct tm tm_info_buf;
+    struct tm *tm_info = time_service_local(start, &tm_info_buf);
+    if (!tm_info) return -1;
+    char date_str[32];
+    snprintf(date_str, sizeof(date_str), "%02d/%02d/%04d", 
+             tm_info->tm_mday, tm_info->tm_mon + 1, tm_info->tm_year + 1900);
+    
+    cJSON *response = menu_worker_request(client, "menus", date_str, count);
+    if (!response) {
+        return -1;
+    }
+    
+    int result = -1;
+    cJSON *ok = cJSON_GetObjectItem(response, "ok");
+    if (cJSON_IsTrue(ok)) {
+        result = parse_python_response(cJSON_GetObjectItem(response, "menus"), out, count);
+    } else {
+        cJSON *error = cJSON_GetObjectItem(response, "error");
+        LOG_ERROR("❌ Menu worker error: %s", cJSON_IsString(error) ? error->valuestring : "unknown");
+    }
+    
+    cJSON_Delete(response);
+    return result;
+}
+
+#endif // MENU_BACKEND_NATIVE
+
+// ====================== MENU CACHE ======================
+
+static int date_key_of(time_t date) {
+    return time_service_date_int(date);
+}
+
+static const DayMenuData* cache_lookup(const MenuClient *client, int date_key) {
+    for (int i = 0; i < client->cache_count; i++) {
+        if (client->cache[i].date_key == date_key) {
+            return &client->cache[i].menu;
+        }
+    }
+    return NULL;
+}
+
+// Restore the window saved by a previous run (missing or corrupt file = empty cache)
+static void menu_cache_load(MenuClient *client) {
+    FILE *file = fopen(MENU_CACHE_FILE, "rb");
+    if (!file) {
+        return;
+    }
+    
+    char *content = malloc(MENU_CACHE_MAX_FILE_SIZE + 1);
+    size_t size = content ? fread(content, 1, MENU_CACHE_MAX_FILE_SIZE, file) : 0;
+    fclose(file);
+    if (!content) {
+        return;
+    }
+    content[size] = '\0';
+    
+    cJSON *json = cJSON_Parse(content);
+    free(content);
+    if (!json) {
+        LOG_ERROR("❌ Ignoring corrupt menu cache %s", MENU_CACHE_FILE);
+        return;
+    }
+    
+    cJSON *fetched_at = cJSON_GetObjectItem(json, "fetched_at");
+    client->cache_fetched_at = cJSON_IsNumber(fetched_at) ? (time_t)fetched_at->valuedouble : 0;
+    client->cache_count = 0;
+    
+    const cJSON *day;
+    cJSON_ArrayForEach(day, cJSON_GetObjectItem(json, "days")) {
+        cJSON *key = cJSON_GetObjectItem(day, "key");
+        if (!cJSON_IsNumber(key) || client->cache_count == MENU_CACHE_DAYS) continue;
+        
+        MenuCacheEntry *entry = &client->cache[client->cache_count++];
+        memset(entry, 0, sizeof(MenuCacheEntry));
+        entry->date_key = key->valueint;
+        
+        const char *fields[3] = { "date", "midi", "soir" };
+        char *targets[3] = { entry->menu.date, entry->menu.midi, entry->menu.soir };
+        size_t sizes[3] = { sizeof(entry->menu.date), sizeof(entry->menu.midi), sizeof(entry->menu.soir) };
+        for (int f = 0; f < 3; f++) {
+            cJSON *value = cJSON_GetObjectItem(day, fields[f]);
+            if (cJSON_IsString(value)) strncpy(targets[f], value->valuestring, sizes[f] - 1);
         }
     }
     
     cJSON_Delete(json);
-    return 0;
+    LOG_DEBUG("📋 Menu cache restored (%d days)", client->cache_count);
+}
+
+// Persist the window (written to a temporary file, then renamed into place)
+static void menu_cache_save(const MenuClient *client) {
+    cJSON *json = cJSON_CreateObject();
+    if (!json) return;
+    
+    cJSON_AddNumberToObject(json, "fetched_at", (double)client->cache_fetched_at);
+    cJSON *days = cJSON_AddArrayToObject(json, "days");
+    for (int i = 0; days && i < client->cache_count; i++) {
+        cJSON *day = cJSON_CreateObject();
+        if (!day) break;
+        cJSON_AddNumberToObject(day, "key", client->cache[i].date_key);
+        cJSON_AddStringToObject(day, "date", client->cache[i].menu.date);
+        cJSON_AddStringToObject(day, "midi", client->cache[i].menu.midi);
+        cJSON_AddStringToObject(day, "soir", client->cache[i].menu.soir);
+        cJSON_AddItemToArray(days, day);
+    }
+    
+    char *text = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (!text) return;
+    
+    if (mkdir(MENU_CACHE_DIR, 0755) != 0 && errno != EEXIST) {
+        LOG_ERROR("❌ Cannot create %s: %s", MENU_CACHE_DIR, strerror(errno));
+        cJSON_free(text);
+        return;
+    }
+    
+    FILE *file = fopen(MENU_CACHE_FILE ".tmp", "wb");
+    if (file) {
+        int ok = fputs(text, file) >= 0;
+        ok = (fclose(file) == 0) && ok;
+        if (!ok || rename(MENU_CACHE_FILE ".tmp", MENU_CACHE_FILE) != 0) {
+            LOG_ERROR("❌ Failed to write menu cache %s", MENU_CACHE_FILE);
+            remove(MENU_CACHE_FILE ".tmp");
+        }
+    }
+    cJSON_free(text);
+}
+
+/**
+ * Fetch MENU_CACHE_DAYS days from start and replace the cached window (client->lock held)
+ * Returns: 1 if any cached day changed, 0 if identical, -1 on failure (cache kept)
+ */
+static int refresh_menu_cache(MenuClient *client, time_t start) {
+    DayMenuData days[MENU_CACHE_DAYS];
+    uint64_t started = metrics_start();
+    int count = fetch_menu_window(client, start, days, MENU_CACHE_DAYS);
+    metrics_observe(METRIC_FETCH_MENU, started);
+    if (count <= 0) {
+        return -1;
+    }
+    
+    MenuCacheEntry fresh[MENU_CACHE_DAYS];
+    int changed = (count != client->cache_count);
+    for (int d = 0; d < count; d++) {
+        struct tm tm_info_buf;
+        struct tm *tm_info = time_service_local(start, &tm_info_buf);
+        if (!tm_info) return -1;
+        struct tm day = *tm_info;
+        day.tm_mday += d;
+        day.tm_hour = 12; // Clear of DST transitions
+        day.tm_isdst = -1;
+        
+        memset(&fresh[d], 0, sizeof(MenuCacheEntry));
+        fresh[d].date_key = date_key_of(time_service_mktime(&day));
+        fresh[d].menu = days[d];
+        
+        const DayMenuData *previous = cache_lookup(client, fresh[d].date_key);
+        if (!previous || strcmp(previous->midi, days[d].midi) != 0 || strcmp(previous->soir, days[d].soir) != 0) {
+            changed = 1;
+        }
+    }
+    
+    memcpy(client->cache, fresh, count * sizeof(MenuCacheEntry));
+    client->cache_count = count;
+    client->cache_fetched_at = time(NULL);
+    menu_cache_save(client);
+    
+    LOG_DEBUG("📋 Menu cache refreshed: %d days%s", count, changed ? " (changed)" : "");
+    return changed;
 }
 
+// ====================== PUBLIC API ======================
+
 // Initialize menu client
 MenuClient* menu_client_init(const char* credentials_file, const char* spreadsheet_id, int debug) {
-    MenuClient *client = malloc(sizeof(MenuClient));
+    MenuClient *client = calloc(1, sizeof(MenuClient));
     if (!client) return NULL;
     
     strncpy(client->credentials_file, credentials_file, sizeof(client->credentials_file) - 1);
     strncpy(client->spreadsheet_id, spreadsheet_id, sizeof(client->spreadsheet_id) - 1);
     client->debug = debug;
     client->access_token[0] = '\0';
+    pthread_mutex_init(&client->lock, NULL);
+    
+    // Menus survive restarts: the saved window is usable before the first fetch
+    menu_cache_load(client);
+    
+#ifndef MENU_BACKEND_NATIVE
+    client->worker_pid = 0;
+    client->worker_fd = -1;
+    client->restart_delay = MENU_RESTART_MIN_SECONDS;
+    
+    // Start the worker now so imports and authentication are done before the first fetch
+    start_menu_worker(client);
+#endif
     
     return client;
 }
@@ -163,11 +897,55 @@ MenuClient* menu_client_init(const char* credentials_file, const char* spreadshe
 // Free menu client
 void menu_client_free(MenuClient *client) {
     if (client) {
+        pthread_mutex_lock(&client->lock);
+#ifdef MENU_BACKEND_NATIVE
+        google_service_account_free(&client->account);
+#else
+        stop_menu_worker(client);
+#endif
+        pthread_mutex_unlock(&client->lock);
+        pthread_mutex_destroy(&client->lock);
         free(client);
     }
 }
 
-// Get menus for specific date
+// Restart a crashed worker once its backoff has elapsed
+void menu_client_supervise(MenuClient *client) {
+#ifdef MENU_BACKEND_NATIVE
+    (void)client; // No worker process with the native backend
+#else
+    if (!client) return;
+    
+    // A request in progress already handles the worker
+    if (pthread_mutex_trylock(&client->lock) != 0) {
+        return;
+    }
+    
+    if (client->worker_pid > 0 && !menu_worker_alive(client)) {
+        note_worker_failure(client);
+        LOG_INFO("🐍 Menu worker will be restarted in %d s", client->restart_delay);
+    }
+    
+    if (client->worker_pid <= 0 && time(NULL) >= client->next_restart) {
+        if (start_menu_worker(client) != 0) {
+            note_worker_failure(client);
+        }
+    }
+    
+    pthread_mutex_unlock(&client->lock);
+#endif
+}
+
+int menu_client_prefetch(MenuClient *client, time_t date) {
+    if (!client) return -1;
+    
+    pthread_mutex_lock(&client->lock);
+    int result = refresh_menu_cache(client, date);
+    pthread_mutex_unlock(&client->lock);
+    return result;
+}
+
+// Get menus for specific date (from the prefetched window when it covers both days)
 int get_menus_data(MenuClient *client, MenuData *data, time_t date) {
     // Initialize data with empty values
     strcpy(data->today.date, "");
@@ -177,24 +955,35 @@ int get_menus_data(MenuClient *client, MenuData *data, time_t date) {
     strcpy(data->tomorrow.midi, "-");
     strcpy(data->tomorrow.soir, "-");
     
-    // Format date as DD/MM/YYYY
-    struct tm *tm_info = localtime(&date);
-    char date_str[32];
-    snprintf(date_str, sizeof(date_str), "%02d/%02d/%04d", 
-             tm_info->tm_mday, tm_info->tm_mon + 1, tm_info->tm_year + 1900);
+    struct tm tm_info_buf;
     
-    // Call Python to get menu data
-    char *python_response = call_python_menu(client, date_str);
-    if (!python_response) {
-        return -1;
-    }
+    struct tm *tm_info = time_service_local(date, &tm_info_buf);
+    if (!tm_info) return -1;
+    struct tm tomorrow_tm = *tm_info;
+    tomorrow_tm.tm_mday += 1;
+    tomorrow_tm.tm_isdst = -1;
+    int today_key = date_key_of(date);
+    int tomorrow_key = date_key_of(time_service_mktime(&tomorrow_tm));
     
-    // Parse the JSON response
-    if (parse_python_response(python_response, data) != 0) {
-        free(python_response);
-        return -1;
+    pthread_mutex_lock(&client->lock);
+    
+    // Cache miss (first run, --date in debug mode): fetch the window synchronously
+    if (!cache_lookup(client, today_key) || !cache_lookup(client, tomorrow_key)) {
+        metrics_count(METRIC_CACHE_MISS_MENU);
+        if (refresh_menu_cache(client, date) < 0) {
+            pthread_mutex_unlock(&client->lock);
+            return -1;
+        }
+    } else {
+        metrics_count(METRIC_CACHE_HIT_MENU);
+        LOG_DEBUG("📋 Menus for %d served from cache", today_key);
     }
     
-    free(python_response);
-    return 0;
+    const DayMenuData *today = cache_lookup(client, today_key);
+    const DayMenuData *tomorrow = cache_lookup(client, tomorrow_key);
+    if (today) data->today = *today;
+    if (tomorrow) data->tomorrow = *tomorrow;
+    
+    pthread_mutex_unlock(&client->lock);
+    return (today && tomorrow) ? 0 : -1;
 }
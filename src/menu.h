@@ -3,6 +3,12 @@
 
 #include <time.h>
 
+// Days prefetched per fetch and kept in memory and in MENU_CACHE_FILE
+#define MENU_CACHE_DAYS 14
+#define MENU_CACHE_DIR PROJECT_ROOT "/cache"
+#define MENU_CACHE_FILE MENU_CACHE_DIR "/menus.json"
+#define MENU_CACHE_MAX_FILE_SIZE (64 * 1024)
+
 // Menu structure
 typedef struct {
     char date[64];
@@ -21,6 +27,24 @@ typedef struct MenuClient MenuClient;
 // Public functions
 MenuClient* menu_client_init(const char* credentials_file, const char* spreadsheet_id, int debug);
 void menu_client_free(MenuClient *client);
+
+/**
+ * Menus for date and the day after, from the prefetched window
+ * Only touches the network when the window does not cover both days.
+ * Returns: 0 on success, -1 on failure
+ */
 int get_menus_data(MenuClient *client, MenuData *data, time_t date);
 
+/**
+ * Fetch MENU_CACHE_DAYS days starting at date into the memory and disk cache
+ * Returns: 1 if any cached menu changed, 0 if unchanged, -1 on failure (cache kept)
+ */
+int menu_client_prefetch(MenuClient *client, time_t date);
+
+/**
+ * Restart the menu worker process if it died (with exponential backoff)
+ * Cheap enough to call from the main loop; never blocks on a running request.
+ */
+void menu_client_supervise(MenuClient *client);
+
 #endif // MENU_H
\ No newline at end of file
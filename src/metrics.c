@@ -0,0 +1,210 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "metrics.h"
+#include "logging.h"
+
+// Upper bounds of the histogram buckets (last bucket = +Inf), from a cache hit to a slow panel refresh
+static const uint64_t bucket_bounds_ns[] = {
+    100000ULL, 1000000ULL, 5000000ULL, 10000000ULL, 25000000ULL, 50000000ULL,
+    100000000ULL, 250000000ULL, 500000000ULL, 1000000000ULL, 2500000000ULL,
+    5000000000ULL, 10000000000ULL, 30000000000ULL
+};
+static const char *const bucket_labels[] = {
+    "0.0001", "0.001", "0.005", "0.01", "0.025", "0.05",
+    "0.1", "0.25", "0.5", "1", "2.5",
+    "5", "10", "30"
+};
+#define METRICS_BUCKET_COUNT ((int)(sizeof(bucket_bounds_ns) / sizeof(bucket_bounds_ns[0])))
+
+typedef struct {
+    uint64_t buckets[METRICS_BUCKET_COUNT + 1];     // Non-cumulative; the last one is +Inf
+    uint64_t count;
+    uint64_t sum_ns;
+    uint64_t max_ns;
+} Histogram;
+
+static Histogram histograms[METRIC_STAGE_COUNT];
+static uint64_t counters[METRIC_COUNTER_COUNT];
+
+static const char *const stage_names[METRIC_STAGE_COUNT] = {
+    "fetch_weather", "fetch_menu", "fetch_calendar",
+    "parse_weather", "parse_calendar",
+    "render", "draw_header", "draw_weather", "draw_menu", "draw_calendar",
+    "pixel_convert", "panel_init", "panel_display", "panel_partial", "panel_wake"
+};
+
+// Counter family and label value (one family per kind of event)
+static const struct {
+    const char *family;
+    const char *label;
+    const char *value;
+} counter_names[METRIC_COUNTER_COUNT] = {
+    { "dashboard_refreshes_total", "type", "full" },
+    { "dashboard_refreshes_total", "type", "fast" },
+    { "dashboard_refreshes_total", "type", "partial" },
+    { "dashboard_refreshes_total", "type", "clock" },
+    { "dashboard_retries_total", "source", "weather" },
+    { "dashboard_retries_total", "source", "menu" },
+    { "dashboard_retries_total", "source", "calendar" },
+    { "dashboard_cache_hits_total", "cache", "http_not_modified" },
+    { "dashboard_cache_hits_total", "cache", "menu" },
+    { "dashboard_cache_hits_total", "cache", "text_layout" },
+    { "dashboard_cache_hits_total", "cache", "section_layer" },
+    { "dashboard_cache_misses_total", "cache", "menu" },
+    { "dashboard_cache_misses_total", "cache", "text_layout" },
+    { "dashboard_cache_misses_total", "cache", "section_layer" },
+    { "dashboard_panel_mode_switches_total", "mode", "full" },
+    { "dashboard_panel_mode_switches_total", "mode", "fast" },
+    { "dashboard_panel_mode_switches_total", "mode", "partial" },
+    { "dashboard_panel_power_total", "state", "off" },
+    { "dashboard_panel_power_total", "state", "deep_sleep" },
+    { "dashboard_clock_folded_total", "into", "dashboard" },
+    { "dashboard_pool_buffers_total", "source", "reused" },
+    { "dashboard_pool_buffers_total", "source", "allocated" },
+    { "dashboard_feed_messages_total", "direction", "sent" },
+    { "dashboard_feed_messages_total", "direction", "received" }
+};
+
+// ====================== RECORDING ======================
+
+uint64_t metrics_start(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+void metrics_observe_ns(MetricStage stage, uint64_t duration_ns) {
+    if ((unsigned)stage >= METRIC_STAGE_COUNT) return;
+    Histogram *histogram = &histograms[stage];
+
+    int bucket = 0;
+    while (bucket < METRICS_BUCKET_COUNT && duration_ns > bucket_bounds_ns[bucket]) {
+        bucket++;
+    }
+
+    __atomic_fetch_add(&histogram->buckets[bucket], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&histogram->sum_ns, duration_ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&histogram->count, 1, __ATOMIC_RELAXED);
+
+    uint64_t max = __atomic_load_n(&histogram->max_ns, __ATOMIC_RELAXED);
+    while (duration_ns > max &&
+           !__atomic_compare_exchange_n(&histogram->max_ns, &max, duration_ns, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+void metrics_observe(MetricStage stage, uint64_t start) {
+    uint64_t now = metrics_start();
+    metrics_observe_ns(stage, now > start ? now - start : 0);
+}
+
+void metrics_count(MetricCounter counter) {
+    if ((unsigned)counter >= METRIC_COUNTER_COUNT) return;
+    __atomic_fetch_add(&counters[counter], 1, __ATOMIC_RELAXED);
+}
+
+// ====================== EXPOSITION ======================
+
+// Copy one histogram (values may race with writers by a sample, which is fine for monitoring)
+static void histogram_read(MetricStage stage, Histogram *copy) {
+    for (int i = 0; i <= METRICS_BUCKET_COUNT; i++) {
+        copy->buckets[i] = __atomic_load_n(&histograms[stage].buckets[i], __ATOMIC_RELAXED);
+    }
+    copy->count = __atomic_load_n(&histograms[stage].count, __ATOMIC_RELAXED);
+    copy->sum_ns = __atomic_load_n(&histograms[stage].sum_ns, __ATOMIC_RELAXED);
+    copy->max_ns = __atomic_load_n(&histograms[stage].max_ns, __ATOMIC_RELAXED);
+}
+
+int metrics_write_prometheus(const char *path) {
+    if (!path) return -1;
+
+    char temp_path[512];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+    FILE *file = fopen(temp_path, "w");
+    if (!file) {
+        LOG_ERROR("❌ Failed to write metrics file %s", temp_path);
+        return -1;
+    }
+
+    fprintf(file, "# HELP dashboard_stage_duration_seconds Time spent in each refresh stage.\n");
+    fprintf(file, "# TYPE dashboard_stage_duration_seconds histogram\n");
+    for (int stage = 0; stage < METRIC_STAGE_COUNT; stage++) {
+        Histogram histogram;
+        histogram_read((MetricStage)stage, &histogram);
+
+        uint64_t cumulative = 0;
+        for (int i = 0; i < METRICS_BUCKET_COUNT; i++) {
+            cumulative += histogram.buckets[i];
+            fprintf(file, "dashboard_stage_duration_seconds_bucket{stage=\"%s\",le=\"%s\"} %llu\n",
+                    stage_names[stage], bucket_labels[i], (unsigned long long)cumulative);
+        }
+        cumulative += histogram.buckets[METRICS_BUCKET_COUNT];
+        fprintf(file, "dashboard_stage_duration_seconds_bucket{stage=\"%s\",le=\"+Inf\"} %llu\n",
+                stage_names[stage], (unsigned long long)cumulative);
+        fprintf(file, "dashboard_stage_duration_seconds_sum{stage=\"%s\"} %.6f\n",
+                stage_names[stage], histogram.sum_ns / 1e9);
+        fprintf(file, "dashboard_stage_duration_seconds_count{stage=\"%s\"} %llu\n",
+                stage_names[stage], (unsigned long long)cumulative);
+    }
+
+    const char *family = NULL;
+    for (int i = 0; i < METRIC_COUNTER_COUNT; i++) {
+        if (!family || strcmp(family, counter_names[i].family) != 0) {
+            family = counter_names[i].family;
+            fprintf(file, "# TYPE %s counter\n", family);
+        }
+        fprintf(file, "%s{%s=\"%s\"} %llu\n", family, counter_names[i].label, counter_names[i].value,
+                (unsigned long long)__atomic_load_n(&counters[i], __ATOMIC_RELAXED));
+    }
+
+    int failed = ferror(file);
+    if (fclose(file) != 0 || failed || rename(temp_path, path) != 0) {
+        LOG_ERROR("❌ Failed to publish metrics file %s", path);
+        remove(temp_path);
+        return -1;
+    }
+    return 0;
+}
+
+// Upper bound of the bucket holding the given quantile, in milliseconds (max when it lands in +Inf)
+static double quantile_upper_ms(const Histogram *histogram, double quantile) {
+    uint64_t rank = (uint64_t)(quantile * histogram->count + 0.5);
+    if (rank == 0) rank = 1;
+
+    uint64_t cumulative = 0;
+    for (int i = 0; i < METRICS_BUCKET_COUNT; i++) {
+        cumulative += histogram->buckets[i];
+        if (cumulative >= rank) {
+            uint64_t bound = bucket_bounds_ns[i] < histogram->max_ns ? bucket_bounds_ns[i] : histogram->max_ns;
+            return bound / 1e6;
+        }
+    }
+    return histogram->max_ns / 1e6;
+}
+
+void metrics_log_summary(void) {
+    LOG_INFO("📊 Stage latencies (count, mean, p50 <=, p95 <=, max):");
+    for (int stage = 0; stage < METRIC_STAGE_COUNT; stage++) {
+        Histogram histogram;
+        histogram_read((MetricStage)stage, &histogram);
+        if (histogram.count == 0) continue;
+
+        LOG_INFO("📊   %-15s %6llu  %9.2f ms  %9.2f ms  %9.2f ms  %9.2f ms", stage_names[stage],
+                 (unsigned long long)histogram.count, histogram.sum_ns / 1e6 / histogram.count,
+                 quantile_upper_ms(&histogram, 0.50), quantile_upper_ms(&histogram, 0.95),
+                 histogram.max_ns / 1e6);
+    }
+
+    char line[1024];
+    size_t used = 0;
+    line[0] = '\0';
+    for (int i = 0; i < METRIC_COUNTER_COUNT && used < sizeof(line); i++) {
+        const char *kind = counter_names[i].family + strlen("dashboard_");
+        used += snprintf(line + used, sizeof(line) - used, "%s%.*s[%s]=%llu", i ? " " : "",
+                         (int)(strlen(kind) - strlen("_total")), kind, counter_names[i].value,
+                         (unsigned long long)__atomic_load_n(&counters[i], __ATOMIC_RELAXED));
+    }
+    LOG_INFO("📊 Counters: %s", line);
+}
@@ -0,0 +1,90 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+
+// Prometheus text file (node_exporter textfile collector format), rewritten atomically
+#define METRICS_FILE_PATH PROJECT_ROOT "/log/dashboard.prom"
+#define METRICS_WRITE_INTERVAL_SEC 60
+
+// Timed stages (one fixed-bucket latency histogram each)
+typedef enum {
+    METRIC_FETCH_WEATHER,       // HTTP request for the forecast
+    METRIC_FETCH_MENU,          // Menu window refresh (worker or Sheets API)
+    METRIC_FETCH_CALENDAR,      // Streamed iCal download, parsing included
+    METRIC_PARSE_WEATHER,       // In-place scan of the forecast JSON
+    METRIC_PARSE_CALENDAR,      // iCal parser time spent inside the stream
+    METRIC_RENDER,              // render_dashboard_sections
+    METRIC_DRAW_HEADER,
+    METRIC_DRAW_WEATHER,
+    METRIC_DRAW_MENU,
+    METRIC_DRAW_CALENDAR,
+    METRIC_PIXEL_CONVERT,       // Rotate, luma and dithering into the frame
+    METRIC_PANEL_INIT,          // EPD_7IN5_V2_Init* mode switches (busy-waits included)
+    METRIC_PANEL_DISPLAY,       // EPD_7IN5_V2_Display: SPI transfer and busy-wait
+    METRIC_PANEL_PARTIAL,       // EPD_7IN5_V2_Display_Part: SPI transfer and busy-wait
+    METRIC_PANEL_WAKE,          // Power-on after an idle power-off, or re-init after deep sleep
+    METRIC_STAGE_COUNT
+} MetricStage;
+
+// Event counters
+typedef enum {
+    METRIC_REFRESH_FULL,
+    METRIC_REFRESH_FAST,
+    METRIC_REFRESH_PARTIAL,
+    METRIC_REFRESH_CLOCK,
+    METRIC_RETRY_WEATHER,
+    METRIC_RETRY_MENU,
+    METRIC_RETRY_CALENDAR,
+    METRIC_CACHE_HIT_HTTP,      // 304 Not Modified
+    METRIC_CACHE_HIT_MENU,
+    METRIC_CACHE_HIT_LAYOUT,    // Text drawn from a cached glyph layout
+    METRIC_CACHE_HIT_LAYER,     // Section composited from its retained layer
+    METRIC_CACHE_MISS_MENU,
+    METRIC_CACHE_MISS_LAYOUT,
+    METRIC_CACHE_MISS_LAYER,
+    METRIC_MODE_SWITCH_FULL,    // Controller re-initialized into a refresh mode
+    METRIC_MODE_SWITCH_FAST,
+    METRIC_MODE_SWITCH_PARTIAL,
+    METRIC_PANEL_POWER_OFF,     // Booster off during an idle window (registers and RAM kept)
+    METRIC_PANEL_DEEP_SLEEP,
+    METRIC_CLOCK_FOLDED,        // Clock tick drawn by a dashboard refresh instead of its own partial
+    METRIC_POOL_REUSED,         // Buffer served from a subsystem pool (buffer_pool.h)
+    METRIC_POOL_ALLOCATED,      // Heap allocation or growth by a pool: flat once warmed up
+    METRIC_FEED_SENT,           // Snapshot message sent to one feed subscriber (snapshot_feed.h)
+    METRIC_FEED_RECEIVED,       // Snapshot message published from the producer's feed
+    METRIC_COUNTER_COUNT
+} MetricCounter;
+
+/**
+ * Monotonic start mark for metrics_observe (clock_gettime, no syscall on vDSO targets)
+ */
+uint64_t metrics_start(void);
+
+/**
+ * Record the time elapsed since start in the stage histogram (lock-free, any thread)
+ */
+void metrics_observe(MetricStage stage, uint64_t start);
+
+/**
+ * Record an already-measured duration in nanoseconds
+ */
+void metrics_observe_ns(MetricStage stage, uint64_t duration_ns);
+
+/**
+ * Increment an event counter (lock-free, any thread)
+ */
+void metrics_count(MetricCounter counter);
+
+/**
+ * Write every histogram and counter in Prometheus text format (temporary file + rename)
+ * Returns: 0 on success, -1 on failure
+ */
+int metrics_write_prometheus(const char *path);
+
+/**
+ * Log one summary line per stage that has samples (count, mean, p50, p95 upper bounds, max)
+ */
+void metrics_log_summary(void);
+
+#endif // METRICS_H
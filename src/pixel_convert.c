@@ -0,0 +1,264 @@
+#include <string.h>
+#include "pixel_convert.h"
+
+// PIXEL_FORCE_SCALAR builds the portable kernels only (tests compare both paths)
+#if defined(PIXEL_FORCE_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PIXEL_USE_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PIXEL_USE_SSE2 1
+#endif
+
+// ====================== CONSTANTS ======================
+
+// Fixed-point error diffusion precision (Q16)
+#define ERROR_SHIFT 16
+#define ERROR_WHITE (255 << ERROR_SHIFT)
+#define ERROR_THRESHOLD (PIXEL_THRESHOLD << ERROR_SHIFT)
+
+// ====================== SCALAR HELPERS ======================
+
+/**
+ * Fixed-point luma of one Cairo pixel (B-G-R-A byte order in memory)
+ */
+static inline uint8_t luma_of_pixel(const uint8_t *pixel) {
+    return (uint8_t)((LUMA_WEIGHT_B * pixel[0] + LUMA_WEIGHT_G * pixel[1] +
+                      LUMA_WEIGHT_R * pixel[2] + (1 << (LUMA_SHIFT - 1))) >> LUMA_SHIFT);
+}
+
+/**
+ * Reverse bit order of a byte (SIMD movemask is LSB first, e-ink packing is MSB first)
+ */
+static inline uint8_t reverse_bits(uint8_t b) {
+    b = (uint8_t)(((b & 0xF0) >> 4) | ((b & 0x0F) << 4));
+    b = (uint8_t)(((b & 0xCC) >> 2) | ((b & 0x33) << 2));
+    b = (uint8_t)(((b & 0xAA) >> 1) | ((b & 0x55) << 1));
+    return b;
+}
+
+static void luma_row_scalar(const uint8_t *src, int count, uint8_t *out) {
+    for (int i = 0; i < count; i++) {
+        out[i] = luma_of_pixel(src + i * 4);
+    }
+}
+
+// ====================== SIMD KERNELS ======================
+
+#if defined(PIXEL_USE_NEON)
+
+// Luma of 16 consecutive pixels
+static inline void luma_row16(const uint8_t *src, uint8_t *out) {
+    uint8x16x4_t px = vld4q_u8(src);  // Deinterleave B, G, R, A
+
+    uint16x8_t lo = vmull_u8(vget_low_u8(px.val[0]), vdup_n_u8(LUMA_WEIGHT_B));
+    lo = vmlal_u8(lo, vget_low_u8(px.val[1]), vdup_n_u8(LUMA_WEIGHT_G));
+    lo = vmlal_u8(lo, vget_low_u8(px.val[2]), vdup_n_u8(LUMA_WEIGHT_R));
+
+    uint16x8_t hi = vmull_u8(vget_high_u8(px.val[0]), vdup_n_u8(LUMA_WEIGHT_B));
+    hi = vmlal_u8(hi, vget_high_u8(px.val[1]), vdup_n_u8(LUMA_WEIGHT_G));
+    hi = vmlal_u8(hi, vget_high_u8(px.val[2]), vdup_n_u8(LUMA_WEIGHT_R));
+
+    vst1q_u8(out, vcombine_u8(vrshrn_n_u16(lo, LUMA_SHIFT), vrshrn_n_u16(hi, LUMA_SHIFT)));
+}
+
+// Compare 16 luma values against 16 per-column thresholds into 2 packed bytes
+static inline void pack_threshold16(const uint8_t *luma, const uint8_t *thresholds, uint8_t *out) {
+    static const uint8_t bit_weights[16] = {
+        128, 64, 32, 16, 8, 4, 2, 1, 128, 64, 32, 16, 8, 4, 2, 1
+    };
+    uint8x16_t white = vcgtq_u8(vld1q_u8(luma), vld1q_u8(thresholds));
+    uint8x16_t bits = vandq_u8(white, vld1q_u8(bit_weights));
+
+    // Horizontal add of each 8-lane half (works on both ARMv7 and AArch64)
+    uint8x8_t sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+    sum = vpadd_u8(sum, sum);
+    sum = vpadd_u8(sum, sum);
+
+    out[0] = vget_lane_u8(sum, 0);
+    out[1] = vget_lane_u8(sum, 1);
+}
+
+#elif defined(PIXEL_USE_SSE2)
+
+// Luma of 8 consecutive pixels as 16-bit lanes
+static inline __m128i luma_row8_epi16(const uint8_t *src) {
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    __m128i p0 = _mm_loadu_si128((const __m128i *)src);
+    __m128i p1 = _mm_loadu_si128((const __m128i *)(src + 16));
+
+    __m128i b = _mm_packs_epi32(_mm_and_si128(p0, byte_mask), _mm_and_si128(p1, byte_mask));
+    __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), byte_mask),
+                                _mm_and_si128(_mm_srli_epi32(p1, 8), byte_mask));
+    __m128i r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), byte_mask),
+                                _mm_and_si128(_mm_srli_epi32(p1, 16), byte_mask));
+
+    // Max 255 * 256 + 128 fits in unsigned 16-bit
+    __m128i sum = _mm_mullo_epi16(b, _mm_set1_epi16(LUMA_WEIGHT_B));
+    sum = _mm_add_epi16(sum, _mm_mullo_epi16(g, _mm_set1_epi16(LUMA_WEIGHT_G)));
+    sum = _mm_add_epi16(sum, _mm_mullo_epi16(r, _mm_set1_epi16(LUMA_WEIGHT_R)));
+    sum = _mm_add_epi16(sum, _mm_set1_epi16(1 << (LUMA_SHIFT - 1)));
+    return _mm_srli_epi16(sum, LUMA_SHIFT);
+}
+
+// Luma of 16 consecutive pixels
+static inline void luma_row16(const uint8_t *src, uint8_t *out) {
+    __m128i lo = luma_row8_epi16(src);
+    __m128i hi = luma_row8_epi16(src + 32);
+    _mm_storeu_si128((__m128i *)out, _mm_packus_epi16(lo, hi));
+}
+
+// Compare 16 luma values against 16 per-column thresholds into 2 packed bytes
+static inline void pack_threshold16(const uint8_t *luma, const uint8_t *thresholds, uint8_t *out) {
+    // Unsigned compare via sign-bit flip
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    __m128i values = _mm_xor_si128(_mm_loadu_si128((const __m128i *)luma), bias);
+    __m128i limit = _mm_xor_si128(_mm_loadu_si128((const __m128i *)thresholds), bias);
+    int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(values, limit));
+
+    out[0] = reverse_bits((uint8_t)(mask & 0xFF));
+    out[1] = reverse_bits((uint8_t)(mask >> 8));
+}
+
+#else
+
+static inline void luma_row16(const uint8_t *src, uint8_t *out) {
+    luma_row_scalar(src, 16, out);
+}
+
+static inline void pack_threshold16(const uint8_t *luma, const uint8_t *thresholds, uint8_t *out) {
+    for (int half = 0; half < 2; half++) {
+        uint8_t byte = 0;
+        for (int bit = 0; bit < 8; bit++) {
+            int i = half * 8 + bit;
+            byte = (uint8_t)((byte << 1) | (luma[i] > thresholds[i]));
+        }
+        out[half] = byte;
+    }
+}
+
+#endif
+
+// ====================== ROTATION ======================
+
+void pixel_luma_rotate(const uint8_t *src, int width, int height, int stride, uint8_t *luma) {
+    if (!src || !luma || width <= 0 || height <= 0) {
+        return;
+    }
+
+    uint8_t tile[PIXEL_TILE_SIZE][PIXEL_TILE_SIZE];
+
+    // Walk the source in square tiles so both reads and rotated writes stay in cache
+    for (int ty = 0; ty < height; ty += PIXEL_TILE_SIZE) {
+        int tile_h = (height - ty < PIXEL_TILE_SIZE) ? height - ty : PIXEL_TILE_SIZE;
+
+        for (int tx = 0; tx < width; tx += PIXEL_TILE_SIZE) {
+            int tile_w = (width - tx < PIXEL_TILE_SIZE) ? width - tx : PIXEL_TILE_SIZE;
+
+            // Contiguous reads: luma of each source row segment
+            for (int r = 0; r < tile_h; r++) {
+                const uint8_t *row = src + (size_t)(ty + r) * stride + (size_t)tx * 4;
+                if (tile_w == PIXEL_TILE_SIZE) {
+                    luma_row16(row, tile[r]);
+                } else {
+                    luma_row_scalar(row, tile_w, tile[r]);
+                }
+            }
+
+            // Rotated writes: source column becomes destination row
+            for (int c = 0; c < tile_w; c++) {
+                uint8_t *dst = luma + (size_t)(width - 1 - (tx + c)) * height + ty;
+                for (int r = 0; r < tile_h; r++) {
+                    dst[r] = tile[r][c];
+                }
+            }
+        }
+    }
+}
+
+// ====================== PACKING ======================
+
+void pixel_pack_row_diffused(const uint8_t *luma, int width, uint8_t *out) {
+    if (!luma || !out) {
+        return;
+    }
+
+    int32_t carry = 0;  // Error pushed to the right pixel (Q16)
+    uint8_t byte = 0;
+
+    for (int x = 0; x < width; x++) {
+        int32_t gray = ((int32_t)luma[x] << ERROR_SHIFT) + carry;
+        if (gray < 0) gray = 0;
+        if (gray > ERROR_WHITE) gray = ERROR_WHITE;
+
+        int white = gray > ERROR_THRESHOLD;
+        int32_t error = gray - (white ? ERROR_WHITE : 0);
+        carry = (error * 7) / 16;
+
+        // Accumulate 8 pixels per output byte (MSB first)
+        byte = (uint8_t)((byte << 1) | white);
+        if ((x & 7) == 7) {
+            out[x >> 3] = byte;
+            byte = 0;
+        }
+    }
+
+    if (width & 7) {
+        out[width >> 3] = (uint8_t)(byte << (8 - (width & 7)));
+    }
+}
+
+void pixel_pack_row_ordered(const uint8_t *luma, int width, const uint8_t *thresholds, uint8_t *out) {
+    if (!luma || !thresholds || !out) {
+        return;
+    }
+
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        pack_threshold16(luma + x, thresholds, out + (x >> 3));
+    }
+
+    // Remaining pixels one byte at a time
+    uint8_t byte = 0;
+    for (; x < width; x++) {
+        byte = (uint8_t)((byte << 1) | (luma[x] > thresholds[x & 15]));
+        if ((x & 7) == 7) {
+            out[x >> 3] = byte;
+            byte = 0;
+        }
+    }
+    if (width & 7) {
+        out[width >> 3] = (uint8_t)(byte << (8 - (width & 7)));
+    }
+}
+
+void pixel_pack_row_threshold(const uint8_t *luma, int width, uint8_t threshold, uint8_t *out) {
+    uint8_t thresholds[16];
+    memset(thresholds, threshold, sizeof(thresholds));
+    pixel_pack_row_ordered(luma, width, thresholds, out);
+}
+
+void pixel_convert_frame(const uint8_t *src, int width, int height, int stride,
+                         uint8_t *luma_scratch, uint8_t *frame, int row_bytes) {
+    if (!src || !luma_scratch || !frame) {
+        return;
+    }
+
+    pixel_luma_rotate(src, width, height, stride, luma_scratch);
+
+    // Rotated frame: `width` rows of `height` pixels
+    for (int y = 0; y < width; y++) {
+        pixel_pack_row_diffused(luma_scratch + (size_t)y * height, height, frame + (size_t)y * row_bytes);
+    }
+}
+
+const char* pixel_convert_backend(void) {
+#if defined(PIXEL_USE_NEON)
+    return "neon";
+#elif defined(PIXEL_USE_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
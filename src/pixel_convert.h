@@ -0,0 +1,56 @@
+#ifndef PIXEL_CONVERT_H
+#define PIXEL_CONVERT_H
+
+#include <stdint.h>
+
+// Fixed-point replacement of the float rotate/luma/diffusion loop once in display_dashboard.c.
+// On gray input (R = G = B, all the dashboard draws) pixel_convert_frame is bit-identical to
+// it on every backend ("make check"). Colored pixels can differ at luma rounding ties.
+
+// Cache-blocked rotation tile size (pixels per side)
+#define PIXEL_TILE_SIZE 16
+
+// Quantization threshold: luma > threshold is white
+#define PIXEL_THRESHOLD 128
+
+// Fixed-point luma weights (ITU-R BT.601, Q8, sum = 256 so gray maps to itself)
+#define LUMA_WEIGHT_R 77
+#define LUMA_WEIGHT_G 150
+#define LUMA_WEIGHT_B 29
+#define LUMA_SHIFT 8
+
+/**
+ * Compute 8-bit luma of a Cairo RGB24/ARGB32 image and rotate it 90° clockwise
+ * The output has `height` columns and `width` rows (portrait -> landscape):
+ *   luma[y * height + x] = L(src pixel at column width-1-y, row x)
+ */
+void pixel_luma_rotate(const uint8_t *src, int width, int height, int stride, uint8_t *luma);
+
+/**
+ * Pack one luma row into 1-bit pixels (1 = white, MSB first)
+ * Error diffusion to the right pixel only (7/16), reset at each row start
+ */
+void pixel_pack_row_diffused(const uint8_t *luma, int width, uint8_t *out);
+
+/**
+ * Pack one luma row into 1-bit pixels by plain thresholding (1 = white, MSB first)
+ */
+void pixel_pack_row_threshold(const uint8_t *luma, int width, uint8_t threshold, uint8_t *out);
+
+/**
+ * Pack one luma row against a repeating 16-column threshold pattern (ordered dither)
+ * thresholds[i] applies to every column x with x % 16 == i
+ */
+void pixel_pack_row_ordered(const uint8_t *luma, int width, const uint8_t *thresholds, uint8_t *out);
+
+/**
+ * Convert a Cairo RGB24/ARGB32 surface buffer into a packed 1-bit landscape frame
+ * luma_scratch must hold width * height bytes; frame rows are row_bytes apart
+ */
+void pixel_convert_frame(const uint8_t *src, int width, int height, int stride,
+                         uint8_t *luma_scratch, uint8_t *frame, int row_bytes);
+
+// Name of the compiled SIMD backend ("neon", "sse2" or "scalar")
+const char* pixel_convert_backend(void);
+
+#endif // PIXEL_CONVERT_H
@@ -0,0 +1,119 @@
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "poll_policy.h"
+#include "time_service.h"
+
+// ====================== RETRY BACKOFF ======================
+
+void retry_backoff_init(RetryBackoff *backoff, int base_delay, int max_delay) {
+    if (!backoff) {
+        return;
+    }
+    
+    backoff->base_delay = base_delay > 0 ? base_delay : 1;
+    backoff->max_delay = max_delay > backoff->base_delay ? max_delay : backoff->base_delay;
+    backoff->failures = 0;
+    // Distinct per instance and per process so restarted panels spread out too
+    backoff->seed = (unsigned int)time(NULL) ^ ((unsigned int)getpid() << 16) ^ (unsigned int)(uintptr_t)backoff;
+}
+
+void retry_backoff_reset(RetryBackoff *backoff) {
+    if (backoff) {
+        backoff->failures = 0;
+    }
+}
+
+int retry_backoff_next_delay(RetryBackoff *backoff) {
+    if (!backoff) {
+        return RETRY_BACKOFF_BASE;
+    }
+    
+    long delay = backoff->base_delay;
+    for (int i = 0; i < backoff->failures && delay < backoff->max_delay; i++) {
+        delay *= 2;
+    }
+    if (delay > backoff->max_delay) {
+        delay = backoff->max_delay;
+    }
+    backoff->failures++;
+    
+    // Equal jitter: [delay / 2, delay]
+    long half = delay / 2;
+    long jittered = half + (long)(rand_r(&backoff->seed) % (half + 1));
+    return jittered > 0 ? (int)jittered : 1;
+}
+
+// ====================== POLL POLICY ======================
+
+void poll_policy_init(PollPolicy *policy, int base_interval, int max_interval) {
+    if (!policy) {
+        return;
+    }
+    
+    policy->base_interval = base_interval > 0 ? base_interval : POLL_DEFAULT_BASE_INTERVAL;
+    policy->max_interval = max_interval > policy->base_interval ? max_interval : policy->base_interval;
+    policy->unchanged_streak = 0;
+    policy->fresh_until = 0;
+    retry_backoff_init(&policy->backoff, RETRY_BACKOFF_BASE, RETRY_BACKOFF_MAX);
+}
+
+void poll_policy_record_success(PollPolicy *policy, time_t now, int changed, long max_age) {
+    if (!policy) {
+        return;
+    }
+    
+    policy->unchanged_streak = changed ? 0 : policy->unchanged_streak + 1;
+    policy->fresh_until = max_age > 0 ? now + max_age : 0;
+    retry_backoff_reset(&policy->backoff);
+}
+
+time_t poll_policy_record_failure(PollPolicy *policy, time_t now) {
+    if (!policy) {
+        return now + RETRY_BACKOFF_BASE;
+    }
+    
+    policy->fresh_until = 0;
+    return now + retry_backoff_next_delay(&policy->backoff);
+}
+
+// Start of the local hour containing timestamp (whole-hour and half-hour zones alike)
+static time_t hour_start(time_t timestamp) {
+    struct tm tm_buf;
+    struct tm *tm = time_service_local(timestamp, &tm_buf);
+    if (!tm) {
+        return timestamp - timestamp % 3600;
+    }
+    return timestamp - (tm->tm_min * 60 + tm->tm_sec);
+}
+
+time_t poll_policy_next(const PollPolicy *policy, time_t now) {
+    if (!policy) {
+        return now + POLL_DEFAULT_BASE_INTERVAL;
+    }
+    
+    // Shortly after an hour boundary the models and the forecast window have just moved
+    time_t hour = hour_start(now);
+    long interval = policy->base_interval;
+    if (now - hour >= POLL_BOUNDARY_WINDOW) {
+        for (int i = 0; i < policy->unchanged_streak && interval < policy->max_interval; i++) {
+            interval *= 2;
+        }
+        if (interval > policy->max_interval) {
+            interval = policy->max_interval;
+        }
+    }
+    
+    time_t next = now + interval;
+    if (policy->fresh_until > next) {
+        next = policy->fresh_until < now + policy->max_interval ? policy->fresh_until : now + policy->max_interval;
+    }
+    
+    // The displayed forecast starts at the next hour: never let a poll skip past it
+    time_t boundary = hour + POLL_BOUNDARY_LEAD;
+    if (boundary <= now) {
+        boundary += 3600;
+    }
+    return next < boundary ? next : boundary;
+}
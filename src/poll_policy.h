@@ -0,0 +1,69 @@
+#ifndef POLL_POLICY_H
+#define POLL_POLICY_H
+
+#include <time.h>
+
+// Weather polling (Open-Meteo current values move every 15 minutes, hourly models far less often)
+#define POLL_DEFAULT_BASE_INTERVAL (10 * 60)    // Interval while responses keep changing
+#define POLL_DEFAULT_MAX_INTERVAL (40 * 60)     // Ceiling reached after repeated unchanged responses
+#define POLL_BOUNDARY_LEAD 60                   // Poll this long after each local hour (forecast window shifts)
+#define POLL_BOUNDARY_WINDOW (10 * 60)          // Back to the base interval this long after each hour
+
+// Failed retrievals: jittered exponential backoff
+#define RETRY_BACKOFF_BASE 60                   // First retry after 30-60 seconds
+#define RETRY_BACKOFF_MAX (30 * 60)             // Ceiling of the doubling delay
+
+// Jittered exponential backoff for one source
+typedef struct {
+    int base_delay;         // Delay of the first retry (seconds)
+    int max_delay;          // Ceiling of the doubling delay (seconds)
+    int failures;           // Consecutive failures since the last success
+    unsigned int seed;      // rand_r state (per source, no shared RNG)
+} RetryBackoff;
+
+// Decides when to poll next from the change rate, the cache headers and the hour boundaries
+typedef struct {
+    int base_interval;      // Interval while responses keep changing (seconds)
+    int max_interval;       // Ceiling of the doubling interval (seconds)
+    int unchanged_streak;   // Successive successful polls that changed nothing on screen
+    time_t fresh_until;     // Server-declared freshness (0 = none)
+    RetryBackoff backoff;
+} PollPolicy;
+
+// Retry backoff
+void retry_backoff_init(RetryBackoff *backoff, int base_delay, int max_delay);
+void retry_backoff_reset(RetryBackoff *backoff);
+
+/**
+ * Record a failure and draw the delay before the next attempt
+ * Doubles from base_delay up to max_delay, uniformly jittered over its upper half
+ * so that sources failing together (network down) do not retry in lockstep.
+ * Returns: delay in seconds (>= 1)
+ */
+int retry_backoff_next_delay(RetryBackoff *backoff);
+
+// Poll policy
+void poll_policy_init(PollPolicy *policy, int base_interval, int max_interval);
+
+/**
+ * Record a successful poll (a 304 counts as unchanged)
+ * max_age: freshness from the response cache headers in seconds (-1 = none given)
+ */
+void poll_policy_record_success(PollPolicy *policy, time_t now, int changed, long max_age);
+
+/**
+ * Record a failed poll
+ * Returns: absolute time of the retry
+ */
+time_t poll_policy_record_failure(PollPolicy *policy, time_t now);
+
+/**
+ * Next poll time strictly after now
+ * The interval doubles with each unchanged response up to max_interval, never ends
+ * before the server-declared freshness, and is cut to just after the next local hour
+ * (and to base_interval shortly after it) when the forecast window moves on screen.
+ * Returns: absolute time of the next poll
+ */
+time_t poll_policy_next(const PollPolicy *policy, time_t now);
+
+#endif // POLL_POLICY_H
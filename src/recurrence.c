@@ -0,0 +1,267 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "recurrence.h"
+
+// ====================== CIVIL DAYS ======================
+
+int recurrence_day_from_civil(int year, int month, int day) {
+    year -= month <= 2;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int year_of_era = year - era * 400;
+    int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+void recurrence_civil_from_day(int day_number, int *year, int *month, int *day) {
+    int z = day_number + 719468;
+    int era = (z >= 0 ? z : z - 146096) / 146097;
+    int day_of_era = z - era * 146097;
+    int year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    int day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    int mp = (5 * day_of_year + 2) / 153;
+    int m = mp < 10 ? mp + 3 : mp - 9;
+
+    *year = year_of_era + era * 400 + (m <= 2);
+    *month = m;
+    *day = day_of_year - (153 * mp + 2) / 5 + 1;
+}
+
+// 0 = Monday ... 6 = Sunday (1970-01-01 was a Thursday)
+static inline int weekday_of(int day_number) {
+    int weekday = (day_number + 3) % 7;
+    return weekday < 0 ? weekday + 7 : weekday;
+}
+
+static int days_in_month(int year, int month) {
+    static const int lengths[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    if (month == 2 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)) {
+        return 29;
+    }
+    return lengths[month - 1];
+}
+
+// ====================== RULE PARSING ======================
+
+static int parse_weekday_name(const char *name) {
+    static const char *names[7] = { "MO", "TU", "WE", "TH", "FR", "SA", "SU" };
+    for (int i = 0; i < 7; i++) {
+        if (strncasecmp(name, names[i], 2) == 0 && name[2] == '\0') {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Parse "MO,2TU,-1FR" into rule->by_day
+static int parse_by_day(char *list, RecurrenceRule *rule) {
+    char *saveptr = NULL;
+    for (char *item = strtok_r(list, ",", &saveptr); item; item = strtok_r(NULL, ",", &saveptr)) {
+        if (rule->by_day_count >= RECURRENCE_MAX_BYDAY) return -1;
+
+        char *end = item;
+        long ordinal = strtol(item, &end, 10);
+        int weekday = parse_weekday_name(end);
+        if (weekday < 0 || ordinal < -53 || ordinal > 53) return -1;
+
+        rule->by_day[rule->by_day_count].weekday = (int8_t)weekday;
+        rule->by_day[rule->by_day_count].ordinal = (int8_t)ordinal;
+        rule->by_day_count++;
+    }
+    return rule->by_day_count > 0 ? 0 : -1;
+}
+
+// Parse a comma-separated integer list within [min, max] (0 never allowed)
+static int parse_int_list(char *list, int min, int max, int *values, int max_values) {
+    int count = 0;
+    char *saveptr = NULL;
+    for (char *item = strtok_r(list, ",", &saveptr); item; item = strtok_r(NULL, ",", &saveptr)) {
+        char *end = NULL;
+        long value = strtol(item, &end, 10);
+        if (end == item || *end != '\0' || value == 0 || value < min || value > max) return -1;
+        if (count >= max_values) return -1;
+        values[count++] = (int)value;
+    }
+    return count;
+}
+
+int recurrence_parse(const char *value, RecurrenceRule *rule) {
+    if (!value || !rule) {
+        return -1;
+    }
+
+    memset(rule, 0, sizeof(RecurrenceRule));
+    rule->interval = 1;
+
+    char buffer[512];
+    strncpy(buffer, value, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+
+    int have_frequency = 0;
+    int week_starts_monday = 1;
+    char *saveptr = NULL;
+    for (char *part = strtok_r(buffer, ";", &saveptr); part; part = strtok_r(NULL, ";", &saveptr)) {
+        char *eq = strchr(part, '=');
+        if (!eq) return -1;
+        *eq = '\0';
+        char *key = part;
+        char *val = eq + 1;
+
+        if (strcasecmp(key, "FREQ") == 0) {
+            if (strcasecmp(val, "DAILY") == 0) rule->frequency = RECURRENCE_DAILY;
+            else if (strcasecmp(val, "WEEKLY") == 0) rule->frequency = RECURRENCE_WEEKLY;
+            else if (strcasecmp(val, "MONTHLY") == 0) rule->frequency = RECURRENCE_MONTHLY;
+            else if (strcasecmp(val, "YEARLY") == 0) rule->frequency = RECURRENCE_YEARLY;
+            else return -1; // SECONDLY / MINUTELY / HOURLY are not useful on a day view
+            have_frequency = 1;
+        } else if (strcasecmp(key, "INTERVAL") == 0) {
+            rule->interval = atoi(val);
+            if (rule->interval < 1) return -1;
+        } else if (strcasecmp(key, "COUNT") == 0) {
+            rule->count = atoi(val);
+            if (rule->count < 1) return -1;
+        } else if (strcasecmp(key, "UNTIL") == 0) {
+            strncpy(rule->until, val, sizeof(rule->until) - 1);
+            rule->until[sizeof(rule->until) - 1] = '\0';
+        } else if (strcasecmp(key, "BYDAY") == 0) {
+            if (parse_by_day(val, rule) != 0) return -1;
+        } else if (strcasecmp(key, "BYMONTHDAY") == 0) {
+            int days[RECURRENCE_MAX_BYMONTHDAY];
+            int count = parse_int_list(val, -31, 31, days, RECURRENCE_MAX_BYMONTHDAY);
+            if (count <= 0) return -1;
+            for (int i = 0; i < count; i++) rule->by_month_day[i] = (int8_t)days[i];
+            rule->by_month_day_count = count;
+        } else if (strcasecmp(key, "BYMONTH") == 0) {
+            int months[12];
+            int count = parse_int_list(val, 1, 12, months, 12);
+            if (count <= 0) return -1;
+            for (int i = 0; i < count; i++) rule->by_month |= (uint16_t)(1u << (months[i] - 1));
+        } else if (strcasecmp(key, "WKST") == 0) {
+            week_starts_monday = (strcasecmp(val, "MO") == 0);
+        } else {
+            return -1; // BYSETPOS, BYWEEKNO, BYYEARDAY, BYHOUR, ... are not supported
+        }
+    }
+
+    if (!have_frequency) return -1;
+
+    // Week numbering only matters for WEEKLY with INTERVAL > 1
+    if (!week_starts_monday && rule->frequency == RECURRENCE_WEEKLY && rule->interval > 1) return -1;
+
+    // Ordinal weekdays only make sense within a month here
+    for (int i = 0; i < rule->by_day_count; i++) {
+        if (rule->by_day[i].ordinal != 0 &&
+            (rule->frequency == RECURRENCE_DAILY || rule->frequency == RECURRENCE_WEEKLY ||
+             (rule->frequency == RECURRENCE_YEARLY && !rule->by_month))) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+// ====================== EVALUATION ======================
+
+static int matches_month_day(const RecurrenceRule *rule, int mday, int month_length) {
+    for (int i = 0; i < rule->by_month_day_count; i++) {
+        int wanted = rule->by_month_day[i];
+        if (wanted < 0) wanted = month_length + wanted + 1;
+        if (wanted == mday) return 1;
+    }
+    return 0;
+}
+
+// BYDAY match within a month (ordinals count from the start or, when negative, the end)
+static int matches_weekday_in_month(const RecurrenceRule *rule, int weekday, int mday, int month_length) {
+    for (int i = 0; i < rule->by_day_count; i++) {
+        const RecurrenceWeekday *entry = &rule->by_day[i];
+        if (entry->weekday != weekday) continue;
+        if (entry->ordinal == 0) return 1;
+        if (entry->ordinal > 0 && (mday - 1) / 7 + 1 == entry->ordinal) return 1;
+        if (entry->ordinal < 0 && (month_length - mday) / 7 + 1 == -entry->ordinal) return 1;
+    }
+    return 0;
+}
+
+// Day selection inside a matching month (MONTHLY / YEARLY)
+static int matches_day_in_month(const RecurrenceRule *rule, int weekday, int mday, int month_length, int first_mday) {
+    if (rule->by_month_day_count > 0 && !matches_month_day(rule, mday, month_length)) return 0;
+    if (rule->by_day_count > 0 && !matches_weekday_in_month(rule, weekday, mday, month_length)) return 0;
+    if (rule->by_month_day_count == 0 && rule->by_day_count == 0) return mday == first_mday;
+    return 1;
+}
+
+int recurrence_occurs_on(const RecurrenceRule *rule, int first_day, int day_number) {
+    if (!rule || day_number < first_day) {
+        return 0;
+    }
+    if (day_number == first_day) {
+        return 1; // DTSTART is always the first instance
+    }
+
+    int year, month, mday;
+    int first_year, first_month, first_mday;
+    recurrence_civil_from_day(day_number, &year, &month, &mday);
+    recurrence_civil_from_day(first_day, &first_year, &first_month, &first_mday);
+    int weekday = weekday_of(day_number);
+    int month_length = days_in_month(year, month);
+
+    if (rule->by_month && !(rule->by_month & (1u << (month - 1)))) {
+        return 0;
+    }
+
+    switch (rule->frequency) {
+        case RECURRENCE_DAILY:
+            if ((day_number - first_day) % rule->interval != 0) return 0;
+            if (rule->by_day_count > 0 && !matches_weekday_in_month(rule, weekday, mday, month_length)) return 0;
+            if (rule->by_month_day_count > 0 && !matches_month_day(rule, mday, month_length)) return 0;
+            return 1;
+
+        case RECURRENCE_WEEKLY: {
+            // Weeks start on Monday (WKST=MO); Monday day numbers are 4 mod 7, so these divisions are exact
+            int week = (day_number - weekday - 4) / 7;
+            int first_week = (first_day - weekday_of(first_day) - 4) / 7;
+            if ((week - first_week) % rule->interval != 0) return 0;
+            if (rule->by_day_count == 0) return weekday == weekday_of(first_day);
+            return matches_weekday_in_month(rule, weekday, mday, month_length);
+        }
+
+        case RECURRENCE_MONTHLY: {
+            int months = (year * 12 + month) - (first_year * 12 + first_month);
+            if (months % rule->interval != 0) return 0;
+            return matches_day_in_month(rule, weekday, mday, month_length, first_mday);
+        }
+
+        case RECURRENCE_YEARLY:
+            if ((year - first_year) % rule->interval != 0) return 0;
+            if (!rule->by_month && month != first_month &&
+                rule->by_month_day_count == 0 && rule->by_day_count == 0) {
+                return 0;
+            }
+            return matches_day_in_month(rule, weekday, mday, month_length, first_mday);
+    }
+
+    return 0;
+}
+
+int recurrence_last_day(const RecurrenceRule *rule, int first_day) {
+    if (!rule || rule->count <= 0) {
+        return RECURRENCE_NO_END;
+    }
+
+    // Daily without filters is plain arithmetic
+    if (rule->frequency == RECURRENCE_DAILY && rule->by_day_count == 0 &&
+        rule->by_month_day_count == 0 && !rule->by_month) {
+        return first_day + (rule->count - 1) * rule->interval;
+    }
+
+    int remaining = rule->count;
+    for (int day = first_day; day < first_day + RECURRENCE_MAX_SPAN_DAYS; day++) {
+        if (recurrence_occurs_on(rule, first_day, day) && --remaining == 0) {
+            return day;
+        }
+    }
+    return first_day + RECURRENCE_MAX_SPAN_DAYS;
+}
@@ -0,0 +1,72 @@
+#ifndef RECURRENCE_H
+#define RECURRENCE_H
+
+#include <stdint.h>
+
+// Limits for BYxxx lists (longer lists make the rule unsupported)
+#define RECURRENCE_MAX_BYDAY 14
+#define RECURRENCE_MAX_BYMONTHDAY 31
+#define RECURRENCE_MAX_UNTIL_LENGTH 32
+
+// Bound for COUNT resolution and open-ended rules (about 100 years)
+#define RECURRENCE_MAX_SPAN_DAYS 36525
+
+// "No last day" marker returned by recurrence_last_day
+#define RECURRENCE_NO_END INT32_MAX
+
+typedef enum {
+    RECURRENCE_DAILY,
+    RECURRENCE_WEEKLY,
+    RECURRENCE_MONTHLY,
+    RECURRENCE_YEARLY
+} RecurrenceFrequency;
+
+// BYDAY entry: weekday (0 = Monday ... 6 = Sunday) with optional ordinal (0 = every, 2 = second, -1 = last)
+typedef struct {
+    int8_t weekday;
+    int8_t ordinal;
+} RecurrenceWeekday;
+
+// Parsed RRULE (subset of RFC 5545 used by common calendar providers)
+typedef struct {
+    RecurrenceFrequency frequency;
+    int interval;                                   // INTERVAL (>= 1)
+    int count;                                      // COUNT (0 = none)
+    char until[RECURRENCE_MAX_UNTIL_LENGTH];        // Raw UNTIL value ("" = none)
+    uint16_t by_month;                              // BYMONTH bitmask (bit 0 = January, 0 = none)
+    RecurrenceWeekday by_day[RECURRENCE_MAX_BYDAY];
+    int by_day_count;
+    int8_t by_month_day[RECURRENCE_MAX_BYMONTHDAY]; // BYMONTHDAY (1..31 or -31..-1)
+    int by_month_day_count;
+} RecurrenceRule;
+
+/**
+ * Parse an RRULE value ("FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,WE")
+ * Supported: FREQ DAILY/WEEKLY/MONTHLY/YEARLY, INTERVAL, COUNT, UNTIL, BYDAY,
+ * BYMONTHDAY, BYMONTH and WKST=MO. Anything else (BYSETPOS, BYWEEKNO, ...) is rejected.
+ * Returns: 0 on success, -1 if the rule is invalid or unsupported
+ */
+int recurrence_parse(const char *value, RecurrenceRule *rule);
+
+/**
+ * Civil day numbers (days since 1970-01-01, proleptic Gregorian calendar)
+ * All rule evaluation is done on local calendar days, so DST never shifts occurrences.
+ */
+int recurrence_day_from_civil(int year, int month, int day);
+void recurrence_civil_from_day(int day_number, int *year, int *month, int *day);
+
+/**
+ * Check whether the series starting on first_day has an occurrence on day_number
+ * Constant time: no iteration over earlier occurrences. COUNT and UNTIL are not
+ * checked here (see recurrence_last_day); first_day itself always occurs.
+ * Returns: 1 if it occurs, 0 otherwise
+ */
+int recurrence_occurs_on(const RecurrenceRule *rule, int first_day, int day_number);
+
+/**
+ * Resolve COUNT into the day of the last occurrence (walks the series once)
+ * Returns: last day number, or RECURRENCE_NO_END if the rule has no COUNT
+ */
+int recurrence_last_day(const RecurrenceRule *rule, int first_day);
+
+#endif // RECURRENCE_H
@@ -0,0 +1,387 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include "scheduler.h"
+#include "logging.h"
+
+#ifndef TFD_TIMER_CANCEL_ON_SET
+#define TFD_TIMER_CANCEL_ON_SET (1 << 1)
+#endif
+
+#define SCHEDULER_MAX_WORKERS 8
+#define SCHEDULER_MAX_NAME_LENGTH 32
+
+typedef struct {
+    char name[SCHEDULER_MAX_NAME_LENGTH];
+    SchedulerJobFn run;
+    SchedulerNextFn next;
+    void *arg;
+    time_t next_run;            // SCHEDULER_NEVER = parked
+    time_t dispatched_due;      // Due time handed to the worker
+    int heap_index;
+    int running;                // Queued or executing on a worker
+    int triggered;              // Set by scheduler_trigger (signal handlers), run as soon as possible
+} SchedulerJob;
+
+struct Scheduler {
+    SchedulerJob jobs[SCHEDULER_MAX_JOBS];
+    int job_count;
+
+    // Min-heap of job ids ordered by next_run (parked jobs sink to the bottom)
+    int heap[SCHEDULER_MAX_JOBS];
+
+    // Jobs waiting for a worker (each job is queued at most once)
+    int queue[SCHEDULER_MAX_JOBS];
+    int queue_head;
+    int queue_count;
+
+    pthread_t workers[SCHEDULER_MAX_WORKERS];
+    int worker_count;
+    int shutdown;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+
+    int timer_fd;               // CLOCK_REALTIME, absolute, cancelled on clock changes
+    int event_fd;               // Wakeups from scheduler_wake_at / scheduler_trigger / scheduler_stop
+    volatile int stopping;
+};
+
+// ====================== HEAP ======================
+
+static inline int64_t job_key(const Scheduler *scheduler, int job_id) {
+    time_t next_run = scheduler->jobs[job_id].next_run;
+    return next_run == SCHEDULER_NEVER ? INT64_MAX : (int64_t)next_run;
+}
+
+static void heap_swap(Scheduler *scheduler, int a, int b) {
+    int job_a = scheduler->heap[a];
+    int job_b = scheduler->heap[b];
+    scheduler->heap[a] = job_b;
+    scheduler->heap[b] = job_a;
+    scheduler->jobs[job_b].heap_index = a;
+    scheduler->jobs[job_a].heap_index = b;
+}
+
+// Restore heap order after the key of the job at index changed (either direction)
+static void heap_fix(Scheduler *scheduler, int index) {
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (job_key(scheduler, scheduler->heap[parent]) <= job_key(scheduler, scheduler->heap[index])) break;
+        heap_swap(scheduler, parent, index);
+        index = parent;
+    }
+
+    for (;;) {
+        int smallest = index;
+        int left = 2 * index + 1;
+        int right = left + 1;
+        if (left < scheduler->job_count &&
+            job_key(scheduler, scheduler->heap[left]) < job_key(scheduler, scheduler->heap[smallest])) {
+            smallest = left;
+        }
+        if (right < scheduler->job_count &&
+            job_key(scheduler, scheduler->heap[right]) < job_key(scheduler, scheduler->heap[smallest])) {
+            smallest = right;
+        }
+        if (smallest == index) break;
+        heap_swap(scheduler, index, smallest);
+        index = smallest;
+    }
+}
+
+// ====================== WORKER POOL ======================
+
+static void* scheduler_worker(void *arg) {
+    Scheduler *scheduler = (Scheduler*)arg;
+
+    pthread_mutex_lock(&scheduler->lock);
+    for (;;) {
+        while (!scheduler->shutdown && scheduler->queue_count == 0) {
+            pthread_cond_wait(&scheduler->work_ready, &scheduler->lock);
+        }
+        if (scheduler->shutdown) {
+            break;
+        }
+
+        int job_id = scheduler->queue[scheduler->queue_head];
+        scheduler->queue_head = (scheduler->queue_head + 1) % SCHEDULER_MAX_JOBS;
+        scheduler->queue_count--;
+        SchedulerJob *job = &scheduler->jobs[job_id];
+
+        pthread_mutex_unlock(&scheduler->lock);
+        job->run(job->dispatched_due, job->arg);
+        pthread_mutex_lock(&scheduler->lock);
+
+        job->running = 0;
+    }
+    pthread_mutex_unlock(&scheduler->lock);
+    return NULL;
+}
+
+// Hand every due job to the pool and plan its next run (lock held)
+static void dispatch_due_jobs(Scheduler *scheduler, time_t now) {
+    while (scheduler->job_count > 0 && job_key(scheduler, scheduler->heap[0]) <= (int64_t)now) {
+        int job_id = scheduler->heap[0];
+        SchedulerJob *job = &scheduler->jobs[job_id];
+
+        if (job->running) {
+            LOG_DEBUG("⏱️  Job '%s' still running, skipping this run", job->name);
+        } else {
+            job->running = 1;
+            job->dispatched_due = job->next_run;
+            int tail = (scheduler->queue_head + scheduler->queue_count) % SCHEDULER_MAX_JOBS;
+            scheduler->queue[tail] = job_id;
+            scheduler->queue_count++;
+            pthread_cond_signal(&scheduler->work_ready);
+        }
+
+        // A next function answering "now" again would spin this loop
+        job->next_run = job->next(now, job->arg);
+        if (job->next_run != SCHEDULER_NEVER && job->next_run <= now) {
+            job->next_run = now + 1;
+        }
+        heap_fix(scheduler, 0);
+    }
+}
+
+// Clock was set (NTP sync at boot, manual change): keep whichever planned run comes first (lock held)
+static void replan_after_clock_change(Scheduler *scheduler, time_t now) {
+    LOG_DEBUG("⏱️  Wall clock changed, re-planning %d jobs", scheduler->job_count);
+    for (int i = 0; i < scheduler->job_count; i++) {
+        SchedulerJob *job = &scheduler->jobs[i];
+        time_t next_run = job->next(now, job->arg);
+        if (job->next_run == SCHEDULER_NEVER || (next_run != SCHEDULER_NEVER && next_run < job->next_run)) {
+            job->next_run = next_run;
+            heap_fix(scheduler, job->heap_index);
+        }
+    }
+}
+
+// Pull triggered jobs to now (lock held)
+static void take_triggered_jobs(Scheduler *scheduler, time_t now) {
+    for (int i = 0; i < scheduler->job_count; i++) {
+        SchedulerJob *job = &scheduler->jobs[i];
+        if (__atomic_exchange_n(&job->triggered, 0, __ATOMIC_ACQ_REL)) {
+            job->next_run = now;
+            heap_fix(scheduler, job->heap_index);
+        }
+    }
+}
+
+// Arm the timer for the earliest job, or disarm it when all are parked (lock held)
+static int arm_timer(Scheduler *scheduler) {
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    int flags = 0;
+
+    if (scheduler->job_count > 0 && scheduler->jobs[scheduler->heap[0]].next_run != SCHEDULER_NEVER) {
+        spec.it_value.tv_sec = scheduler->jobs[scheduler->heap[0]].next_run;
+        flags = TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET;
+    }
+
+    return timerfd_settime(scheduler->timer_fd, flags, &spec, NULL);
+}
+
+// Let the dispatcher re-arm its timer
+static void wake_dispatcher(Scheduler *scheduler) {
+    uint64_t one = 1;
+    if (write(scheduler->event_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+        LOG_ERROR("❌ Failed to wake scheduler: %s", strerror(errno));
+    }
+}
+
+// ====================== PUBLIC API ======================
+
+Scheduler* scheduler_create(int workers) {
+    if (workers < 1) workers = 1;
+    if (workers > SCHEDULER_MAX_WORKERS) workers = SCHEDULER_MAX_WORKERS;
+
+    Scheduler *scheduler = calloc(1, sizeof(Scheduler));
+    if (!scheduler) {
+        return NULL;
+    }
+
+    scheduler->timer_fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    scheduler->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (scheduler->timer_fd < 0 || scheduler->event_fd < 0) {
+        LOG_ERROR("❌ Failed to create scheduler descriptors: %s", strerror(errno));
+        if (scheduler->timer_fd >= 0) close(scheduler->timer_fd);
+        if (scheduler->event_fd >= 0) close(scheduler->event_fd);
+        free(scheduler);
+        return NULL;
+    }
+
+    pthread_mutex_init(&scheduler->lock, NULL);
+    pthread_cond_init(&scheduler->work_ready, NULL);
+
+    for (int i = 0; i < workers; i++) {
+        if (pthread_create(&scheduler->workers[i], NULL, scheduler_worker, scheduler) != 0) {
+            LOG_ERROR("❌ Failed to create scheduler worker %d", i);
+            scheduler_free(scheduler);
+            return NULL;
+        }
+        scheduler->worker_count++;
+    }
+
+    LOG_DEBUG("⏱️  Scheduler created (%d workers)", workers);
+    return scheduler;
+}
+
+void scheduler_free(Scheduler *scheduler) {
+    if (!scheduler) return;
+
+    // Queued jobs are dropped; jobs already executing finish first
+    pthread_mutex_lock(&scheduler->lock);
+    scheduler->shutdown = 1;
+    scheduler->queue_count = 0;
+    pthread_cond_broadcast(&scheduler->work_ready);
+    pthread_mutex_unlock(&scheduler->lock);
+
+    for (int i = 0; i < scheduler->worker_count; i++) {
+        pthread_join(scheduler->workers[i], NULL);
+    }
+
+    close(scheduler->timer_fd);
+    close(scheduler->event_fd);
+    pthread_cond_destroy(&scheduler->work_ready);
+    pthread_mutex_destroy(&scheduler->lock);
+    free(scheduler);
+}
+
+int scheduler_add(Scheduler *scheduler, const char *name, SchedulerJobFn run, SchedulerNextFn next, void *arg) {
+    if (!scheduler || !name || !run || !next) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&scheduler->lock);
+    if (scheduler->job_count >= SCHEDULER_MAX_JOBS) {
+        pthread_mutex_unlock(&scheduler->lock);
+        LOG_ERROR("❌ Too many scheduler jobs (max %d)", SCHEDULER_MAX_JOBS);
+        return -1;
+    }
+
+    int job_id = scheduler->job_count++;
+    SchedulerJob *job = &scheduler->jobs[job_id];
+    memset(job, 0, sizeof(SchedulerJob));
+    strncpy(job->name, name, sizeof(job->name) - 1);
+    job->run = run;
+    job->next = next;
+    job->arg = arg;
+    job->next_run = next(time(NULL), arg);
+    job->heap_index = job_id;
+    scheduler->heap[job_id] = job_id;
+    heap_fix(scheduler, job_id);
+    pthread_mutex_unlock(&scheduler->lock);
+
+    return job_id;
+}
+
+void scheduler_wake_at(Scheduler *scheduler, int job_id, time_t when) {
+    if (!scheduler || job_id < 0 || when == SCHEDULER_NEVER) return;
+
+    pthread_mutex_lock(&scheduler->lock);
+    if (job_id < scheduler->job_count) {
+        SchedulerJob *job = &scheduler->jobs[job_id];
+        if (job->next_run == SCHEDULER_NEVER || when < job->next_run) {
+            job->next_run = when;
+            heap_fix(scheduler, job->heap_index);
+        }
+    }
+    pthread_mutex_unlock(&scheduler->lock);
+
+    wake_dispatcher(scheduler);
+}
+
+void scheduler_reschedule(Scheduler *scheduler, int job_id, time_t when) {
+    if (!scheduler || job_id < 0) return;
+
+    pthread_mutex_lock(&scheduler->lock);
+    if (job_id < scheduler->job_count) {
+        SchedulerJob *job = &scheduler->jobs[job_id];
+        job->next_run = when;
+        heap_fix(scheduler, job->heap_index);
+    }
+    pthread_mutex_unlock(&scheduler->lock);
+
+    wake_dispatcher(scheduler);
+}
+
+time_t scheduler_next_run(Scheduler *scheduler, int job_id) {
+    time_t next_run = SCHEDULER_NEVER;
+    if (!scheduler || job_id < 0) return next_run;
+
+    pthread_mutex_lock(&scheduler->lock);
+    if (job_id < scheduler->job_count) {
+        next_run = scheduler->jobs[job_id].next_run;
+    }
+    pthread_mutex_unlock(&scheduler->lock);
+    return next_run;
+}
+
+void scheduler_trigger(Scheduler *scheduler, int job_id) {
+    if (!scheduler || job_id < 0 || job_id >= scheduler->job_count) return;
+
+    __atomic_store_n(&scheduler->jobs[job_id].triggered, 1, __ATOMIC_RELEASE);
+    uint64_t one = 1;
+    (void)!write(scheduler->event_fd, &one, sizeof(one));
+}
+
+int scheduler_run(Scheduler *scheduler) {
+    if (!scheduler) {
+        return -1;
+    }
+
+    struct pollfd fds[2] = {
+        { .fd = scheduler->timer_fd, .events = POLLIN },
+        { .fd = scheduler->event_fd, .events = POLLIN }
+    };
+
+    while (!scheduler->stopping) {
+        pthread_mutex_lock(&scheduler->lock);
+        time_t now = time(NULL);
+        take_triggered_jobs(scheduler, now);
+        dispatch_due_jobs(scheduler, now);
+        int armed = arm_timer(scheduler);
+        pthread_mutex_unlock(&scheduler->lock);
+
+        if (armed != 0) {
+            LOG_ERROR("❌ Failed to arm scheduler timer: %s", strerror(errno));
+            return -1;
+        }
+
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            LOG_ERROR("❌ Scheduler poll failed: %s", strerror(errno));
+            return -1;
+        }
+
+        uint64_t count;
+        if (fds[1].revents & POLLIN) {
+            (void)!read(scheduler->event_fd, &count, sizeof(count));
+        }
+        if ((fds[0].revents & POLLIN) && read(scheduler->timer_fd, &count, sizeof(count)) < 0 && errno == ECANCELED) {
+            pthread_mutex_lock(&scheduler->lock);
+            replan_after_clock_change(scheduler, time(NULL));
+            pthread_mutex_unlock(&scheduler->lock);
+        }
+    }
+
+    return 0;
+}
+
+void scheduler_stop(Scheduler *scheduler) {
+    if (!scheduler) return;
+
+    scheduler->stopping = 1;
+    uint64_t one = 1;
+    (void)!write(scheduler->event_fd, &one, sizeof(one));
+}
@@ -0,0 +1,78 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <time.h>
+
+// Constants
+#define SCHEDULER_MAX_JOBS 16
+#define SCHEDULER_DEFAULT_WORKERS 3    // Clock ticks stay on time while two fetches are in flight
+#define SCHEDULER_NEVER ((time_t)0)    // "No run planned" (same convention as the retry timers)
+
+typedef struct Scheduler Scheduler;
+
+/**
+ * Job body, run on a worker thread with the wall-clock time it was due
+ */
+typedef void (*SchedulerJobFn)(time_t due, void *arg);
+
+/**
+ * Next wall-clock time the job should run, strictly after now
+ * Returns: absolute time, or SCHEDULER_NEVER to park the job until scheduler_wake_at
+ */
+typedef time_t (*SchedulerNextFn)(time_t now, void *arg);
+
+/**
+ * Create a scheduler with its worker pool (timerfd + eventfd, no polling)
+ * Returns: scheduler, or NULL on failure
+ */
+Scheduler* scheduler_create(int workers);
+
+/**
+ * Stop dispatching, wait for running jobs and release everything
+ */
+void scheduler_free(Scheduler *scheduler);
+
+/**
+ * Register a job; next is evaluated now for the first run and when it is dispatched
+ * Must be called before scheduler_run.
+ * Returns: job id (>= 0), or -1 on failure
+ */
+int scheduler_add(Scheduler *scheduler, const char *name, SchedulerJobFn run, SchedulerNextFn next, void *arg);
+
+/**
+ * Make a job run no later than when (retries, batched display updates)
+ * Thread-safe; a NULL scheduler is ignored so callers work without one.
+ */
+void scheduler_wake_at(Scheduler *scheduler, int job_id, time_t when);
+
+/**
+ * Set a job's next run to when, earlier or later (SCHEDULER_NEVER parks it)
+ * For jobs that plan their own next run: call it from the job body, after the plan
+ * next made at dispatch. Thread-safe; a NULL scheduler is ignored.
+ */
+void scheduler_reschedule(Scheduler *scheduler, int job_id, time_t when);
+
+/**
+ * Planned run of a job (diagnostics and tests)
+ * Returns: absolute time, or SCHEDULER_NEVER if parked or unknown
+ */
+time_t scheduler_next_run(Scheduler *scheduler, int job_id);
+
+/**
+ * Run a job as soon as possible (async-signal-safe: no lock, one eventfd write)
+ */
+void scheduler_trigger(Scheduler *scheduler, int job_id);
+
+/**
+ * Dispatch due jobs until scheduler_stop (blocks the calling thread)
+ * Sleeps in poll() between deadlines; wall-clock jumps re-plan every job.
+ * Returns: 0 on clean stop, -1 on failure
+ */
+int scheduler_run(Scheduler *scheduler);
+
+/**
+ * Ask scheduler_run to return (async-signal-safe)
+ */
+void scheduler_stop(Scheduler *scheduler);
+
+#endif // SCHEDULER_H
@@ -0,0 +1,193 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "snapshot.h"
+#include "logging.h"
+#include "buffer_pool.h"
+
+// Block slots, in SnapshotPart bit order
+typedef enum {
+    SNAPSHOT_WEATHER,
+    SNAPSHOT_MENU,
+    SNAPSHOT_CALENDAR,
+    SNAPSHOT_SOURCE_COUNT
+} SnapshotSource;
+
+// Data of one source, shared by every snapshot published while it is current
+typedef struct {
+    int refs;
+    SnapshotSource source;
+    union {
+        WeatherData weather;
+        MenuData menu;
+        CalendarData calendar;
+    } data;
+} SnapshotBlock;
+
+typedef struct {
+    DashboardSnapshot view;     // First member: the public pointer is the stored snapshot
+    int refs;
+    SnapshotBlock *blocks[SNAPSHOT_SOURCE_COUNT];
+} StoredSnapshot;
+
+// Current snapshot; the lock only covers pointer swaps and reference counts
+static StoredSnapshot *g_current = NULL;
+static uint64_t g_generation = 0;
+static pthread_mutex_t g_snapshot_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Recycled nodes: a publication reuses the blocks and snapshots released by earlier ones
+#define SNAPSHOT_POOL_DEPTH 4
+static BufferPool g_block_pool = BUFFER_POOL_INITIALIZER("snapshot_blocks");
+static BufferPool g_snapshot_pool = BUFFER_POOL_INITIALIZER("snapshots");
+
+static void* node_acquire(BufferPool *pool, size_t size) {
+    size_t capacity;
+    void *node = buffer_pool_acquire(pool, size, &capacity);
+    if (node) memset(node, 0, size);
+    return node;
+}
+
+// ====================== REFERENCE COUNTING ======================
+
+static void block_release(SnapshotBlock *block) {
+    if (!block || --block->refs > 0) return;
+
+    if (block->source == SNAPSHOT_CALENDAR) {
+        calendar_data_free(&block->data.calendar);
+    }
+    buffer_pool_release(&g_block_pool, block, sizeof(SnapshotBlock));
+}
+
+// Drop one reference (g_snapshot_lock held)
+static void stored_release(StoredSnapshot *snapshot) {
+    if (!snapshot || --snapshot->refs > 0) return;
+
+    for (int i = 0; i < SNAPSHOT_SOURCE_COUNT; i++) {
+        block_release(snapshot->blocks[i]);
+    }
+    buffer_pool_release(&g_snapshot_pool, snapshot, sizeof(StoredSnapshot));
+}
+
+/**
+ * Swap in a snapshot where each source in parts is replaced by blocks[source] (NULL = unavailable)
+ * Returns: new generation, or 0 on failure
+ */
+static uint64_t publish_blocks(unsigned int parts, SnapshotBlock *blocks[SNAPSHOT_SOURCE_COUNT]) {
+    StoredSnapshot *next = node_acquire(&g_snapshot_pool, sizeof(StoredSnapshot));
+    if (!next) {
+        for (int i = 0; i < SNAPSHOT_SOURCE_COUNT; i++) {
+            block_release(blocks[i]);
+        }
+        LOG_ERROR("❌ Failed to allocate dashboard snapshot");
+        return 0;
+    }
+
+    pthread_mutex_lock(&g_snapshot_lock);
+    for (int i = 0; i < SNAPSHOT_SOURCE_COUNT; i++) {
+        if (parts & (1u << i)) {
+            next->blocks[i] = blocks[i];
+        } else if (g_current && g_current->blocks[i]) {
+            next->blocks[i] = g_current->blocks[i];
+            next->blocks[i]->refs++;
+        }
+    }
+
+    next->refs = 1;
+    next->view.generation = ++g_generation;
+    next->view.weather = next->blocks[SNAPSHOT_WEATHER] ? &next->blocks[SNAPSHOT_WEATHER]->data.weather : NULL;
+    next->view.menu = next->blocks[SNAPSHOT_MENU] ? &next->blocks[SNAPSHOT_MENU]->data.menu : NULL;
+    next->view.calendar = next->blocks[SNAPSHOT_CALENDAR] ? &next->blocks[SNAPSHOT_CALENDAR]->data.calendar : NULL;
+
+    StoredSnapshot *previous = g_current;
+    g_current = next;
+    stored_release(previous);
+    uint64_t generation = next->view.generation;
+    pthread_mutex_unlock(&g_snapshot_lock);
+
+    return generation;
+}
+
+static SnapshotBlock* block_create(SnapshotSource source) {
+    SnapshotBlock *block = node_acquire(&g_block_pool, sizeof(SnapshotBlock));
+    if (block) {
+        block->refs = 1;
+        block->source = source;
+    }
+    return block;
+}
+
+// ====================== PUBLIC API ======================
+
+int snapshot_init(void) {
+    if (buffer_pool_prefill(&g_snapshot_pool, SNAPSHOT_POOL_DEPTH, sizeof(StoredSnapshot)) != 0 ||
+        buffer_pool_prefill(&g_block_pool, BUFFER_POOL_SLOTS, sizeof(SnapshotBlock)) != 0) {
+        return -1;
+    }
+
+    // Generation 1: every source unavailable until its first fetch
+    SnapshotBlock *blocks[SNAPSHOT_SOURCE_COUNT] = { NULL };
+    return publish_blocks(0, blocks) ? 0 : -1;
+}
+
+void snapshot_cleanup(void) {
+    pthread_mutex_lock(&g_snapshot_lock);
+    stored_release(g_current);
+    g_current = NULL;
+    pthread_mutex_unlock(&g_snapshot_lock);
+
+    buffer_pool_drain(&g_snapshot_pool);
+    buffer_pool_drain(&g_block_pool);
+}
+
+uint64_t snapshot_publish_weather(const WeatherData *data) {
+    return snapshot_publish_parts(SNAPSHOT_PART_WEATHER, data, NULL, NULL);
+}
+
+uint64_t snapshot_publish_menu(const MenuData *data) {
+    return snapshot_publish_parts(SNAPSHOT_PART_MENU, NULL, data, NULL);
+}
+
+uint64_t snapshot_publish_calendar(CalendarData *data) {
+    return snapshot_publish_parts(SNAPSHOT_PART_CALENDAR, NULL, NULL, data);
+}
+
+uint64_t snapshot_publish_parts(unsigned int parts, const WeatherData *weather, const MenuData *menu,
+                                CalendarData *calendar) {
+    SnapshotBlock *blocks[SNAPSHOT_SOURCE_COUNT] = { NULL };
+    const void *data[SNAPSHOT_SOURCE_COUNT] = { weather, menu, calendar };
+
+    for (int i = 0; i < SNAPSHOT_SOURCE_COUNT; i++) {
+        if (!(parts & (1u << i)) || !data[i]) continue;
+        if (!(blocks[i] = block_create((SnapshotSource)i))) {
+            for (int j = 0; j < i; j++) {
+                block_release(blocks[j]);
+            }
+            if ((parts & SNAPSHOT_PART_CALENDAR) && calendar) calendar_data_free(calendar);
+            return 0;
+        }
+    }
+
+    if (blocks[SNAPSHOT_WEATHER]) blocks[SNAPSHOT_WEATHER]->data.weather = *weather;
+    if (blocks[SNAPSHOT_MENU]) blocks[SNAPSHOT_MENU]->data.menu = *menu;
+    if (blocks[SNAPSHOT_CALENDAR]) {
+        blocks[SNAPSHOT_CALENDAR]->data.calendar = *calendar;
+        memset(calendar, 0, sizeof(CalendarData));
+    }
+    return publish_blocks(parts, blocks);
+}
+
+const DashboardSnapshot* snapshot_acquire(void) {
+    pthread_mutex_lock(&g_snapshot_lock);
+    StoredSnapshot *snapshot = g_current;
+    if (snapshot) snapshot->refs++;
+    pthread_mutex_unlock(&g_snapshot_lock);
+    return snapshot ? &snapshot->view : NULL;
+}
+
+void snapshot_release(const DashboardSnapshot *snapshot) {
+    if (!snapshot) return;
+
+    pthread_mutex_lock(&g_snapshot_lock);
+    stored_release((StoredSnapshot*)snapshot);
+    pthread_mutex_unlock(&g_snapshot_lock);
+}
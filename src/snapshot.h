@@ -0,0 +1,54 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdint.h>
+#include "weather.h"
+#include "menu.h"
+#include "calendar.h"
+
+// Immutable view of the dashboard data; never modified once published
+typedef struct {
+    uint64_t generation;            // Incremented by every publication
+    const WeatherData *weather;     // NULL when unavailable
+    const MenuData *menu;           // NULL when unavailable
+    const CalendarData *calendar;   // NULL when unavailable
+} DashboardSnapshot;
+
+// Process-lifetime store: call snapshot_init() before publishing, snapshot_cleanup() at exit
+int snapshot_init(void);
+void snapshot_cleanup(void);
+
+// Sources replaced by snapshot_publish_parts (bitmask)
+typedef enum {
+    SNAPSHOT_PART_WEATHER = 1 << 0,
+    SNAPSHOT_PART_MENU = 1 << 1,
+    SNAPSHOT_PART_CALENDAR = 1 << 2
+} SnapshotPart;
+
+/**
+ * Publish new data for one source (NULL = unavailable); other sources carry over
+ * Fetch into a private buffer first: publication is a copy and a pointer swap.
+ * snapshot_publish_calendar takes ownership of the event arrays and title arena (data is cleared).
+ * Returns: new generation, or 0 on failure (previous snapshot kept)
+ */
+uint64_t snapshot_publish_weather(const WeatherData *data);
+uint64_t snapshot_publish_menu(const MenuData *data);
+uint64_t snapshot_publish_calendar(CalendarData *data);
+
+/**
+ * Replace every source in parts at once (NULL data = unavailable); other sources carry over
+ * All blocks are allocated before the swap, so readers see either none or all of the parts.
+ * Takes ownership of calendar like snapshot_publish_calendar, also on failure.
+ * Returns: new generation, or 0 on failure (previous snapshot kept)
+ */
+uint64_t snapshot_publish_parts(unsigned int parts, const WeatherData *weather, const MenuData *menu,
+                                CalendarData *calendar);
+
+/**
+ * Reference the current snapshot (stays valid and unchanged until released)
+ * Returns: snapshot (never NULL after snapshot_init)
+ */
+const DashboardSnapshot* snapshot_acquire(void);
+void snapshot_release(const DashboardSnapshot *snapshot);
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,812 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "snapshot_feed.h"
+#include "buffer_pool.h"
+#include "poll_policy.h"
+#include "metrics.h"
+#include "logging.h"
+
+// Dead peers (power loss, no FIN) are detected by TCP keepalive instead of application heartbeats
+#define FEED_KEEPALIVE_IDLE_SEC 60
+#define FEED_KEEPALIVE_INTERVAL_SEC 10
+#define FEED_KEEPALIVE_COUNT 3
+
+// Subscriber reconnection: jittered exponential backoff
+#define FEED_RECONNECT_BASE 10
+#define FEED_RECONNECT_MAX (5 * 60)
+
+// Message layout: header, then for each source in changed and available, in this order: the weather
+// and its forecasts, the menu, today's then tomorrow's events followed by their titles (NUL-terminated)
+// Fixed-width fields only, so dashboards built for different architectures can share one feed
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;           // sizeof(FeedHeader): catches layout changes between builds
+    uint32_t available;             // FEED_* sources the producer has
+    uint32_t changed;               // FEED_* sources republished by this message (absent = now unavailable)
+    uint64_t generation;            // Producer snapshot generation
+    uint32_t body_size;
+    uint32_t forecast_count;
+    uint32_t event_count[2];        // Today, tomorrow
+    uint32_t titles_size;
+    uint32_t reserved;
+} FeedHeader;
+
+typedef struct {
+    int64_t sunrise;
+    int64_t sunset;
+    int64_t last_updated;
+    int16_t temperature;
+    uint8_t weather_code;
+    uint8_t is_day;
+    uint32_t reserved;
+} FeedWeather;
+
+typedef struct {
+    int64_t datetime;
+    int16_t temperature;
+    uint8_t weather_code;
+    uint8_t is_day;
+    uint32_t reserved;
+} FeedForecast;
+
+typedef struct {
+    int64_t start;
+    int64_t end;
+    uint32_t title_offset;          // Into the titles section
+    int32_t event_type;
+} FeedEvent;
+
+// Producer: one thread accepts subscribers and fans each queued message out to all of them
+typedef struct {
+    int running;
+    pthread_t thread;
+    int listen_fd;
+    int wake_fd;                    // eventfd: message queued or stop requested
+    int subscribers[FEED_MAX_SUBSCRIBERS];
+    int subscriber_count;           // Server thread only
+    unsigned int pending_changed;   // Guarded by lock, like the fields below
+    const DashboardSnapshot *pending;
+    int stop;
+    pthread_mutex_t lock;
+    uint8_t *buffer;                // Encoded message, reused for every send
+    size_t capacity;
+} FeedServer;
+
+// Consumer: one thread keeps a connection to the producer and publishes what it receives
+typedef struct {
+    int running;
+    pthread_t thread;
+    int stop_fd;                    // eventfd, readable once a stop is requested
+    char address[256];
+    SnapshotFeedHandler handler;
+    void *arg;
+    RetryBackoff backoff;
+    uint8_t *buffer;                // Received message body
+    size_t capacity;
+} FeedClient;
+
+static FeedServer g_server = { .listen_fd = -1, .wake_fd = -1, .lock = PTHREAD_MUTEX_INITIALIZER };
+static FeedClient g_client = { .stop_fd = -1 };
+
+// ====================== SOCKETS ======================
+
+/**
+ * Resolve "host:port", "[v6]:port" or "host" (default port); an empty or "*" host means any
+ * Returns: 0 on success (free *result with freeaddrinfo), -1 on failure
+ */
+static int resolve_address(const char *address, int passive, struct addrinfo **result) {
+    char host[256];
+    const char *port = FEED_DEFAULT_PORT;
+
+    if (!address || snprintf(host, sizeof(host), "%s", address) >= (int)sizeof(host)) {
+        return -1;
+    }
+
+    char *name = host;
+    char *separator = NULL;
+    if (host[0] == '[') {
+        char *end = strchr(host, ']');
+        if (!end) return -1;
+        *end = '\0';
+        name = host + 1;
+        separator = (end[1] == ':') ? end + 1 : NULL;
+    } else {
+        separator = strrchr(host, ':');
+    }
+    if (separator) {
+        *separator = '\0';
+        port = separator + 1;
+    }
+    if (strcmp(name, "*") == 0) {
+        name[0] = '\0';
+    }
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_NUMERICSERV | (passive ? AI_PASSIVE : 0);
+
+    int status = getaddrinfo(name[0] ? name : NULL, port, &hints, result);
+    if (status != 0) {
+        LOG_ERROR("❌ Cannot resolve feed address %s: %s", address, gai_strerror(status));
+        return -1;
+    }
+    return 0;
+}
+
+// Keepalive and a send timeout (which also bounds connect) on a feed connection
+static void configure_socket(int fd) {
+    int enabled = 1;
+    int idle = FEED_KEEPALIVE_IDLE_SEC;
+    int interval = FEED_KEEPALIVE_INTERVAL_SEC;
+    int count = FEED_KEEPALIVE_COUNT;
+    struct timeval timeout = { FEED_SEND_TIMEOUT_SEC, 0 };
+
+    setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &enabled, sizeof(enabled));
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &idle, sizeof(idle));
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL, &interval, sizeof(interval));
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &count, sizeof(count));
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+// Returns: connected socket, or -1 on failure
+static int connect_to(const char *address) {
+    struct addrinfo *addresses;
+    if (resolve_address(address, 0, &addresses) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *candidate = addresses; candidate; candidate = candidate->ai_next) {
+        fd = socket(candidate->ai_family, candidate->ai_socktype | SOCK_CLOEXEC, candidate->ai_protocol);
+        if (fd < 0) continue;
+        configure_socket(fd);
+        if (connect(fd, candidate->ai_addr, candidate->ai_addrlen) == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(addresses);
+    return fd;
+}
+
+// Returns: 0 once everything is sent, -1 on error or send timeout
+static int send_all(int fd, const void *data, size_t length) {
+    const uint8_t *cursor = (const uint8_t *)data;
+    while (length > 0) {
+        ssize_t sent = send(fd, cursor, length, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent <= 0) return -1;
+        cursor += sent;
+        length -= (size_t)sent;
+    }
+    return 0;
+}
+
+/**
+ * Read exactly length bytes, giving up when stop_fd becomes readable (-1 = none)
+ * timeout_ms bounds each wait for data (-1 = none)
+ * Returns: 0 on success, -1 on error, end of stream, timeout or stop
+ */
+static int recv_all(int fd, int stop_fd, int timeout_ms, void *data, size_t length) {
+    uint8_t *cursor = (uint8_t *)data;
+    while (length > 0) {
+        struct pollfd fds[2] = { { fd, POLLIN, 0 }, { stop_fd, POLLIN, 0 } };
+        int ready = poll(fds, 2, timeout_ms);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready <= 0 || (fds[1].revents & POLLIN)) return -1;
+
+        ssize_t received = recv(fd, cursor, length, 0);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return -1;
+        cursor += received;
+        length -= (size_t)received;
+    }
+    return 0;
+}
+
+// ====================== ENCODING ======================
+
+static uint8_t* put(uint8_t *cursor, const void *data, size_t length) {
+    memcpy(cursor, data, length);
+    return cursor + length;
+}
+
+/**
+ * Encode the changed sources of snapshot into *buffer (grown as needed)
+ * Returns: message size, or 0 on failure
+ */
+static size_t encode_message(unsigned int changed, const DashboardSnapshot *snapshot,
+                             uint8_t **buffer, size_t *capacity) {
+    const WeatherData *weather = snapshot->weather;
+    const CalendarData *calendar = snapshot->calendar;
+    const DayEvents *days[2] = { NULL, NULL };
+
+    FeedHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = FEED_MAGIC;
+    header.version = FEED_VERSION;
+    header.header_size = sizeof(FeedHeader);
+    header.generation = snapshot->generation;
+    header.available = (weather ? FEED_WEATHER : 0) | (snapshot->menu ? FEED_MENU : 0) |
+                       (calendar ? FEED_CALENDAR : 0);
+    header.changed = changed & FEED_ALL;
+
+    unsigned int carried = header.changed & header.available;
+    size_t body_size = 0;
+    if (carried & FEED_WEATHER) {
+        header.forecast_count = (uint32_t)(weather->forecast_count < MAX_FORECAST_HOURS
+                                           ? weather->forecast_count : MAX_FORECAST_HOURS);
+        body_size += sizeof(FeedWeather) + header.forecast_count * sizeof(FeedForecast);
+    }
+    if (carried & FEED_MENU) {
+        body_size += sizeof(MenuData);
+    }
+    if (carried & FEED_CALENDAR) {
+        days[0] = &calendar->today;
+        days[1] = &calendar->tomorrow;
+        for (int d = 0; d < 2; d++) {
+            int count = days[d]->count < MAX_EVENTS_PER_DAY ? days[d]->count : MAX_EVENTS_PER_DAY;
+            header.event_count[d] = (uint32_t)count;
+            for (int i = 0; i < count; i++) {
+                const char *title = days[d]->events[i].title;
+                header.titles_size += (uint32_t)strlen(title ? title : "") + 1;
+            }
+        }
+        body_size += (header.event_count[0] + header.event_count[1]) * sizeof(FeedEvent) + header.titles_size;
+    }
+
+    size_t size = sizeof(FeedHeader) + body_size;
+    if (size > FEED_MAX_MESSAGE_SIZE) {
+        LOG_ERROR("❌ Snapshot too large for the feed (%zu bytes)", size);
+        return 0;
+    }
+    uint8_t *grown = buffer_pool_reserve(*buffer, capacity, size);
+    if (!grown) {
+        LOG_ERROR("❌ Failed to allocate feed message (%zu bytes)", size);
+        return 0;
+    }
+    *buffer = grown;
+    header.body_size = (uint32_t)body_size;
+
+    uint8_t *cursor = put(grown, &header, sizeof(header));
+    if (carried & FEED_WEATHER) {
+        FeedWeather current;
+        memset(&current, 0, sizeof(current));
+        current.sunrise = (int64_t)weather->sunrise;
+        current.sunset = (int64_t)weather->sunset;
+        current.last_updated = (int64_t)weather->last_updated;
+        current.temperature = weather->current.temperature;
+        current.weather_code = weather->current.weather_code;
+        current.is_day = weather->current.is_day;
+        cursor = put(cursor, &current, sizeof(current));
+
+        for (uint32_t i = 0; i < header.forecast_count; i++) {
+            FeedForecast forecast;
+            memset(&forecast, 0, sizeof(forecast));
+            forecast.datetime = (int64_t)weather->forecasts[i].datetime;
+            forecast.temperature = weather->forecasts[i].temperature;
+            forecast.weather_code = weather->forecasts[i].weather_code;
+            forecast.is_day = weather->forecasts[i].is_day;
+            cursor = put(cursor, &forecast, sizeof(forecast));
+        }
+    }
+    if (carried & FEED_MENU) {
+        cursor = put(cursor, snapshot->menu, sizeof(MenuData));
+    }
+    if (carried & FEED_CALENDAR) {
+        uint32_t title_offset = 0;
+        for (int d = 0; d < 2; d++) {
+            for (uint32_t i = 0; i < header.event_count[d]; i++) {
+                const CalendarEvent *event = &days[d]->events[i];
+                FeedEvent stored;
+                stored.start = (int64_t)event->start;
+                stored.end = (int64_t)event->end;
+                stored.title_offset = title_offset;
+                stored.event_type = (int32_t)event->event_type;
+                cursor = put(cursor, &stored, sizeof(stored));
+                title_offset += (uint32_t)strlen(event->title ? event->title : "") + 1;
+            }
+        }
+        for (int d = 0; d < 2; d++) {
+            for (uint32_t i = 0; i < header.event_count[d]; i++) {
+                const char *title = days[d]->events[i].title ? days[d]->events[i].title : "";
+                cursor = put(cursor, title, strlen(title) + 1);
+            }
+        }
+    }
+    return size;
+}
+
+// ====================== DECODING ======================
+
+/**
+ * Read one message into *buffer (header first, then the body it announces)
+ * Returns: 0 on success, -1 on error, invalid header, timeout or stop
+ */
+static int receive_message(int fd, int stop_fd, int timeout_ms, FeedHeader *header,
+                           uint8_t **buffer, size_t *capacity) {
+    if (recv_all(fd, stop_fd, timeout_ms, header, sizeof(*header)) != 0) {
+        return -1;
+    }
+    if (header->magic != FEED_MAGIC || header->version != FEED_VERSION ||
+        header->header_size != sizeof(FeedHeader) || header->body_size > FEED_MAX_MESSAGE_SIZE) {
+        LOG_ERROR("❌ Unexpected feed message (producer runs another protocol version?)");
+        return -1;
+    }
+
+    uint8_t *grown = buffer_pool_reserve(*buffer, capacity, header->body_size ? header->body_size : 1);
+    if (!grown) {
+        LOG_ERROR("❌ Failed to allocate feed message (%u bytes)", header->body_size);
+        return -1;
+    }
+    *buffer = grown;
+    return recv_all(fd, stop_fd, timeout_ms, grown, header->body_size);
+}
+
+/**
+ * Validate a received message and publish its sources into the local snapshot store
+ * Returns: 0 on success, -1 on an inconsistent message or allocation failure (nothing published)
+ */
+static int publish_message(const FeedHeader *header, const uint8_t *body) {
+    unsigned int changed = header->changed & FEED_ALL;
+    unsigned int carried = changed & header->available;
+
+    // Counts first: the sizes below are only computed from bounded values
+    int valid = header->forecast_count <= MAX_FORECAST_HOURS && header->titles_size <= header->body_size &&
+                header->event_count[0] <= MAX_EVENTS_PER_DAY && header->event_count[1] <= MAX_EVENTS_PER_DAY;
+    const uint8_t *titles = NULL;
+    if (valid) {
+        size_t expected = 0;
+        if (carried & FEED_WEATHER) expected += sizeof(FeedWeather) + header->forecast_count * sizeof(FeedForecast);
+        if (carried & FEED_MENU) expected += sizeof(MenuData);
+        if (carried & FEED_CALENDAR) {
+            expected += ((size_t)header->event_count[0] + header->event_count[1]) * sizeof(FeedEvent) +
+                        header->titles_size;
+            titles = body + header->body_size - header->titles_size;
+        }
+        valid = expected == header->body_size &&
+                (!titles || header->titles_size == 0 || titles[header->titles_size - 1] == '\0');
+    }
+    if (!valid) {
+        LOG_ERROR("❌ Ignoring inconsistent feed message (generation %llu)",
+                  (unsigned long long)header->generation);
+        return -1;
+    }
+
+    // Decode every part first: a message is published whole or not at all
+    const uint8_t *cursor = body;
+    WeatherData weather;
+    memset(&weather, 0, sizeof(weather));
+    if (carried & FEED_WEATHER) {
+        FeedWeather current;
+        memcpy(&current, cursor, sizeof(current));
+        cursor += sizeof(current);
+        weather.sunrise = (time_t)current.sunrise;
+        weather.sunset = (time_t)current.sunset;
+        weather.last_updated = (time_t)current.last_updated;
+        weather.current.temperature = current.temperature;
+        weather.current.weather_code = current.weather_code;
+        weather.current.is_day = current.is_day;
+
+        weather.forecast_count = (int)header->forecast_count;
+        for (uint32_t i = 0; i < header->forecast_count; i++) {
+            FeedForecast forecast;
+            memcpy(&forecast, cursor, sizeof(forecast));
+            cursor += sizeof(forecast);
+            weather.forecasts[i].datetime = (time_t)forecast.datetime;
+            weather.forecasts[i].temperature = forecast.temperature;
+            weather.forecasts[i].weather_code = forecast.weather_code;
+            weather.forecasts[i].is_day = forecast.is_day;
+        }
+    }
+
+    MenuData menu;
+    if (carried & FEED_MENU) {
+        memcpy(&menu, cursor, sizeof(menu));
+        cursor += sizeof(menu);
+        // Strings come from the network: make sure each one ends inside its field
+        DayMenuData *days[2] = { &menu.today, &menu.tomorrow };
+        for (int d = 0; d < 2; d++) {
+            days[d]->date[sizeof(days[d]->date) - 1] = '\0';
+            days[d]->midi[sizeof(days[d]->midi) - 1] = '\0';
+            days[d]->soir[sizeof(days[d]->soir) - 1] = '\0';
+        }
+    }
+
+    CalendarData calendar;
+    if (carried & FEED_CALENDAR) {
+        if (calendar_data_alloc(&calendar, header->titles_size) != 0) {
+            LOG_ERROR("❌ Failed to allocate calendar from feed");
+            return -1;
+        }
+        memcpy(calendar.titles, titles, header->titles_size);
+
+        DayEvents *days[2] = { &calendar.today, &calendar.tomorrow };
+        for (int d = 0; d < 2; d++) {
+            for (uint32_t i = 0; i < header->event_count[d]; i++) {
+                FeedEvent stored;
+                memcpy(&stored, cursor, sizeof(stored));
+                cursor += sizeof(stored);
+                CalendarEvent *event = &days[d]->events[i];
+                event->title = calendar.titles + (stored.title_offset < header->titles_size ? stored.title_offset : 0);
+                event->start = (time_t)stored.start;
+                event->end = (time_t)stored.end;
+                event->event_type = (stored.event_type >= EVENT_TYPE_NORMAL && stored.event_type <= EVENT_TYPE_END)
+                                    ? (EventType)stored.event_type : EVENT_TYPE_NORMAL;
+            }
+            days[d]->count = (int)header->event_count[d];
+        }
+    }
+
+    // One swap for the whole message: readers never see it half applied
+    unsigned int parts = ((changed & FEED_WEATHER) ? SNAPSHOT_PART_WEATHER : 0) |
+                         ((changed & FEED_MENU) ? SNAPSHOT_PART_MENU : 0) |
+                         ((changed & FEED_CALENDAR) ? SNAPSHOT_PART_CALENDAR : 0);
+    if (snapshot_publish_parts(parts, (carried & FEED_WEATHER) ? &weather : NULL,
+                               (carried & FEED_MENU) ? &menu : NULL,
+                               (carried & FEED_CALENDAR) ? &calendar : NULL) == 0) {
+        return -1;   // Calendar already released by the store
+    }
+
+    metrics_count(METRIC_FEED_RECEIVED);
+    return 0;
+}
+
+// ====================== PRODUCER ======================
+
+static void drop_subscriber(int index) {
+    close(g_server.subscribers[index]);
+    g_server.subscribers[index] = g_server.subscribers[--g_server.subscriber_count];
+    LOG_INFO("📡 Feed subscriber left (%d connected)", g_server.subscriber_count);
+}
+
+// Send the encoded message to every subscriber, dropping those that fail or stop reading
+static void send_to_subscribers(size_t size) {
+    for (int i = g_server.subscriber_count - 1; i >= 0; i--) {
+        if (send_all(g_server.subscribers[i], g_server.buffer, size) != 0) {
+            drop_subscriber(i);
+        } else {
+            metrics_count(METRIC_FEED_SENT);
+        }
+    }
+}
+
+// New subscriber: the whole current snapshot first, then only what changes
+static void accept_subscriber(void) {
+    struct sockaddr_storage peer;
+    socklen_t peer_length = sizeof(peer);
+    int fd = accept4(g_server.listen_fd, (struct sockaddr *)&peer, &peer_length, SOCK_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+
+    char host[NI_MAXHOST] = "?";
+    getnameinfo((struct sockaddr *)&peer, peer_length, host, sizeof(host), NULL, 0, NI_NUMERICHOST);
+    if (g_server.subscriber_count >= FEED_MAX_SUBSCRIBERS) {
+        LOG_ERROR("❌ Refusing feed subscriber %s (%d already connected)", host, FEED_MAX_SUBSCRIBERS);
+        close(fd);
+        return;
+    }
+    configure_socket(fd);
+
+    const DashboardSnapshot *snapshot = snapshot_acquire();
+    size_t size = encode_message(FEED_ALL, snapshot, &g_server.buffer, &g_server.capacity);
+    snapshot_release(snapshot);
+    if (size == 0 || send_all(fd, g_server.buffer, size) != 0) {
+        LOG_ERROR("❌ Failed to send the current snapshot to feed subscriber %s", host);
+        close(fd);
+        return;
+    }
+    metrics_count(METRIC_FEED_SENT);
+
+    g_server.subscribers[g_server.subscriber_count++] = fd;
+    LOG_INFO("📡 Feed subscriber %s joined (%d connected)", host, g_server.subscriber_count);
+}
+
+static void* server_thread(void *arg __attribute__((unused))) {
+    for (;;) {
+        struct pollfd fds[2 + FEED_MAX_SUBSCRIBERS];
+        fds[0] = (struct pollfd){ g_server.wake_fd, POLLIN, 0 };
+        fds[1] = (struct pollfd){ g_server.listen_fd, POLLIN, 0 };
+        int count = g_server.subscriber_count;
+        for (int i = 0; i < count; i++) {
+            fds[2 + i] = (struct pollfd){ g_server.subscribers[i], POLLIN, 0 };
+        }
+
+        if (poll(fds, (nfds_t)(2 + count), -1) < 0) {
+            if (errno == EINTR) continue;
+            LOG_ERROR("❌ Feed server poll failed: %s", strerror(errno));
+            break;
+        }
+
+        // Subscribers never send: readable means closed (anything else is discarded)
+        for (int i = count - 1; i >= 0; i--) {
+            if (fds[2 + i].revents) {
+                char discard[256];
+                ssize_t received = recv(g_server.subscribers[i], discard, sizeof(discard), MSG_DONTWAIT);
+                if (received == 0 || (received < 0 && errno != EAGAIN && errno != EINTR)) {
+                    drop_subscriber(i);
+                }
+            }
+        }
+
+        if (fds[1].revents & POLLIN) {
+            accept_subscriber();
+        }
+
+        if (fds[0].revents & POLLIN) {
+            uint64_t wakeups;
+            if (read(g_server.wake_fd, &wakeups, sizeof(wakeups)) < 0) {
+                // Nothing to do: the pending state below is what matters
+            }
+
+            pthread_mutex_lock(&g_server.lock);
+            int stop = g_server.stop;
+            unsigned int changed = g_server.pending_changed;
+            const DashboardSnapshot *snapshot = g_server.pending;
+            g_server.pending_changed = 0;
+            g_server.pending = NULL;
+            pthread_mutex_unlock(&g_server.lock);
+
+            if (snapshot && g_server.subscriber_count > 0) {
+                size_t size = encode_message(changed, snapshot, &g_server.buffer, &g_server.capacity);
+                if (size > 0) {
+                    send_to_subscribers(size);
+                    LOG_DEBUG("📡 Snapshot %llu pushed to %d feed subscribers",
+                              (unsigned long long)snapshot->generation, g_server.subscriber_count);
+                }
+            }
+            if (snapshot) {
+                snapshot_release(snapshot);
+            }
+            if (stop) {
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+
+int snapshot_feed_serve(const char *address) {
+    if (!address || g_server.running) {
+        return -1;
+    }
+
+    struct addrinfo *addresses;
+    if (resolve_address(address, 1, &addresses) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *candidate = addresses; candidate; candidate = candidate->ai_next) {
+        int reuse = 1;
+        fd = socket(candidate->ai_family, candidate->ai_socktype | SOCK_CLOEXEC, candidate->ai_protocol);
+        if (fd < 0) continue;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        if (bind(fd, candidate->ai_addr, candidate->ai_addrlen) == 0 && listen(fd, FEED_MAX_SUBSCRIBERS) == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(addresses);
+    if (fd < 0) {
+        LOG_ERROR("❌ Cannot listen for feed subscribers on %s: %s", address, strerror(errno));
+        return -1;
+    }
+
+    g_server.listen_fd = fd;
+    g_server.wake_fd = eventfd(0, EFD_CLOEXEC);
+    g_server.subscriber_count = 0;
+    g_server.stop = 0;
+    if (g_server.wake_fd < 0 || pthread_create(&g_server.thread, NULL, server_thread, NULL) != 0) {
+        LOG_ERROR("❌ Failed to start the feed server");
+        if (g_server.wake_fd >= 0) close(g_server.wake_fd);
+        close(fd);
+        g_server.listen_fd = g_server.wake_fd = -1;
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_server.lock);
+    g_server.running = 1;
+    pthread_mutex_unlock(&g_server.lock);
+    LOG_INFO("📡 Serving snapshots to feed subscribers on %s", address);
+    return 0;
+}
+
+void snapshot_feed_broadcast(unsigned int changed, const DashboardSnapshot *snapshot) {
+    if (!snapshot) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_server.lock);
+    if (!g_server.running || g_server.stop) {
+        pthread_mutex_unlock(&g_server.lock);
+        snapshot_release(snapshot);
+        return;
+    }
+    const DashboardSnapshot *superseded = g_server.pending;
+    g_server.pending = snapshot;
+    g_server.pending_changed |= changed;
+    pthread_mutex_unlock(&g_server.lock);
+
+    if (superseded) {
+        snapshot_release(superseded);
+    }
+    uint64_t wakeup = 1;
+    if (write(g_server.wake_fd, &wakeup, sizeof(wakeup)) < 0) {
+        LOG_ERROR("❌ Failed to wake the feed server");
+    }
+}
+
+static void server_stop(void) {
+    pthread_mutex_lock(&g_server.lock);
+    int running = g_server.running;
+    g_server.stop = 1;
+    pthread_mutex_unlock(&g_server.lock);
+    if (!running) {
+        return;
+    }
+
+    uint64_t wakeup = 1;
+    if (write(g_server.wake_fd, &wakeup, sizeof(wakeup)) < 0) {
+        LOG_ERROR("❌ Failed to wake the feed server");
+    }
+    pthread_join(g_server.thread, NULL);
+
+    pthread_mutex_lock(&g_server.lock);
+    const DashboardSnapshot *pending = g_server.pending;
+    g_server.pending = NULL;
+    g_server.running = 0;
+    pthread_mutex_unlock(&g_server.lock);
+    if (pending) {
+        snapshot_release(pending);
+    }
+
+    while (g_server.subscriber_count > 0) {
+        close(g_server.subscribers[--g_server.subscriber_count]);
+    }
+    close(g_server.listen_fd);
+    close(g_server.wake_fd);
+    g_server.listen_fd = g_server.wake_fd = -1;
+    free(g_server.buffer);
+    g_server.buffer = NULL;
+    g_server.capacity = 0;
+}
+
+// ====================== CONSUMER ======================
+
+// Returns: 1 if a stop was requested within timeout_ms, 0 otherwise
+static int wait_for_stop(int timeout_ms) {
+    struct pollfd fds[1] = { { g_client.stop_fd, POLLIN, 0 } };
+    int ready;
+    do {
+        ready = poll(fds, 1, timeout_ms);
+    } while (ready < 0 && errno == EINTR);
+    return ready > 0;
+}
+
+// Publish messages until the connection fails or a stop is requested
+static void client_session(int fd) {
+    FeedHeader header;
+    int first = 1;
+
+    while (receive_message(fd, g_client.stop_fd, -1, &header, &g_client.buffer, &g_client.capacity) == 0) {
+        if (publish_message(&header, g_client.buffer) != 0) {
+            return;
+        }
+        if (first) {
+            retry_backoff_reset(&g_client.backoff);
+            LOG_INFO("📡 Receiving snapshots from %s", g_client.address);
+            first = 0;
+        }
+        LOG_DEBUG("📡 Feed snapshot %llu received (changed 0x%x)",
+                  (unsigned long long)header.generation, header.changed);
+        if (g_client.handler) {
+            g_client.handler(header.changed & FEED_ALL, header.available & FEED_ALL, g_client.arg);
+        }
+    }
+}
+
+static void* client_thread(void *arg __attribute__((unused))) {
+    for (;;) {
+        int fd = connect_to(g_client.address);
+        if (fd >= 0) {
+            client_session(fd);
+            close(fd);
+        }
+        if (wait_for_stop(0)) {
+            break;
+        }
+
+        int delay = retry_backoff_next_delay(&g_client.backoff);
+        LOG_ERROR("❌ %s producer %s, retrying in %d seconds", fd >= 0 ? "Lost" : "Cannot reach",
+                  g_client.address, delay);
+        if (wait_for_stop(delay * 1000)) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+int snapshot_feed_subscribe(const char *address, SnapshotFeedHandler handler, void *arg) {
+    if (!address || g_client.running ||
+        snprintf(g_client.address, sizeof(g_client.address), "%s", address) >= (int)sizeof(g_client.address)) {
+        return -1;
+    }
+
+    g_client.handler = handler;
+    g_client.arg = arg;
+    retry_backoff_init(&g_client.backoff, FEED_RECONNECT_BASE, FEED_RECONNECT_MAX);
+    g_client.stop_fd = eventfd(0, EFD_CLOEXEC);
+    if (g_client.stop_fd < 0 || pthread_create(&g_client.thread, NULL, client_thread, NULL) != 0) {
+        LOG_ERROR("❌ Failed to start the feed subscriber");
+        if (g_client.stop_fd >= 0) close(g_client.stop_fd);
+        g_client.stop_fd = -1;
+        return -1;
+    }
+
+    g_client.running = 1;
+    LOG_INFO("📡 Subscribing to snapshots from %s", address);
+    return 0;
+}
+
+int snapshot_feed_fetch(const char *address, int timeout_sec, unsigned int *available) {
+    int fd = connect_to(address);
+    if (fd < 0) {
+        LOG_ERROR("❌ Cannot reach producer %s", address ? address : "(none)");
+        return -1;
+    }
+
+    FeedHeader header;
+    uint8_t *buffer = NULL;
+    size_t capacity = 0;
+    int result = receive_message(fd, -1, timeout_sec * 1000, &header, &buffer, &capacity) == 0 &&
+                 publish_message(&header, buffer) == 0 ? 0 : -1;
+    close(fd);
+    free(buffer);
+
+    if (result != 0) {
+        LOG_ERROR("❌ No snapshot received from producer %s", address);
+    } else if (available) {
+        *available = header.available & FEED_ALL;
+    }
+    return result;
+}
+
+static void client_stop(void) {
+    if (!g_client.running) {
+        return;
+    }
+
+    uint64_t wakeup = 1;
+    if (write(g_client.stop_fd, &wakeup, sizeof(wakeup)) < 0) {
+        LOG_ERROR("❌ Failed to stop the feed subscriber");
+    }
+    pthread_join(g_client.thread, NULL);
+
+    close(g_client.stop_fd);
+    g_client.stop_fd = -1;
+    g_client.running = 0;
+    free(g_client.buffer);
+    g_client.buffer = NULL;
+    g_client.capacity = 0;
+}
+
+void snapshot_feed_stop(void) {
+    client_stop();
+    server_stop();
+}
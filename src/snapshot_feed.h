@@ -0,0 +1,59 @@
+#ifndef SNAPSHOT_FEED_H
+#define SNAPSHOT_FEED_H
+
+#include "snapshot.h"
+
+// Snapshot feed: one producer fetches the data, every other dashboard subscribes to it over TCP
+// Addresses are "host:port" (IPv6 literals in brackets); an empty host listens on all interfaces.
+#define FEED_DEFAULT_PORT "7878"
+#define FEED_MAGIC 0x46485344u          // "DSHF"
+#define FEED_VERSION 1                  // Bump when the message layout below changes
+#define FEED_MAX_SUBSCRIBERS 8
+#define FEED_MAX_MESSAGE_SIZE (1024 * 1024)
+#define FEED_SEND_TIMEOUT_SEC 5         // A subscriber that stops reading is dropped
+#define FEED_FETCH_TIMEOUT_SEC 10       // One-shot fetch (debug mode)
+
+// Sources carried by a message (bitmask)
+typedef enum {
+    FEED_WEATHER = 1 << 0,
+    FEED_MENU = 1 << 1,
+    FEED_CALENDAR = 1 << 2,
+    FEED_ALL = FEED_WEATHER | FEED_MENU | FEED_CALENDAR
+} FeedSource;
+
+/**
+ * Called on the subscriber thread once a message is published into the local snapshot store
+ * changed: sources republished (FEED_ALL after each connection); available: sources the producer has
+ */
+typedef void (*SnapshotFeedHandler)(unsigned int changed, unsigned int available, void *arg);
+
+/**
+ * Producer side: listen for subscribers on address (a new subscriber first gets the current snapshot)
+ * Returns: 0 on success, -1 on failure
+ */
+int snapshot_feed_serve(const char *address);
+
+/**
+ * Push the sources that changed to every subscriber (producer side, never blocks on the network)
+ * Takes over the snapshot reference. A message still waiting is superseded: sources are
+ * merged and only the newest snapshot is sent.
+ */
+void snapshot_feed_broadcast(unsigned int changed, const DashboardSnapshot *snapshot);
+
+/**
+ * Consumer side: publish every message from the producer at address into the local snapshot store
+ * Runs on its own thread and reconnects with jittered exponential backoff.
+ * Returns: 0 if the subscriber thread started, -1 on failure
+ */
+int snapshot_feed_subscribe(const char *address, SnapshotFeedHandler handler, void *arg);
+
+/**
+ * Fetch and publish one snapshot from the producer at address (debug mode)
+ * Returns: 0 on success (available filled in), -1 on failure or timeout
+ */
+int snapshot_feed_fetch(const char *address, int timeout_sec, unsigned int *available);
+
+// Stop the producer and subscriber threads and close every connection
+void snapshot_feed_stop(void);
+
+#endif // SNAPSHOT_FEED_H
@@ -0,0 +1,287 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "state_store.h"
+#include "logging.h"
+
+// Section flags
+#define STATE_HAS_WEATHER  (1u << 0)
+#define STATE_HAS_MENU     (1u << 1)
+#define STATE_HAS_CALENDAR (1u << 2)
+#define STATE_HAS_FRAME    (1u << 3)
+#define STATE_PANEL_CLEARED (1u << 4)
+
+// File layout: header, frame, today's then tomorrow's events, titles (each NUL-terminated)
+// Structs are stored as-is: the file is only ever read back by the same build on the same device
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;           // sizeof(StateHeader): catches layout changes between builds
+    uint32_t flags;                 // STATE_HAS_* bits
+    int64_t saved_at;
+    int64_t last_full_time;
+    int32_t partial_count;
+    uint32_t frame_size;
+    uint32_t event_count[2];        // Today, tomorrow
+    uint32_t titles_size;
+    uint32_t checksum;              // FNV-1a of the whole file except this field
+    WeatherData weather;
+    MenuData menu;
+} StateHeader;
+
+typedef struct {
+    int64_t start;
+    int64_t end;
+    uint32_t title_offset;          // Into the titles section
+    int32_t event_type;
+} StateEvent;
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+static uint32_t checksum_update(uint32_t hash, const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// Checksum of the header with its checksum field skipped, to be continued over the body
+static uint32_t checksum_header(const StateHeader *header) {
+    const uint8_t *bytes = (const uint8_t *)header;
+    size_t field = offsetof(StateHeader, checksum);
+    size_t after = field + sizeof(header->checksum);
+    uint32_t hash = checksum_update(FNV_OFFSET_BASIS, bytes, field);
+    return checksum_update(hash, bytes + after, sizeof(StateHeader) - after);
+}
+
+// ====================== RESTORE ======================
+
+int state_store_open(PersistedState *state) {
+    if (!state) {
+        return -1;
+    }
+    memset(state, 0, sizeof(*state));
+
+    int fd = open(STATE_FILE, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno != ENOENT) {
+            LOG_ERROR("❌ Cannot open state file %s: %s", STATE_FILE, strerror(errno));
+        }
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(StateHeader) || st.st_size > STATE_MAX_FILE_SIZE) {
+        close(fd);
+        LOG_ERROR("❌ Ignoring state file %s (unexpected size)", STATE_FILE);
+        return -1;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        LOG_ERROR("❌ Cannot map state file %s: %s", STATE_FILE, strerror(errno));
+        return -1;
+    }
+
+    const StateHeader *header = (const StateHeader *)mapping;
+    const uint8_t *body = (const uint8_t *)mapping + sizeof(StateHeader);
+    size_t body_size = size - sizeof(StateHeader);
+    size_t events_size = ((size_t)header->event_count[0] + header->event_count[1]) * sizeof(StateEvent);
+
+    if (header->magic != STATE_FILE_MAGIC || header->version != STATE_FILE_VERSION ||
+        header->header_size != sizeof(StateHeader) ||
+        header->event_count[0] > MAX_EVENTS_PER_DAY || header->event_count[1] > MAX_EVENTS_PER_DAY ||
+        (size_t)header->frame_size + events_size + header->titles_size != body_size ||
+        (header->titles_size > 0 && body[body_size - 1] != '\0') ||
+        checksum_update(checksum_header(header), body, body_size) != header->checksum) {
+        munmap(mapping, size);
+        LOG_ERROR("❌ Ignoring state file %s (stale format or corrupted)", STATE_FILE);
+        return -1;
+    }
+
+    state->mapping = mapping;
+    state->mapping_size = size;
+    state->saved_at = (time_t)header->saved_at;
+
+    // Published as-is at startup: bound the counts and strings like any other untrusted input
+    if (header->flags & STATE_HAS_WEATHER) {
+        state->weather_data = header->weather;
+        WeatherData *weather = &state->weather_data;
+        if (weather->forecast_count < 0) weather->forecast_count = 0;
+        if (weather->forecast_count > MAX_FORECAST_HOURS) weather->forecast_count = MAX_FORECAST_HOURS;
+        state->weather = weather;
+    }
+    if (header->flags & STATE_HAS_MENU) {
+        state->menu_data = header->menu;
+        DayMenuData *days[2] = { &state->menu_data.today, &state->menu_data.tomorrow };
+        for (int d = 0; d < 2; d++) {
+            days[d]->date[sizeof(days[d]->date) - 1] = '\0';
+            days[d]->midi[sizeof(days[d]->midi) - 1] = '\0';
+            days[d]->soir[sizeof(days[d]->soir) - 1] = '\0';
+        }
+        state->menu = &state->menu_data;
+    }
+    if ((header->flags & STATE_HAS_FRAME) && header->frame_size > 0) {
+        state->frame = body;
+        state->frame_size = header->frame_size;
+    }
+    state->panel.partial_count = header->partial_count;
+    state->panel.last_full_time = (time_t)header->last_full_time;
+    state->panel.panel_cleared = (header->flags & STATE_PANEL_CLEARED) != 0;
+    state->has_calendar = (header->flags & STATE_HAS_CALENDAR) != 0;
+    state->events = body + header->frame_size;
+    state->event_count[0] = header->event_count[0];
+    state->event_count[1] = header->event_count[1];
+    state->titles = (const char *)body + header->frame_size + events_size;
+    state->titles_size = header->titles_size;
+
+    LOG_DEBUG("💾 State restored from %s (%zu bytes, saved %lds ago)", STATE_FILE, size,
+              (long)(time(NULL) - state->saved_at));
+    return 0;
+}
+
+int state_store_calendar(const PersistedState *state, CalendarData *data) {
+    if (!state || !data || !state->mapping || !state->has_calendar) {
+        return -1;
+    }
+    if (calendar_data_alloc(data, state->titles_size) != 0) {
+        return -1;
+    }
+    memcpy(data->titles, state->titles, state->titles_size);
+
+    const StateEvent *stored = (const StateEvent *)state->events;
+    DayEvents *days[2] = { &data->today, &data->tomorrow };
+    for (int d = 0; d < 2; d++) {
+        uint32_t count = state->event_count[d];
+        for (uint32_t i = 0; i < count; i++, stored++) {
+            CalendarEvent *event = &days[d]->events[i];
+            event->title = data->titles + (stored->title_offset < state->titles_size ? stored->title_offset : 0);
+            event->start = (time_t)stored->start;
+            event->end = (time_t)stored->end;
+            event->event_type = (stored->event_type >= EVENT_TYPE_NORMAL && stored->event_type <= EVENT_TYPE_END)
+                                ? (EventType)stored->event_type : EVENT_TYPE_NORMAL;
+        }
+        days[d]->count = (int)count;
+    }
+    return 0;
+}
+
+void state_store_close(PersistedState *state) {
+    if (state && state->mapping) {
+        munmap(state->mapping, state->mapping_size);
+    }
+    if (state) {
+        memset(state, 0, sizeof(*state));
+    }
+}
+
+// ====================== SAVE ======================
+
+static int write_part(FILE *file, const void *data, size_t length, uint32_t *checksum) {
+    if (length == 0) {
+        return 1;
+    }
+    *checksum = checksum_update(*checksum, data, length);
+    return fwrite(data, 1, length, file) == length;
+}
+
+int state_store_save(const DashboardSnapshot *snapshot, const uint8_t *frame, size_t frame_size,
+                     const PanelState *panel) {
+    if (!snapshot) {
+        return -1;
+    }
+
+    StateHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = STATE_FILE_MAGIC;
+    header.version = STATE_FILE_VERSION;
+    header.header_size = sizeof(StateHeader);
+    header.saved_at = (int64_t)time(NULL);
+    if (snapshot->weather) {
+        header.flags |= STATE_HAS_WEATHER;
+        header.weather = *snapshot->weather;
+    }
+    if (snapshot->menu) {
+        header.flags |= STATE_HAS_MENU;
+        header.menu = *snapshot->menu;
+    }
+    if (frame && frame_size > 0) {
+        header.flags |= STATE_HAS_FRAME;
+        header.frame_size = (uint32_t)frame_size;
+    }
+    if (panel) {
+        header.partial_count = panel->partial_count;
+        header.last_full_time = (int64_t)panel->last_full_time;
+        if (panel->panel_cleared) header.flags |= STATE_PANEL_CLEARED;
+    }
+
+    // Events with their title offsets (titles are rewritten in event order)
+    StateEvent events[2 * MAX_EVENTS_PER_DAY];
+    int event_total = 0;
+    if (snapshot->calendar) {
+        const DayEvents *days[2] = { &snapshot->calendar->today, &snapshot->calendar->tomorrow };
+        header.flags |= STATE_HAS_CALENDAR;
+        for (int d = 0; d < 2; d++) {
+            int count = days[d]->count < MAX_EVENTS_PER_DAY ? days[d]->count : MAX_EVENTS_PER_DAY;
+            header.event_count[d] = (uint32_t)count;
+            for (int i = 0; i < count; i++) {
+                const CalendarEvent *event = &days[d]->events[i];
+                StateEvent *stored = &events[event_total++];
+                stored->start = (int64_t)event->start;
+                stored->end = (int64_t)event->end;
+                stored->event_type = (int32_t)event->event_type;
+                stored->title_offset = header.titles_size;
+                header.titles_size += (uint32_t)strlen(event->title ? event->title : "") + 1;
+            }
+        }
+    }
+
+    if (mkdir(STATE_DIR, 0755) != 0 && errno != EEXIST) {
+        LOG_ERROR("❌ Cannot create %s: %s", STATE_DIR, strerror(errno));
+        return -1;
+    }
+
+    FILE *file = fopen(STATE_FILE ".tmp", "wb");
+    if (!file) {
+        LOG_ERROR("❌ Failed to write state file %s", STATE_FILE ".tmp");
+        return -1;
+    }
+
+    // Header written last, but every field is already final: its checksum starts the running one
+    uint32_t checksum = checksum_header(&header);
+    int ok = fseek(file, (long)sizeof(StateHeader), SEEK_SET) == 0 &&
+             write_part(file, frame, header.frame_size, &checksum) &&
+             write_part(file, events, (size_t)event_total * sizeof(StateEvent), &checksum);
+    if (snapshot->calendar) {
+        const DayEvents *days[2] = { &snapshot->calendar->today, &snapshot->calendar->tomorrow };
+        for (int d = 0; d < 2 && ok; d++) {
+            for (uint32_t i = 0; i < header.event_count[d] && ok; i++) {
+                const char *title = days[d]->events[i].title ? days[d]->events[i].title : "";
+                ok = write_part(file, title, strlen(title) + 1, &checksum);
+            }
+        }
+    }
+    header.checksum = checksum;
+    ok = ok && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+
+    // On disk before the rename, so a power cut leaves either the old file or the complete new one
+    ok = ok && fflush(file) == 0 && fsync(fileno(file)) == 0;
+    ok = (fclose(file) == 0) && ok;
+    if (!ok || rename(STATE_FILE ".tmp", STATE_FILE) != 0) {
+        LOG_ERROR("❌ Failed to write state file %s", STATE_FILE);
+        remove(STATE_FILE ".tmp");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+#ifndef STATE_STORE_H
+#define STATE_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include "snapshot.h"
+
+// Last published data and the frame shown on the panel, restored at startup for a fast cold start
+#define STATE_DIR PROJECT_ROOT "/cache"
+#define STATE_FILE STATE_DIR "/state.bin"
+#define STATE_FILE_MAGIC 0x53485344u    // "DSHS"
+#define STATE_FILE_VERSION 2            // Bump when WeatherData, MenuData or the layout below changes
+#define STATE_MAX_FILE_SIZE (1024 * 1024)
+
+// Panel-side state saved with the frame
+typedef struct {
+    int partial_count;          // Ghosting policy: partial updates since the last full refresh
+    time_t last_full_time;
+    int panel_cleared;          // Clean shutdown cleared the panel: the frame is no longer visible
+} PanelState;
+
+// Read-only view of the mapped state file (pointers stay valid until state_store_close)
+typedef struct {
+    time_t saved_at;
+    const WeatherData *weather;     // NULL when not saved (bounded copy, see weather_data)
+    const MenuData *menu;           // NULL when not saved (terminated copy, see menu_data)
+    const uint8_t *frame;           // NULL when not saved
+    size_t frame_size;
+    PanelState panel;
+    // Private
+    WeatherData weather_data;       // forecast_count clamped to MAX_FORECAST_HOURS
+    MenuData menu_data;             // Every string NUL-terminated inside its field
+    void *mapping;
+    size_t mapping_size;
+    const void *events;
+    uint32_t event_count[2];
+    const char *titles;
+    uint32_t titles_size;
+    int has_calendar;
+} PersistedState;
+
+/**
+ * Map and validate the state file (magic, version, layout sizes and checksum of the whole image)
+ * Returns: 0 on success, -1 when missing or invalid (state zeroed)
+ */
+int state_store_open(PersistedState *state);
+
+/**
+ * Rebuild the saved calendar into data (pooled events and title arena, freed with calendar_data_free)
+ * Returns: 0 on success, -1 when not saved or on allocation failure
+ */
+int state_store_calendar(const PersistedState *state, CalendarData *data);
+
+// Unmap the state file
+void state_store_close(PersistedState *state);
+
+/**
+ * Write snapshot data and the panel frame (temporary file synced to disk, then rename)
+ * frame may be NULL when nothing is shown yet.
+ * Returns: 0 on success, -1 on failure
+ */
+int state_store_save(const DashboardSnapshot *snapshot, const uint8_t *frame, size_t frame_size,
+                     const PanelState *panel);
+
+#endif // STATE_STORE_H
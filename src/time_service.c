@@ -0,0 +1,171 @@
+#define _GNU_SOURCE
+#include <string.h>
+#include <time.h>
+#include "time_service.h"
+#include "recurrence.h"
+
+// Interval [valid_from, valid_until) over which the local UTC offset is constant
+typedef struct {
+    time_t valid_from;
+    time_t valid_until;         // valid_from == valid_until: nothing cached
+    long offset;                // Seconds east of UTC (tm_gmtoff)
+    int isdst;
+    const char *zone;           // Points into the C library's tz data
+} OffsetRange;
+
+static __thread OffsetRange t_range;
+
+// Larger than any DST shift, so a wall time this far inside a window is unambiguous
+#define TIME_SERVICE_TRANSITION_MARGIN (3 * 3600)
+
+// ====================== OFFSET CACHE ======================
+
+static inline long floor_div(long long value, long divisor) {
+    long long quotient = value / divisor;
+    return (long)((value % divisor < 0) ? quotient - 1 : quotient);
+}
+
+static int offset_at(time_t timestamp, long *offset) {
+    struct tm tm;
+    if (!localtime_r(&timestamp, &tm)) return -1;
+    *offset = tm.tm_gmtoff;
+    return 0;
+}
+
+/**
+ * Cache the offset window around timestamp (one localtime_r plus two boundary checks)
+ * Falls back to a single local day, then to no caching, around DST transitions.
+ * Returns: 0 on success (t_range describes timestamp), -1 on failure
+ */
+static int refresh_range(time_t timestamp) {
+    struct tm tm;
+    if (!localtime_r(&timestamp, &tm)) return -1;
+
+    long offset = tm.tm_gmtoff;
+    long day = floor_div((long long)timestamp + offset, TIME_SERVICE_SECONDS_PER_DAY);
+    long block = day - (day % TIME_SERVICE_RANGE_DAYS + TIME_SERVICE_RANGE_DAYS) % TIME_SERVICE_RANGE_DAYS;
+
+    t_range.offset = offset;
+    t_range.isdst = tm.tm_isdst;
+    t_range.zone = tm.tm_zone;
+    t_range.valid_from = t_range.valid_until = timestamp;
+
+    const long spans[2][2] = { { block, TIME_SERVICE_RANGE_DAYS }, { day, 1 } };
+    for (int i = 0; i < 2; i++) {
+        time_t from = (time_t)spans[i][0] * TIME_SERVICE_SECONDS_PER_DAY - offset;
+        time_t until = from + (time_t)spans[i][1] * TIME_SERVICE_SECONDS_PER_DAY;
+        long first, last;
+        if (offset_at(from, &first) == 0 && offset_at(until - 1, &last) == 0 &&
+            first == offset && last == offset) {
+            t_range.valid_from = from;
+            t_range.valid_until = until;
+            return 0;
+        }
+    }
+    return 0; // Transition day: offset valid for timestamp only
+}
+
+// Make t_range describe timestamp
+static int lookup_offset(time_t timestamp) {
+    if (timestamp >= t_range.valid_from && timestamp < t_range.valid_until) {
+        return 0;
+    }
+    if (timestamp == t_range.valid_from && t_range.zone) {
+        return 0;
+    }
+    return refresh_range(timestamp);
+}
+
+// ====================== PUBLIC API ======================
+
+struct tm* time_service_local(time_t timestamp, struct tm *result) {
+    if (!result || lookup_offset(timestamp) != 0) {
+        return NULL;
+    }
+
+    long long local = (long long)timestamp + t_range.offset;
+    long day = floor_div(local, TIME_SERVICE_SECONDS_PER_DAY);
+    long seconds = (long)(local - (long long)day * TIME_SERVICE_SECONDS_PER_DAY);
+
+    int year, month, mday;
+    recurrence_civil_from_day((int)day, &year, &month, &mday);
+
+    memset(result, 0, sizeof(struct tm));
+    result->tm_year = year - 1900;
+    result->tm_mon = month - 1;
+    result->tm_mday = mday;
+    result->tm_hour = (int)(seconds / 3600);
+    result->tm_min = (int)(seconds / 60 % 60);
+    result->tm_sec = (int)(seconds % 60);
+    result->tm_wday = (int)((day % 7 + 11) % 7); // 1970-01-01 was a Thursday (4)
+    result->tm_yday = (int)day - recurrence_day_from_civil(year, 1, 1);
+    result->tm_isdst = t_range.isdst;
+    result->tm_gmtoff = t_range.offset;
+    result->tm_zone = t_range.zone;
+    return result;
+}
+
+time_t time_service_now(struct tm *result) {
+    time_t now = time(NULL);
+    if (result && !time_service_local(now, result)) {
+        memset(result, 0, sizeof(struct tm));
+    }
+    return now;
+}
+
+int time_service_local_day(time_t timestamp) {
+    if (lookup_offset(timestamp) != 0) {
+        return 0;
+    }
+    return (int)floor_div((long long)timestamp + t_range.offset, TIME_SERVICE_SECONDS_PER_DAY);
+}
+
+int time_service_date_int(time_t timestamp) {
+    int year, month, mday;
+    recurrence_civil_from_day(time_service_local_day(timestamp), &year, &month, &mday);
+    return year * 10000 + month * 100 + mday;
+}
+
+time_t time_service_make_local(int day, int seconds_of_day) {
+    long long wall = (long long)day * TIME_SERVICE_SECONDS_PER_DAY + seconds_of_day;
+
+    // Guess with the cached offset, then confirm the guess falls well inside the cached window
+    // (near its edges the same wall time may also exist, or not exist, across a transition)
+    time_t guess = (time_t)(wall - t_range.offset);
+    if (lookup_offset(guess) == 0) {
+        time_t candidate = (time_t)(wall - t_range.offset);
+        if (candidate >= t_range.valid_from + TIME_SERVICE_TRANSITION_MARGIN &&
+            candidate < t_range.valid_until - TIME_SERVICE_TRANSITION_MARGIN) {
+            return candidate;
+        }
+    }
+
+    // Near a DST transition: let mktime resolve gaps and overlaps
+    int year, month, mday;
+    recurrence_civil_from_day(day, &year, &month, &mday);
+    struct tm tm;
+    memset(&tm, 0, sizeof(tm));
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = mday;
+    tm.tm_hour = seconds_of_day / 3600;
+    tm.tm_min = seconds_of_day / 60 % 60;
+    tm.tm_sec = seconds_of_day % 60;
+    tm.tm_isdst = -1;
+    return mktime(&tm);
+}
+
+time_t time_service_mktime(const struct tm *tm) {
+    if (!tm) return -1;
+
+    // Months first (they set the day count), then days and seconds are plain offsets
+    long long month = (long long)tm->tm_year * 12 + tm->tm_mon;
+    int year = (int)floor_div(month, 12) + 1900;
+    int month_of_year = (int)(month - (long long)(year - 1900) * 12) + 1;
+    int day = recurrence_day_from_civil(year, month_of_year, 1) + tm->tm_mday - 1;
+    long long seconds = (long long)tm->tm_hour * 3600 + (long long)tm->tm_min * 60 + tm->tm_sec;
+
+    day += (int)floor_div(seconds, TIME_SERVICE_SECONDS_PER_DAY);
+    seconds -= (long long)floor_div(seconds, TIME_SERVICE_SECONDS_PER_DAY) * TIME_SERVICE_SECONDS_PER_DAY;
+    return time_service_make_local(day, (int)seconds);
+}
@@ -0,0 +1,47 @@
+#ifndef TIME_SERVICE_H
+#define TIME_SERVICE_H
+
+#include <time.h>
+
+// Window over which a cached UTC offset is validated (DST transitions are months apart)
+#define TIME_SERVICE_RANGE_DAYS 7
+#define TIME_SERVICE_SECONDS_PER_DAY 86400
+
+/**
+ * Thread-safe local time conversion (drop-in for localtime_r)
+ * Each thread caches one TIME_SERVICE_RANGE_DAYS window with a constant UTC offset;
+ * inside it the broken-down time is plain integer arithmetic, no tz lookup.
+ * Returns: result, or NULL on failure
+ */
+struct tm* time_service_local(time_t timestamp, struct tm *result);
+
+/**
+ * Current time and its broken-down local time
+ * Returns: time(NULL); result is zeroed on failure
+ */
+time_t time_service_now(struct tm *result);
+
+/**
+ * Local civil day number (days since 1970-01-01, as in recurrence.h)
+ */
+int time_service_local_day(time_t timestamp);
+
+/**
+ * Local date as YYYYMMDD (for day comparisons)
+ */
+int time_service_date_int(time_t timestamp);
+
+/**
+ * Timestamp of a local wall-clock time (seconds since midnight) on a civil day
+ * Equivalent to mktime with tm_isdst = -1; only DST transition days take the slow path.
+ */
+time_t time_service_make_local(int day, int seconds_of_day);
+
+/**
+ * mktime for a broken-down local time (tm_isdst = -1 semantics, out-of-range fields normalized)
+ * glibc's mktime re-reads the zone and allocates on every call when TZ is unset; this does neither.
+ * Returns: timestamp, or -1 on failure
+ */
+time_t time_service_mktime(const struct tm *tm);
+
+#endif // TIME_SERVICE_H
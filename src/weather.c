@@ -5,11 +5,12 @@
 #include <time.h>
 #include <math.h>
 #include <curl/curl.h>
-#include <cjson/cJSON.h>
 #include "common.h"
 #include "http.h"
 #include "weather.h"
 #include "logging.h"
+#include "time_service.h"
+#include "metrics.h"
 
 // Weather client structure (implementation)
 struct WeatherClient {
@@ -17,10 +18,14 @@ struct WeatherClient {
     double latitude;
     double longitude;
     int debug;
+    HttpValidators validators;  // Validators of the last parsed response
+    WeatherData last_data;      // Returned again when the server answers 304
+    int has_last_data;
+    long max_age;               // Freshness lifetime of the last response (-1 = not given)
 };
 
 // Weather code to description mapping
-static const char* get_weather_description(int code) {
+const char* get_weather_description(int code) {
     switch (code) {
         case 0: return "Ciel dégagé";
         case 1: return "Principalement dégagé";
@@ -55,7 +60,7 @@ static const char* get_weather_description(int code) {
 }
 
 // Weather code to icon mapping
-static const char* get_weather_icon(int code, int is_day) {
+const char* get_weather_icon(int code, int is_day) {
     switch (code) {
         case 0: return is_day ? "☀️" : "🌙";
         case 1: case 2: return is_day ? "🌤️" : "🌙";
@@ -72,7 +77,7 @@ static const char* get_weather_icon(int code, int is_day) {
 }
 
 // Weather code to icon unicode mapping
-static const char* get_weather_icon_unicode(int code, int is_day) {
+const char* get_weather_icon_unicode(int code, int is_day) {
     switch (code) {
         case 0: return is_day ? "\ue81a" : "\uef44";
         case 1: case 2: return is_day ? "\uf172" : "\uf174";
@@ -96,7 +101,8 @@ static int is_day_time(time_t timestamp, time_t sunrise, time_t sunset) {
     
     // If sunrise/sunset data is invalid, fall back to simple hour check
     if (sunrise == 0 || sunset == 0) {
-        struct tm *timeinfo = localtime(&timestamp);
+        struct tm timeinfo_buf;
+        struct tm *timeinfo = time_service_local(timestamp, &timeinfo_buf);
         if (!timeinfo) {
             return 1;
         }
@@ -115,12 +121,20 @@ static time_t parse_iso_datetime(const char* datetime_str) {
     
     struct tm tm = {0};
     if (strptime(datetime_str, "%Y-%m-%dT%H:%M", &tm) != NULL) {
-        tm.tm_isdst = -1;  // Let mktime determine DST
-        return mktime(&tm);
+        tm.tm_isdst = -1;  // Let the zone determine DST
+        return time_service_mktime(&tm);
     }
     return 0;
 }
 
+// Temperature as displayed ("%.0f" rounds to nearest, ties to even, like nearbyint)
+static int16_t display_temperature(double celsius) {
+    double rounded = nearbyint(celsius);
+    if (rounded < INT16_MIN) return INT16_MIN;
+    if (rounded > INT16_MAX) return INT16_MAX;
+    return (int16_t)rounded;
+}
+
 // Safe string copy with bounds checking
 static void safe_strncpy(char *dest, const char *src, size_t dest_size) {
     if (!dest || !src || dest_size == 0) {
@@ -130,146 +144,473 @@ static void safe_strncpy(char *dest, const char *src, size_t dest_size) {
     dest[dest_size - 1] = '\0';
 }
 
-// Fetch weather JSON data from API with validation
-static cJSON* fetch_weather_json(const WeatherClient *client) {
-    if (!client) {
-        return NULL;
+// Open-Meteo response fields, gathered in one in-place pass over the body (no DOM, no allocation)
+#define WEATHER_HOURLY_SLOTS (MAX_FORECAST_HOURS + 1)  // forecast_hours requested, current hour first
+#define MAX_ISO_DATETIME_LENGTH 32
+
+enum {
+    HAS_CURRENT_TEMPERATURE = 1 << 0,
+    HAS_CURRENT_CODE = 1 << 1,
+    HAS_CURRENT_IS_DAY = 1 << 2,
+    HAS_SUNRISE = 1 << 3,
+    HAS_SUNSET = 1 << 4,
+    HAS_HOURLY_TIME = 1 << 5,
+    HAS_HOURLY_TEMPERATURE = 1 << 6,
+    HAS_HOURLY_CODE = 1 << 7
+};
+
+typedef struct {
+    double current_temperature;
+    int current_code;
+    int current_is_day;
+    time_t sunrise;
+    time_t sunset;
+    time_t times[WEATHER_HOURLY_SLOTS];
+    double temperatures[WEATHER_HOURLY_SLOTS];
+    int codes[WEATHER_HOURLY_SLOTS];
+    unsigned int time_valid;            // Bit i: slot i holds a value (null entries stay clear)
+    unsigned int temperature_valid;
+    unsigned int code_valid;
+    unsigned int fields;                // HAS_* bits of the members found
+} WeatherResponse;
+
+typedef struct {
+    const char *p;
+    const char *end;
+} JsonCursor;
+
+typedef int (*JsonMemberFn)(JsonCursor *cursor, const char *key, size_t key_length, WeatherResponse *response);
+typedef int (*JsonElementFn)(JsonCursor *cursor, int index, WeatherResponse *response);
+
+static void json_skip_space(JsonCursor *cursor) {
+    while (cursor->p < cursor->end &&
+           (*cursor->p == ' ' || *cursor->p == '\t' || *cursor->p == '\n' || *cursor->p == '\r')) {
+        cursor->p++;
     }
-    
-    char url[MAX_REQUEST_URL_LENGTH];
-    int url_len = snprintf(url, sizeof(url), 
-        "%s/v1/forecast?"
-        "latitude=%.2f&longitude=%.2f&"
-        "current=temperature_2m,weather_code,is_day&"
-        "hourly=temperature_2m,weather_code&"
-        "daily=sunrise,sunset&"
-        "timezone=auto&forecast_hours=%d", 
-        client->api_base_url, client->latitude, client->longitude, MAX_FORECAST_HOURS + 1);
-    
-    if (url_len >= (int)sizeof(url)) {
-        return NULL;  // URL too long
+}
+
+// Consume ch after optional whitespace; returns 1 if it was there
+static int json_accept(JsonCursor *cursor, char ch) {
+    json_skip_space(cursor);
+    if (cursor->p < cursor->end && *cursor->p == ch) {
+        cursor->p++;
+        return 1;
     }
-    
-    char *response = http_get(url);
-    if (!response) {
-        return NULL;
+    return 0;
+}
+
+static int json_peek(JsonCursor *cursor) {
+    json_skip_space(cursor);
+    return cursor->p < cursor->end ? (unsigned char)*cursor->p : -1;
+}
+
+// String token in place: start/length cover the raw bytes between the quotes (escapes kept)
+static int json_string(JsonCursor *cursor, const char **start, size_t *length) {
+    if (!json_accept(cursor, '"')) {
+        return -1;
+    }
+    const char *first = cursor->p;
+    while (cursor->p < cursor->end && *cursor->p != '"') {
+        if (*cursor->p == '\\') cursor->p++;
+        cursor->p++;
+    }
+    if (cursor->p >= cursor->end) {
+        return -1;
+    }
+    *start = first;
+    *length = (size_t)(cursor->p - first);
+    cursor->p++;
+    return 0;
+}
+
+// Skip any value (nested containers included)
+static int json_skip_value(JsonCursor *cursor) {
+    const char *start;
+    size_t length;
+    int ch = json_peek(cursor);
+    if (ch == '"') {
+        return json_string(cursor, &start, &length);
+    }
+    
+    if (ch == '{' || ch == '[') {
+        int depth = 0;
+        while (cursor->p < cursor->end) {
+            if (*cursor->p == '"') {
+                if (json_string(cursor, &start, &length) != 0) return -1;
+                continue;
+            }
+            ch = *cursor->p++;
+            if (ch == '{' || ch == '[') {
+                depth++;
+            } else if ((ch == '}' || ch == ']') && --depth == 0) {
+                return 0;
+            }
+        }
+        return -1;
     }
     
-    cJSON *json = cJSON_Parse(response);
-    free(response);
-    return json;
+    // Number, true, false or null
+    start = cursor->p;
+    while (cursor->p < cursor->end && !strchr(",}] \t\r\n", *cursor->p)) {
+        cursor->p++;
+    }
+    return cursor->p > start ? 0 : -1;
 }
 
-// Process current weather data from JSON with validation
-static int process_current_weather(const cJSON *json, WeatherCurrent *current) {
-    if (!json || !current) {
+// Number, or null/other value (skipped, *present = 0)
+static int json_read_number(JsonCursor *cursor, double *value, int *present) {
+    int ch = json_peek(cursor);
+    *present = 0;
+    if (ch != '-' && (ch < '0' || ch > '9')) {
+        return json_skip_value(cursor);
+    }
+    
+    char *number_end;
+    *value = strtod(cursor->p, &number_end); // The HTTP body is NUL-terminated
+    if (number_end == cursor->p || number_end > cursor->end) {
         return -1;
     }
+    cursor->p = number_end;
+    *present = 1;
+    return 0;
+}
+
+// ISO 8601 string into a timestamp, or null/other value (skipped, *present = 0)
+static int json_read_datetime(JsonCursor *cursor, time_t *value, int *present) {
+    *present = 0;
+    if (json_peek(cursor) != '"') {
+        return json_skip_value(cursor);
+    }
     
-    const cJSON *current_json = cJSON_GetObjectItem(json, "current");
-    if (!current_json) {
+    const char *start;
+    size_t length;
+    if (json_string(cursor, &start, &length) != 0) {
+        return -1;
+    }
+    if (length < MAX_ISO_DATETIME_LENGTH) {
+        char datetime[MAX_ISO_DATETIME_LENGTH];
+        memcpy(datetime, start, length);
+        datetime[length] = '\0';
+        *value = parse_iso_datetime(datetime);
+        *present = 1;
+    }
+    return 0;
+}
+
+static int key_is(const char *key, size_t key_length, const char *name) {
+    return strlen(name) == key_length && memcmp(key, name, key_length) == 0;
+}
+
+// Walk an object; member() consumes the value of every key
+static int json_object(JsonCursor *cursor, JsonMemberFn member, WeatherResponse *response) {
+    if (!json_accept(cursor, '{')) {
         return -1;
     }
+    if (json_accept(cursor, '}')) {
+        return 0;
+    }
     
-    const cJSON *temp = cJSON_GetObjectItem(current_json, "temperature_2m");
-    const cJSON *weather_code = cJSON_GetObjectItem(current_json, "weather_code");
-    const cJSON *is_day = cJSON_GetObjectItem(current_json, "is_day");
+    do {
+        const char *key;
+        size_t key_length;
+        if (json_string(cursor, &key, &key_length) != 0 || !json_accept(cursor, ':') ||
+            member(cursor, key, key_length, response) != 0) {
+            return -1;
+        }
+    } while (json_accept(cursor, ','));
     
-    if (!cJSON_IsNumber(temp) || !cJSON_IsNumber(weather_code) || !cJSON_IsNumber(is_day)) {
+    return json_accept(cursor, '}') ? 0 : -1;
+}
+
+// Walk an array; element() consumes every value with its index
+static int json_array(JsonCursor *cursor, JsonElementFn element, WeatherResponse *response) {
+    if (!json_accept(cursor, '[')) {
         return -1;
     }
+    if (json_accept(cursor, ']')) {
+        return 0;
+    }
     
-    current->temperature = temp->valuedouble;
-    int code = weather_code->valueint;
-    int day = is_day->valueint;
+    int index = 0;
+    do {
+        if (element(cursor, index++, response) != 0) {
+            return -1;
+        }
+    } while (json_accept(cursor, ','));
     
-    safe_strncpy(current->description, get_weather_description(code), sizeof(current->description));
-    safe_strncpy(current->icon, get_weather_icon(code, day), sizeof(current->icon));
-    safe_strncpy(current->icon_unicode, get_weather_icon_unicode(code, day), sizeof(current->icon_unicode));
+    return json_accept(cursor, ']') ? 0 : -1;
+}
+
+static int current_member(JsonCursor *cursor, const char *key, size_t key_length, WeatherResponse *response) {
+    double value;
+    int present;
+    unsigned int field;
+    if (key_is(key, key_length, "temperature_2m")) {
+        field = HAS_CURRENT_TEMPERATURE;
+    } else if (key_is(key, key_length, "weather_code")) {
+        field = HAS_CURRENT_CODE;
+    } else if (key_is(key, key_length, "is_day")) {
+        field = HAS_CURRENT_IS_DAY;
+    } else {
+        return json_skip_value(cursor);
+    }
+    
+    if (json_read_number(cursor, &value, &present) != 0) {
+        return -1;
+    }
+    if (!present) {
+        return 0;
+    }
     
+    if (field == HAS_CURRENT_TEMPERATURE) {
+        response->current_temperature = value;
+    } else if (field == HAS_CURRENT_CODE) {
+        response->current_code = (int)value;
+    } else {
+        response->current_is_day = (int)value;
+    }
+    response->fields |= field;
     return 0;
 }
 
-// Process daily data to extract sunrise/sunset times
-static int process_daily_data(const cJSON *json, time_t *sunrise, time_t *sunset) {
-    if (!json || !sunrise || !sunset) {
+// Only today's sunrise and sunset (first element) are used
+static int sunrise_element(JsonCursor *cursor, int index, WeatherResponse *response) {
+    int present;
+    if (index > 0) {
+        return json_skip_value(cursor);
+    }
+    if (json_read_datetime(cursor, &response->sunrise, &present) != 0) {
         return -1;
     }
+    if (present) response->fields |= HAS_SUNRISE;
+    return 0;
+}
+
+static int sunset_element(JsonCursor *cursor, int index, WeatherResponse *response) {
+    int present;
+    if (index > 0) {
+        return json_skip_value(cursor);
+    }
+    if (json_read_datetime(cursor, &response->sunset, &present) != 0) {
+        return -1;
+    }
+    if (present) response->fields |= HAS_SUNSET;
+    return 0;
+}
+
+static int daily_member(JsonCursor *cursor, const char *key, size_t key_length, WeatherResponse *response) {
+    if (key_is(key, key_length, "sunrise")) {
+        return json_array(cursor, sunrise_element, response);
+    }
+    if (key_is(key, key_length, "sunset")) {
+        return json_array(cursor, sunset_element, response);
+    }
+    return json_skip_value(cursor);
+}
+
+// Parallel hourly arrays: values past the requested forecast_hours are skipped
+static int hourly_time_element(JsonCursor *cursor, int index, WeatherResponse *response) {
+    int present;
+    if (index >= WEATHER_HOURLY_SLOTS) {
+        return json_skip_value(cursor);
+    }
+    if (json_read_datetime(cursor, &response->times[index], &present) != 0) {
+        return -1;
+    }
+    if (present) response->time_valid |= 1u << index;
+    return 0;
+}
+
+static int hourly_temperature_element(JsonCursor *cursor, int index, WeatherResponse *response) {
+    int present;
+    if (index >= WEATHER_HOURLY_SLOTS) {
+        return json_skip_value(cursor);
+    }
+    if (json_read_number(cursor, &response->temperatures[index], &present) != 0) {
+        return -1;
+    }
+    if (present) response->temperature_valid |= 1u << index;
+    return 0;
+}
+
+static int hourly_code_element(JsonCursor *cursor, int index, WeatherResponse *response) {
+    double value;
+    int present;
+    if (index >= WEATHER_HOURLY_SLOTS) {
+        return json_skip_value(cursor);
+    }
+    if (json_read_number(cursor, &value, &present) != 0) {
+        return -1;
+    }
+    if (present) {
+        response->codes[index] = (int)value;
+        response->code_valid |= 1u << index;
+    }
+    return 0;
+}
+
+static int hourly_member(JsonCursor *cursor, const char *key, size_t key_length, WeatherResponse *response) {
+    JsonElementFn element;
+    unsigned int field;
+    if (key_is(key, key_length, "time")) {
+        element = hourly_time_element;
+        field = HAS_HOURLY_TIME;
+    } else if (key_is(key, key_length, "temperature_2m")) {
+        element = hourly_temperature_element;
+        field = HAS_HOURLY_TEMPERATURE;
+    } else if (key_is(key, key_length, "weather_code")) {
+        element = hourly_code_element;
+        field = HAS_HOURLY_CODE;
+    } else {
+        return json_skip_value(cursor);
+    }
+    
+    if (json_peek(cursor) != '[') {
+        return json_skip_value(cursor);
+    }
+    response->fields |= field;
+    return json_array(cursor, element, response);
+}
+
+static int root_member(JsonCursor *cursor, const char *key, size_t key_length, WeatherResponse *response) {
+    JsonMemberFn member;
+    if (key_is(key, key_length, "current")) {
+        member = current_member;
+    } else if (key_is(key, key_length, "hourly")) {
+        member = hourly_member;
+    } else if (key_is(key, key_length, "daily")) {
+        member = daily_member;
+    } else {
+        return json_skip_value(cursor);
+    }
+    
+    if (json_peek(cursor) != '{') {
+        return json_skip_value(cursor);
+    }
+    return json_object(cursor, member, response);
+}
+
+// Scan the response body into response (syntax errors fail, unknown members are skipped)
+static int parse_weather_response(const char *body, size_t length, WeatherResponse *response) {
+    JsonCursor cursor = { body, body + length };
+    memset(response, 0, sizeof(*response));
     
-    *sunrise = 0;
-    *sunset = 0;
-    
-    const cJSON *daily = cJSON_GetObjectItem(json, "daily");
-    if (!daily) {
+    if (json_object(&cursor, root_member, response) != 0) {
+        return -1;
+    }
+    json_skip_space(&cursor);
+    return cursor.p == cursor.end ? 0 : -1;
+}
+
+// Fetch and scan the weather response from the API
+// Sets *not_modified (and returns -1) when the server answers 304 to the conditional request
+static int fetch_weather_response(WeatherClient *client, WeatherResponse *weather_response,
+                                  int *not_modified, HttpValidators *received) {
+    if (!client || !weather_response || !not_modified || !received) {
         return -1;
     }
+    *not_modified = 0;
+    
+    char url[MAX_REQUEST_URL_LENGTH];
+    int url_len = snprintf(url, sizeof(url), 
+        "%s/v1/forecast?"
+        "latitude=%.2f&longitude=%.2f&"
+        "current=temperature_2m,weather_code,is_day&"
+        "hourly=temperature_2m,weather_code&"
+        "daily=sunrise,sunset&"
+        "timezone=auto&forecast_hours=%d", 
+        client->api_base_url, client->latitude, client->longitude, WEATHER_HOURLY_SLOTS);
     
-    const cJSON *sunrise_array = cJSON_GetObjectItem(daily, "sunrise");
-    const cJSON *sunset_array = cJSON_GetObjectItem(daily, "sunset");
+    if (url_len >= (int)sizeof(url)) {
+        return -1;  // URL too long
+    }
     
-    if (!cJSON_IsArray(sunrise_array) || !cJSON_IsArray(sunset_array)) {
+    HttpResponse response;
+    uint64_t started = metrics_start();
+    int result = http_get_conditional(url, client->has_last_data ? &client->validators : NULL, &response);
+    metrics_observe(METRIC_FETCH_WEATHER, started);
+    client->max_age = result == HTTP_RESULT_ERROR ? -1 : http_response_max_age(&response);
+    if (result == HTTP_RESULT_NOT_MODIFIED) {
+        http_response_free(&response);
+        *not_modified = 1;
+        return -1;
+    }
+    if (result != HTTP_RESULT_OK || !response.body) {
+        http_response_free(&response);
         return -1;
     }
     
-    // Get today's sunrise/sunset (first item in array)
-    const cJSON *sunrise_item = cJSON_GetArrayItem(sunrise_array, 0);
-    const cJSON *sunset_item = cJSON_GetArrayItem(sunset_array, 0);
+    started = metrics_start();
+    int parsed = parse_weather_response(response.body, response.body_size, weather_response);
+    metrics_observe(METRIC_PARSE_WEATHER, started);
+    *received = response.validators;
+    http_response_free(&response);
+    return parsed;
+}
+
+// Process current weather data from the scanned response with validation
+static int process_current_weather(const WeatherResponse *response, WeatherCurrent *current) {
+    if (!response || !current) {
+        return -1;
+    }
     
-    if (cJSON_IsString(sunrise_item) && cJSON_IsString(sunset_item)) {
-        *sunrise = parse_iso_datetime(sunrise_item->valuestring);
-        *sunset = parse_iso_datetime(sunset_item->valuestring);
-        return 0;
+    const unsigned int required = HAS_CURRENT_TEMPERATURE | HAS_CURRENT_CODE | HAS_CURRENT_IS_DAY;
+    if ((response->fields & required) != required) {
+        return -1;
     }
     
-    return -1;
+    current->temperature = display_temperature(response->current_temperature);
+    current->weather_code = (uint8_t)response->current_code;
+    current->is_day = response->current_is_day != 0;
+    
+    return 0;
 }
 
-// Process hourly forecast data from JSON with validation
-static int process_hourly_forecast(const cJSON *json, WeatherForecast *forecasts, int *forecast_count, time_t sunrise, time_t sunset) {
-    if (!json || !forecasts || !forecast_count) {
+// Process daily data to extract sunrise/sunset times
+static int process_daily_data(const WeatherResponse *response, time_t *sunrise, time_t *sunset) {
+    if (!response || !sunrise || !sunset) {
         return -1;
     }
     
-    *forecast_count = 0;
+    *sunrise = 0;
+    *sunset = 0;
     
-    const cJSON *hourly = cJSON_GetObjectItem(json, "hourly");
-    if (!hourly) {
+    // Today's sunrise/sunset (first item of each array)
+    if ((response->fields & (HAS_SUNRISE | HAS_SUNSET)) != (HAS_SUNRISE | HAS_SUNSET)) {
         return -1;
     }
     
-    const cJSON *time_array = cJSON_GetObjectItem(hourly, "time");
-    const cJSON *temp_array = cJSON_GetObjectItem(hourly, "temperature_2m");
-    const cJSON *code_array = cJSON_GetObjectItem(hourly, "weather_code");
-    
-    if (!cJSON_IsArray(time_array) || !cJSON_IsArray(temp_array) || !cJSON_IsArray(code_array)) {
+    *sunrise = response->sunrise;
+    *sunset = response->sunset;
+    return 0;
+}
+
+// Process hourly forecast data from the scanned response with validation
+static int process_hourly_forecast(const WeatherResponse *response, WeatherForecast *forecasts, int *forecast_count, time_t sunrise, time_t sunset) {
+    if (!response || !forecasts || !forecast_count) {
         return -1;
     }
     
-    int count = cJSON_GetArraySize(time_array);
-    // Skip first hour (same as current weather) and limit to MAX_FORECAST_HOURS
-    if (count > MAX_FORECAST_HOURS + 1) {
-        count = MAX_FORECAST_HOURS + 1;
+    *forecast_count = 0;
+    
+    const unsigned int required = HAS_HOURLY_TIME | HAS_HOURLY_TEMPERATURE | HAS_HOURLY_CODE;
+    if ((response->fields & required) != required) {
+        return -1;
     }
     
-    for (int i = 1; i < count; i++) {  // Start from index 1 to skip first hour
-        const cJSON *time_item = cJSON_GetArrayItem(time_array, i);
-        const cJSON *temp_item = cJSON_GetArrayItem(temp_array, i);
-        const cJSON *code_item = cJSON_GetArrayItem(code_array, i);
-        
-        if (cJSON_IsString(time_item) && cJSON_IsNumber(temp_item) && cJSON_IsNumber(code_item)) {
-            int forecast_index = i - 1;  // Adjust index for forecast array
-            forecasts[forecast_index].datetime = parse_iso_datetime(time_item->valuestring);
-            forecasts[forecast_index].temperature = temp_item->valuedouble;
-            
-            int code = code_item->valueint;
-            int day = is_day_time(forecasts[forecast_index].datetime, sunrise, sunset);
-            
-            safe_strncpy(forecasts[forecast_index].description, get_weather_description(code), sizeof(forecasts[forecast_index].description));
-            safe_strncpy(forecasts[forecast_index].icon, get_weather_icon(code, day), sizeof(forecasts[forecast_index].icon));
-            safe_strncpy(forecasts[forecast_index].icon_unicode, get_weather_icon_unicode(code, day), sizeof(forecasts[forecast_index].icon_unicode));
-            
-            (*forecast_count)++;
+    unsigned int complete = response->time_valid & response->temperature_valid & response->code_valid;
+    for (int i = 1; i < WEATHER_HOURLY_SLOTS; i++) {  // Start from index 1 to skip first hour
+        if (!(complete & (1u << i))) {
+            continue;
         }
+        
+        WeatherForecast *forecast = &forecasts[*forecast_count];
+        forecast->datetime = response->times[i];
+        forecast->temperature = display_temperature(response->temperatures[i]);
+        forecast->weather_code = (uint8_t)response->codes[i];
+        forecast->is_day = (uint8_t)is_day_time(forecast->datetime, sunrise, sunset);
+        
+        (*forecast_count)++;
     }
     
     return 0;
@@ -287,39 +628,48 @@ int get_weather_data(WeatherClient *client, WeatherData *data) {
     LOG_DEBUG("🌤️  Fetching weather for %s (%.2f, %.2f)", 
                WEATHER_CITY, client->latitude, client->longitude);
     
-    // Fetch JSON data from API
-    cJSON *json = fetch_weather_json(client);
-    if (!json) {
+    // Fetch JSON data from API (conditional when a previous response is cached)
+    int not_modified = 0;
+    HttpValidators received;
+    WeatherResponse response;
+    int fetched = fetch_weather_response(client, &response, &not_modified, &received);
+    if (not_modified) {
+        *data = client->last_data;
+        data->last_updated = time(NULL);
+        LOG_DEBUG("🌤️  Weather not modified (304), reusing last response");
+        return 0;
+    }
+    if (fetched != 0) {
         LOG_ERROR("❌ Failed to fetch weather data");
         return -1;
     }
     
     // Process current weather
-    if (process_current_weather(json, &data->current) != 0) {
+    if (process_current_weather(&response, &data->current) != 0) {
         LOG_ERROR("❌ Failed to process current weather");
-        cJSON_Delete(json);
         return -1;
     }
     
     // Process daily data for sunrise/sunset
-    if (process_daily_data(json, &data->sunrise, &data->sunset) != 0) {
+    if (process_daily_data(&response, &data->sunrise, &data->sunset) != 0) {
         LOG_ERROR("❌ Failed to process daily data");
-        cJSON_Delete(json);
         return -1;
     }
     
     // Process hourly forecast
-    if (process_hourly_forecast(json, data->forecasts, &data->forecast_count, data->sunrise, data->sunset) != 0) {
+    if (process_hourly_forecast(&response, data->forecasts, &data->forecast_count, data->sunrise, data->sunset) != 0) {
         LOG_ERROR("❌ Failed to process forecast data");
-        cJSON_Delete(json);
         return -1;
     }
     
-    cJSON_Delete(json);
-    
     // Set timestamp for successful weather data retrieval
     data->last_updated = time(NULL);
     
+    // Remember for 304 responses (validators only once the response fully parsed)
+    client->validators = received;
+    client->last_data = *data;
+    client->has_last_data = 1;
+    
     LOG_DEBUG("✅ Weather data retrieved successfully (current + %d forecasts)", data->forecast_count);
     
     return 0;
@@ -345,10 +695,18 @@ WeatherClient* weather_client_init(const char* api_base_url, double latitude, do
     client->latitude = latitude;
     client->longitude = longitude;
     client->debug = debug;
+    memset(&client->validators, 0, sizeof(client->validators));
+    memset(&client->last_data, 0, sizeof(client->last_data));
+    client->has_last_data = 0;
+    client->max_age = -1;
     
     return client;
 }
 
+long weather_client_max_age(const WeatherClient *client) {
+    return client ? client->max_age : -1;
+}
+
 // Weather client cleanup
 void weather_client_free(WeatherClient *client) {
     if (client) {
@@ -357,48 +715,17 @@ void weather_client_free(WeatherClient *client) {
 }
 
 // Weather data comparison function
+// Compares exactly what is displayed: rounded temperatures, codes, day flags and forecast hours
 int weather_data_changed(const WeatherData *current, const WeatherData *previous) {
     if (!current || !previous) {
         return 1; // Consider it changed if either is null
     }
     
-    // Compare current weather
-    if (fabs(current->current.temperature - previous->current.temperature) > 0.5) {
-        return 1;
-    }
-    if (strcmp(current->current.description, previous->current.description) != 0) {
-        return 1;
-    }
-    if (strcmp(current->current.icon, previous->current.icon) != 0) {
-        return 1;
-    }
-    
-    // Compare forecast count
     if (current->forecast_count != previous->forecast_count) {
         return 1;
     }
     
-    // Compare forecasts
-    for (int i = 0; i < current->forecast_count; i++) {
-        if (fabs(current->forecasts[i].temperature - previous->forecasts[i].temperature) > 0.5) {
-            return 1;
-        }
-        if (strcmp(current->forecasts[i].description, previous->forecasts[i].description) != 0) {
-            return 1;
-        }
-        if (strcmp(current->forecasts[i].icon, previous->forecasts[i].icon) != 0) {
-            return 1;
-        }
-        // Note: datetime differences are expected for forecasts, so we don't compare them
-    }
-    
-    // Compare sunrise/sunset times (allow 10 minute tolerance for minor variations)
-    if (abs((int)(current->sunrise - previous->sunrise)) > 600) {
-        return 1;
-    }
-    if (abs((int)(current->sunset - previous->sunset)) > 600) {
-        return 1;
-    }
-    
-    return 0; // No significant changes detected
+    return memcmp(&current->current, &previous->current, sizeof(WeatherCurrent)) != 0 ||
+           memcmp(current->forecasts, previous->forecasts,
+                  current->forecast_count * sizeof(WeatherForecast)) != 0;
 }
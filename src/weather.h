@@ -1,6 +1,7 @@
 #ifndef WEATHER_H
 #define WEATHER_H
 
+#include <stdint.h>
 #include <time.h>
 
 // Constants
@@ -11,19 +12,19 @@
 #define DAY_END_HOUR 20
 
 // Weather data structures
+// Compact by design: descriptions and icons are resolved from the WMO code at display time,
+// and the structs are always built zeroed so that weather_data_changed() can memcmp them
 typedef struct {
-    double temperature;
-    char description[256];
-    char icon[64];
-    char icon_unicode[64];
+    int16_t temperature;        // °C, rounded the way it is displayed
+    uint8_t weather_code;       // WMO weather interpretation code
+    uint8_t is_day;
 } WeatherCurrent;
 
 typedef struct {
     time_t datetime;
-    double temperature;
-    char description[256];
-    char icon[64];
-    char icon_unicode[64];
+    int16_t temperature;        // °C, rounded the way it is displayed
+    uint8_t weather_code;       // WMO weather interpretation code
+    uint8_t is_day;
 } WeatherForecast;
 
 typedef struct {
@@ -43,6 +44,14 @@ WeatherClient* weather_client_init(const char* api_base_url, double latitude, do
 void weather_client_free(WeatherClient *client);
 int get_weather_data(WeatherClient *client, WeatherData *data);
 
+// Seconds the last response stays fresh per its cache headers (-1 = none given)
+long weather_client_max_age(const WeatherClient *client);
+
+// Static strings for a WMO code (description, emoji, Material Symbols glyph)
+const char* get_weather_description(int code);
+const char* get_weather_icon(int code, int is_day);
+const char* get_weather_icon_unicode(int code, int is_day);
+
 // Weather data comparison
 int weather_data_changed(const WeatherData *current, const WeatherData *previous);
 
@@ -0,0 +1,280 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "pixel_convert.h"
+
+// Checks pixel_convert_frame against the float routine it replaced (write_surface_as_bmp in
+// display_dashboard.c) on gray frames: packed output must be bit-identical.
+// Built twice by "make check": with the compiled SIMD backend and with PIXEL_FORCE_SCALAR.
+
+// Portrait surface as rendered by dashboard_render.c, plus an odd size for tile and byte tails
+#define TEST_WIDTH 480
+#define TEST_HEIGHT 800
+#define TEST_ODD_WIDTH 477
+#define TEST_ODD_HEIGHT 803
+
+#define TEST_TEXT_FONT "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf"
+#define TEST_ICON_FONT PROJECT_ROOT "/config/fonts/MaterialSymbolsOutlined.ttf"
+
+typedef struct {
+    int width;
+    int height;
+    int stride;
+    uint8_t *pixels;            // Cairo RGB24 layout: B, G, R, unused
+} TestSurface;
+
+// ====================== REFERENCE ======================
+
+/**
+ * Float rotation, luma and right-only 7/16 diffusion, as write_surface_as_bmp did it
+ * Rows are stored top-down here (the BMP wrote the same rows bottom-up).
+ */
+static void reference_frame(const TestSurface *surface, uint8_t *frame, int row_bytes) {
+    int width = surface->width;
+    int height = surface->height;
+    int rotated_width = height;
+    int rotated_height = width;
+    float *error_buffer = calloc(rotated_width + 2, sizeof(float));
+    if (!error_buffer) {
+        return;
+    }
+
+    for (int y = rotated_height - 1; y >= 0; y--) {
+        uint8_t *row_data = frame + (size_t)y * row_bytes;
+        memset(row_data, 0, row_bytes);
+        for (int i = 0; i < rotated_width + 2; i++) {
+            error_buffer[i] = 0.0f;
+        }
+
+        for (int x = 0; x < rotated_width; x++) {
+            int orig_x = width - 1 - y;
+            int orig_y = x;
+            const uint8_t *pixel = surface->pixels + (size_t)orig_y * surface->stride + (size_t)orig_x * 4;
+
+            float gray = 0.299f * pixel[2] + 0.587f * pixel[1] + 0.114f * pixel[0];
+            gray += error_buffer[x + 1];
+            if (gray < 0) gray = 0;
+            if (gray > 255) gray = 255;
+
+            int quantized = (gray > 128) ? 255 : 0;
+            float error = gray - quantized;
+            if (x + 1 < rotated_width) {
+                error_buffer[x + 2] += error * 7.0f / 16.0f;
+            }
+            if (quantized) {
+                row_data[x / 8] |= (uint8_t)(1 << (7 - (x % 8)));
+            }
+        }
+    }
+    free(error_buffer);
+}
+
+// ====================== FIXTURES ======================
+
+static int surface_init(TestSurface *surface, int width, int height) {
+    surface->width = width;
+    surface->height = height;
+    surface->stride = width * 4 + 16;   // Padded like a Cairo stride can be
+    surface->pixels = calloc((size_t)surface->stride * height, 1);
+    return surface->pixels ? 0 : -1;
+}
+
+static inline void put_gray(TestSurface *surface, int x, int y, uint8_t value) {
+    uint8_t *pixel = surface->pixels + (size_t)y * surface->stride + (size_t)x * 4;
+    pixel[0] = pixel[1] = pixel[2] = value;
+    pixel[3] = 0xFF;
+}
+
+static void fill_gray(TestSurface *surface, uint8_t value) {
+    for (int y = 0; y < surface->height; y++) {
+        for (int x = 0; x < surface->width; x++) {
+            put_gray(surface, x, y, value);
+        }
+    }
+}
+
+// Decode one UTF-8 sequence (the icon font uses private-use code points)
+static uint32_t next_codepoint(const char **text) {
+    const unsigned char *c = (const unsigned char *)*text;
+    uint32_t codepoint = c[0];
+    int extra = c[0] >= 0xF0 ? 3 : c[0] >= 0xE0 ? 2 : c[0] >= 0xC0 ? 1 : 0;
+    if (extra) codepoint &= 0x3F >> extra;
+    int i = 1;
+    for (; i <= extra && (c[i] & 0xC0) == 0x80; i++) {
+        codepoint = (codepoint << 6) | (c[i] & 0x3F);
+    }
+    *text += i;
+    return codepoint;
+}
+
+/**
+ * Draw antialiased black text with FreeType on white, wrapping at the surface edge
+ * Returns: 0 on success, -1 if the font can't be loaded
+ */
+static int draw_text(FT_Library library, TestSurface *surface, const char *font_path, int pixel_size,
+                     const char *text, int *pen_y) {
+    FT_Face face;
+    if (FT_New_Face(library, font_path, 0, &face)) {
+        fprintf(stderr, "❌ Failed to load font %s\n", font_path);
+        return -1;
+    }
+    FT_Set_Pixel_Sizes(face, 0, pixel_size);
+
+    int pen_x = 10;
+    int baseline = *pen_y + pixel_size;
+    while (*text) {
+        if (FT_Load_Char(face, next_codepoint(&text), FT_LOAD_RENDER)) continue;
+        FT_GlyphSlot glyph = face->glyph;
+        if (pen_x + (int)(glyph->advance.x >> 6) >= surface->width - 10) {
+            pen_x = 10;
+            baseline += pixel_size + pixel_size / 4;
+        }
+
+        for (unsigned int row = 0; row < glyph->bitmap.rows; row++) {
+            for (unsigned int col = 0; col < glyph->bitmap.width; col++) {
+                int x = pen_x + glyph->bitmap_left + (int)col;
+                int y = baseline - glyph->bitmap_top + (int)row;
+                if (x < 0 || y < 0 || x >= surface->width || y >= surface->height) continue;
+                uint8_t coverage = glyph->bitmap.buffer[row * glyph->bitmap.pitch + col];
+                put_gray(surface, x, y, (uint8_t)(255 - coverage));
+            }
+        }
+        pen_x += (int)(glyph->advance.x >> 6);
+    }
+
+    *pen_y = baseline + pixel_size / 2;
+    FT_Done_Face(face);
+    return 0;
+}
+
+static int fixture_text(TestSurface *surface, const char *text_font) {
+    FT_Library library;
+    if (FT_Init_FreeType(&library)) {
+        fprintf(stderr, "❌ Failed to initialize FreeType\n");
+        return -1;
+    }
+
+    fill_gray(surface, 255);
+    int pen_y = 10;
+    int result = draw_text(library, surface, text_font, 40, "Lundi 10 mars 2025 09:15", &pen_y);
+    if (result == 0) {
+        result = draw_text(library, surface, text_font, 18,
+                           "Entrée : salade de lentilles. Plat : poulet rôti, haricots verts. "
+                           "Dessert : tarte aux pommes. 14:00 Dentiste - 18:30 Piscine", &pen_y);
+    }
+    if (result == 0) {
+        result = draw_text(library, surface, text_font, 11,
+                           "Ressenti 5°C  Vent 12 km/h  Humidité 81 %  Pluie 0.4 mm", &pen_y);
+    }
+    if (result == 0) {
+        result = draw_text(library, surface, TEST_ICON_FONT, 64, "\ue81a\uef44\uf172\ue2bd\ue818\uf61a", &pen_y);
+    }
+    FT_Done_FreeType(library);
+    return result;
+}
+
+static int fixture_gradient(TestSurface *surface, const char *text_font) {
+    (void)text_font;
+    for (int y = 0; y < surface->height; y++) {
+        for (int x = 0; x < surface->width; x++) {
+            put_gray(surface, x, y, (uint8_t)((x * 3 + y) & 0xFF));
+        }
+    }
+    return 0;
+}
+
+static int fixture_noise(TestSurface *surface, const char *text_font) {
+    (void)text_font;
+    uint32_t state = 0x2545F491u;
+    for (int y = 0; y < surface->height; y++) {
+        for (int x = 0; x < surface->width; x++) {
+            state = state * 1664525u + 1013904223u;
+            put_gray(surface, x, y, (uint8_t)(state >> 24));
+        }
+    }
+    return 0;
+}
+
+// ====================== TEST RUNNER ======================
+
+static const struct {
+    const char *name;
+    int (*fill)(TestSurface *surface, const char *text_font);
+} fixtures[] = {
+    { "text", fixture_text },
+    { "gradient", fixture_gradient },
+    { "noise", fixture_noise }
+};
+
+/**
+ * Convert one fixture both ways and compare the packed frames
+ * Returns: 0 if identical, -1 on a mismatch or setup failure
+ */
+static int run_fixture(int index, int width, int height, const char *text_font) {
+    TestSurface surface;
+    if (surface_init(&surface, width, height) != 0) {
+        fprintf(stderr, "❌ Out of memory\n");
+        return -1;
+    }
+
+    // Landscape frame: `width` rows of `height` pixels
+    int row_bytes = (height + 7) / 8;
+    size_t frame_size = (size_t)row_bytes * width;
+    uint8_t *expected = malloc(frame_size);
+    uint8_t *actual = malloc(frame_size);
+    uint8_t *luma = malloc((size_t)width * height);
+    int result = -1;
+
+    if (expected && actual && luma && fixtures[index].fill(&surface, text_font) == 0) {
+        memset(actual, 0xA5, frame_size);
+        reference_frame(&surface, expected, row_bytes);
+        pixel_convert_frame(surface.pixels, width, height, surface.stride, luma, actual, row_bytes);
+
+        long differing_bits = 0;
+        size_t first = frame_size;
+        for (size_t i = 0; i < frame_size; i++) {
+            uint8_t diff = expected[i] ^ actual[i];
+            if (diff && first == frame_size) first = i;
+            differing_bits += __builtin_popcount(diff);
+        }
+
+        if (differing_bits == 0) {
+            printf("✅ %-8s %dx%d: identical\n", fixtures[index].name, width, height);
+            result = 0;
+        } else {
+            printf("❌ %-8s %dx%d: %ld bits differ (first at row %zu, byte %zu)\n", fixtures[index].name,
+                   width, height, differing_bits, first / row_bytes, first % row_bytes);
+        }
+    }
+
+    free(luma);
+    free(actual);
+    free(expected);
+    free(surface.pixels);
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+    const char *text_font = argc > 1 ? argv[1] : TEST_TEXT_FONT;
+    const int sizes[2][2] = { { TEST_WIDTH, TEST_HEIGHT }, { TEST_ODD_WIDTH, TEST_ODD_HEIGHT } };
+
+    printf("🧪 pixel_convert_frame vs float reference, %s backend\n", pixel_convert_backend());
+
+    int failures = 0;
+    for (int i = 0; i < (int)(sizeof(fixtures) / sizeof(fixtures[0])); i++) {
+        for (int s = 0; s < 2; s++) {
+            if (run_fixture(i, sizes[s][0], sizes[s][1], text_font) != 0) {
+                failures++;
+            }
+        }
+    }
+
+    if (failures > 0) {
+        printf("❌ %d check%s failed\n", failures, failures > 1 ? "s" : "");
+        return 1;
+    }
+    return 0;
+}
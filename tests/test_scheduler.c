@@ -0,0 +1,166 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "scheduler.h"
+#include "poll_policy.h"
+
+// Drives a weather-like job through the scheduler: the job plans its next run from
+// poll_policy_next once it has run, and the scheduler must keep that plan even when it is
+// later than the one made at dispatch (unchanged responses, cache headers, failures).
+
+#define TEST_WAIT_MS 5000
+#define TEST_MAX_AGE (25 * 60)      // Cache-Control max-age of the fake responses
+
+typedef enum {
+    OUTCOME_CHANGED,
+    OUTCOME_UNCHANGED,
+    OUTCOME_CACHED,
+    OUTCOME_FAILED
+} PollOutcome;
+
+typedef struct {
+    Scheduler *scheduler;
+    int job_id;
+    PollPolicy policy;
+    PollOutcome outcome;        // Outcome of the next run
+    time_t planned;             // Next poll as planned by the job (SCHEDULER_NEVER = parked), atomic
+    time_t retry;               // Retry planned by the last failure
+    int runs;                   // Completed runs, atomic
+} PollJob;
+
+// ====================== JOB ======================
+
+// Same shape as update_weather: record the outcome, then reschedule from the policy
+static void poll_job(time_t due, void *arg) {
+    (void)due;
+    PollJob *job = (PollJob*)arg;
+    time_t now = time(NULL);
+
+    if (job->outcome == OUTCOME_FAILED) {
+        job->retry = poll_policy_record_failure(&job->policy, now);
+        __atomic_store_n(&job->planned, SCHEDULER_NEVER, __ATOMIC_RELEASE);
+        scheduler_reschedule(job->scheduler, job->job_id, SCHEDULER_NEVER);
+    } else {
+        poll_policy_record_success(&job->policy, now, job->outcome == OUTCOME_CHANGED,
+                                   job->outcome == OUTCOME_CACHED ? TEST_MAX_AGE : -1);
+        time_t next = poll_policy_next(&job->policy, now);
+        __atomic_store_n(&job->planned, next, __ATOMIC_RELEASE);
+        scheduler_reschedule(job->scheduler, job->job_id, next);
+    }
+    __atomic_add_fetch(&job->runs, 1, __ATOMIC_RELEASE);
+}
+
+// Same shape as next_weather_time: the base interval only stands in until the run completes
+static time_t poll_next(time_t now, void *arg) {
+    PollJob *job = (PollJob*)arg;
+    time_t next = __atomic_load_n(&job->planned, __ATOMIC_ACQUIRE);
+    if (next == SCHEDULER_NEVER) {
+        return SCHEDULER_NEVER;
+    }
+    return next > now ? next : now + POLL_DEFAULT_BASE_INTERVAL;
+}
+
+static void* run_scheduler(void *arg) {
+    scheduler_run((Scheduler*)arg);
+    return NULL;
+}
+
+// ====================== TEST RUNNER ======================
+
+/**
+ * Trigger one run with the given outcome and wait for it to complete
+ * Returns: 0 once the run completed, -1 on timeout
+ */
+static int run_once(PollJob *job, PollOutcome outcome) {
+    int runs = __atomic_load_n(&job->runs, __ATOMIC_ACQUIRE);
+    job->outcome = outcome;
+    scheduler_trigger(job->scheduler, job->job_id);
+
+    for (int waited = 0; waited < TEST_WAIT_MS; waited += 10) {
+        if (__atomic_load_n(&job->runs, __ATOMIC_ACQUIRE) > runs) {
+            return 0;
+        }
+        usleep(10 * 1000);
+    }
+    return -1;
+}
+
+/**
+ * Check the scheduler kept the plan of the last run
+ * Returns: 0 if kept, -1 otherwise
+ */
+static int expect_plan(PollJob *job, const char *name) {
+    time_t planned = __atomic_load_n(&job->planned, __ATOMIC_ACQUIRE);
+    time_t next_run = scheduler_next_run(job->scheduler, job->job_id);
+    long in = planned == SCHEDULER_NEVER ? -1 : (long)(planned - time(NULL));
+
+    if (next_run != planned) {
+        printf("❌ %-10s scheduler plans %+lds, policy %+lds\n", name,
+               next_run == SCHEDULER_NEVER ? -1 : (long)(next_run - time(NULL)), in);
+        return -1;
+    }
+    if (planned == SCHEDULER_NEVER) {
+        printf("✅ %-10s parked (retry in %lds)\n", name, (long)(job->retry - time(NULL)));
+    } else {
+        printf("✅ %-10s next run in %lds\n", name, in);
+    }
+    return 0;
+}
+
+int main(void) {
+    static const struct {
+        const char *name;
+        PollOutcome outcome;
+    } steps[] = {
+        { "changed", OUTCOME_CHANGED },
+        { "unchanged", OUTCOME_UNCHANGED },
+        { "unchanged", OUTCOME_UNCHANGED },
+        { "unchanged", OUTCOME_UNCHANGED },
+        { "changed", OUTCOME_CHANGED },
+        { "cached", OUTCOME_CACHED },
+        { "failed", OUTCOME_FAILED },
+        { "recovered", OUTCOME_CHANGED }
+    };
+
+    PollJob job;
+    memset(&job, 0, sizeof(job));
+    poll_policy_init(&job.policy, POLL_DEFAULT_BASE_INTERVAL, POLL_DEFAULT_MAX_INTERVAL);
+    job.planned = time(NULL) + POLL_DEFAULT_BASE_INTERVAL;
+
+    job.scheduler = scheduler_create(1);
+    if (!job.scheduler) {
+        fprintf(stderr, "❌ Failed to create scheduler\n");
+        return 1;
+    }
+    job.job_id = scheduler_add(job.scheduler, "weather", poll_job, poll_next, &job);
+    pthread_t thread;
+    if (job.job_id < 0 || pthread_create(&thread, NULL, run_scheduler, job.scheduler) != 0) {
+        fprintf(stderr, "❌ Failed to start scheduler\n");
+        scheduler_free(job.scheduler);
+        return 1;
+    }
+
+    printf("🧪 poll_policy_next through the scheduler\n");
+
+    int failures = 0;
+    for (int i = 0; i < (int)(sizeof(steps) / sizeof(steps[0])); i++) {
+        if (run_once(&job, steps[i].outcome) != 0) {
+            printf("❌ %-10s job did not run\n", steps[i].name);
+            failures++;
+        } else if (expect_plan(&job, steps[i].name) != 0) {
+            failures++;
+        }
+    }
+
+    scheduler_stop(job.scheduler);
+    pthread_join(thread, NULL);
+    scheduler_free(job.scheduler);
+
+    if (failures > 0) {
+        printf("❌ %d check%s failed\n", failures, failures > 1 ? "s" : "");
+        return 1;
+    }
+    return 0;
+}